@@ -27,7 +27,11 @@
 #include <llvm/IR/Module.h>
 #include <llvm/IR/Type.h>
 #include <llvm/IR/Verifier.h>
+#include <llvm/Object/ELFObjectFile.h>
+#include <llvm/Object/ObjectFile.h>
+#include <llvm/Support/Error.h>
 #include <llvm/Support/FileSystem.h>
+#include <llvm/Support/MemoryBuffer.h>
 #include <llvm/Support/raw_ostream.h>
 #include <remill/Arch/Arch.h>
 #include <remill/Arch/Instruction.h>
@@ -45,11 +49,14 @@
 #include <cstdint>
 #include <fstream>
 #include <functional>
+#include <iomanip>
 #include <iostream>
 #include <map>
 #include <memory>
+#include <set>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <system_error>
 
 DEFINE_string(os, REMILL_OS,
@@ -71,6 +78,13 @@ DEFINE_uint64(entry_address, -1,
 
 DEFINE_string(bytes, "", "Hex-encoded byte string to lift.");
 
+DEFINE_string(binary, "",
+              "Path to a binary to lift. ELF executables are lifted starting "
+              "from their entrypoint and every function in their symbol "
+              "tables, and the architecture defaults to that of the ELF. "
+              "Other files are treated as raw code images located at "
+              "-address.");
+
 DEFINE_string(
     ir_pre_out, "",
     "Path to the file where the LLVM IR (before optimization) should be saved");
@@ -80,16 +94,124 @@ DEFINE_string(bc_out, "",
               "Path to file where the LLVM bitcode should be "
               "saved.");
 
+DEFINE_uint32(opt_level, 0,
+              "Optimization level, from 0 to 3, used for the lifted code. "
+              "At level 0, semantics functions are inlined, but the lifted "
+              "code is otherwise unoptimized.");
+DEFINE_bool(opt_report, false,
+            "Log instruction counts before and after optimization, and the "
+            "time taken to optimize.");
+
+DEFINE_bool(promote_registers, false,
+            "Keep the guest registers used by each lifted trace in SSA form, "
+            "and only write them back to the State structure before calls "
+            "and returns. Requires a non-zero --opt_level.");
+
+DEFINE_bool(eliminate_dead_flags, false,
+            "Remove stores to flag registers that are overwritten before "
+            "they are read. Requires a non-zero --opt_level.");
+
+DEFINE_bool(coalesce_memory, false,
+            "Merge adjacent reads or writes of guest memory into wider "
+            "reads or writes.");
+DEFINE_bool(lower_memory, false,
+            "Lower the memory intrinsics into direct loads and stores of "
+            "host memory, at the host address of guest address zero plus "
+            "the guest address.");
+DEFINE_uint64(memory_base, 0,
+              "Host address of guest address zero, used with "
+              "--lower_memory.");
+DEFINE_string(memory_base_variable, "",
+              "Name of a global pointer variable that holds the host address "
+              "of guest address zero, used with --lower_memory instead of "
+              "--memory_base.");
+DEFINE_uint64(memory_mask, 0,
+              "Mask applied to guest addresses before they are added to the "
+              "memory base, used with --lower_memory. Zero disables "
+              "masking. Bulk copies and fills aren't lowered when "
+              "masking.");
+DEFINE_bool(memory_misaligned_atomics, false,
+            "Allow lowered atomic accesses to be misaligned, used with "
+            "--lower_memory. These become calls to libatomic, which are "
+            "much slower than naturally aligned host atomics.");
+
+DEFINE_bool(lazy_semantics, false,
+            "Only read the bodies of the semantics functions that are used "
+            "by the lifted code.");
+
+DEFINE_string(lift_cache_dir, "",
+              "Directory in which lifted traces are cached, and from which "
+              "they are reused when the lifted bytes are unchanged.");
+
+DEFINE_uint64(decode_cache_size, 0,
+              "Number of decoded instructions to cache and reuse when the "
+              "same bytes are decoded again. Zero disables the cache.");
+
+DEFINE_bool(lift_templates, false,
+            "Reuse the operand IR lifted for earlier instructions of the same "
+            "form instead of lifting every operand from scratch.");
+
+DEFINE_uint32(lift_threads, 0,
+              "Number of worker threads used to lift traces in parallel. Zero "
+              "lifts all traces on the main thread.");
+
 DEFINE_string(signature, "", "Function signature \"reg_out(reg_in,...)\"");
 DEFINE_bool(mute_state_escape, false, "Mute state escape");
 DEFINE_bool(symbolic_regs, false, "Set registers to a symbolic value");
 
-using Memory = std::map<uint64_t, uint8_t>;
+// Executable memory of the code being lifted. The bytes are either owned,
+// in the case of `-bytes`, or point into a memory-mapped `-binary`.
+class Memory {
+ public:
+  // Add a range of executable bytes located at `addr`.
+  void AddRange(uint64_t addr, std::string_view range_bytes) {
+    if (!range_bytes.empty()) {
+      ranges[addr] = range_bytes;
+    }
+  }
 
-// Unhexlify the data passed to `-bytes`, and fill in `memory` with each
-// such byte.
-static Memory UnhexlifyInputBytes(uint64_t addr_mask) {
-  Memory memory;
+  // Returns the executable bytes starting at `addr`, up to the end of the
+  // range that contains `addr`. Returns an empty view if `addr` isn't
+  // executable.
+  std::string_view Find(uint64_t addr) const {
+    auto range_it = ranges.upper_bound(addr);
+    if (range_it == ranges.begin()) {
+      return {};
+    }
+    --range_it;
+    const auto offset = addr - range_it->first;
+    if (offset >= range_it->second.size()) {
+      return {};
+    }
+    return range_it->second.substr(offset);
+  }
+
+  // Returns `true` if all of the executable bytes are addressable with
+  // addresses that fit in `addr_mask`.
+  bool FitsInAddressSpace(uint64_t addr_mask) const {
+    for (const auto &[addr, range_bytes] : ranges) {
+      if (addr > addr_mask || (range_bytes.size() - 1u) > (addr_mask - addr)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Backing storage for the bytes of `-bytes`.
+  std::string bytes;
+
+  // Backing storage for the bytes of `-binary`.
+  std::unique_ptr<llvm::MemoryBuffer> file;
+
+ private:
+  // Executable ranges, keyed by their starting address.
+  std::map<uint64_t, std::string_view> ranges;
+};
+
+// Unhexlify the data passed to `-bytes`, and fill in `memory` with the
+// bytes.
+static void UnhexlifyInputBytes(Memory &memory, uint64_t addr_mask) {
+  memory.bytes.reserve(FLAGS_bytes.size() / 2);
 
   for (size_t i = 0; i < FLAGS_bytes.size(); i += 2) {
     char nibbles[] = {FLAGS_bytes[i], FLAGS_bytes[i + 1], '\0'};
@@ -119,10 +241,163 @@ static Memory UnhexlifyInputBytes(uint64_t addr_mask) {
       exit(EXIT_FAILURE);
     }
 
-    memory[byte_addr] = static_cast<uint8_t>(byte_val);
+    memory.bytes.push_back(static_cast<char>(byte_val));
+  }
+
+  memory.AddRange(FLAGS_address, memory.bytes);
+}
+
+// Add the executable `PT_LOAD` segments of `elf` to `memory`. The segments
+// are not copied; they point into the mapped file.
+template <typename ELFT>
+static void AddExecutableSegments(const llvm::object::ELFObjectFile<ELFT> &obj,
+                                  Memory &memory) {
+  const auto &elf = obj.getELFFile();
+  auto phdrs = elf.program_headers();
+  if (!phdrs) {
+    LOG(ERROR) << "Could not read program headers of " << FLAGS_binary << ": "
+               << llvm::toString(phdrs.takeError());
+    return;
+  }
+
+  const std::string_view data(
+      reinterpret_cast<const char *>(elf.base()), elf.getBufSize());
+
+  for (const auto &phdr : *phdrs) {
+    if (phdr.p_type != llvm::ELF::PT_LOAD ||
+        !(phdr.p_flags & llvm::ELF::PF_X) || phdr.p_offset >= data.size()) {
+      continue;
+    }
+
+    // Bytes past `p_filesz` are zero-filled at load time, so they aren't code.
+    memory.AddRange(phdr.p_vaddr,
+                    data.substr(phdr.p_offset, phdr.p_filesz));
   }
+}
 
-  return memory;
+// Returns the name of the remill architecture corresponding to `obj`, or an
+// empty string if it's not one we know about.
+static std::string ArchNameOfBinary(const llvm::object::ObjectFile &obj) {
+  switch (obj.getArch()) {
+    case llvm::Triple::x86: return "x86";
+    case llvm::Triple::x86_64: return "amd64";
+    case llvm::Triple::aarch64: return "aarch64";
+    case llvm::Triple::arm: return "aarch32";
+    case llvm::Triple::sparc: return "sparc32";
+    case llvm::Triple::sparcv9: return "sparc64";
+    case llvm::Triple::ppc: return "ppc";
+    default: return "";
+  }
+}
+
+// Memory-map `-binary` into `memory`. If it is an ELF file, then add its
+// executable segments to `memory`, and the addresses of its function symbols
+// to `entrypoints`, and return `true`. Otherwise, the whole file is treated as
+// code located at `-address`.
+static bool LoadInputBinary(Memory &memory, std::set<uint64_t> &entrypoints) {
+  auto maybe_file = llvm::MemoryBuffer::getFile(
+      FLAGS_binary, /*IsText=*/false, /*RequiresNullTerminator=*/false);
+  if (!maybe_file) {
+    std::cerr << "Could not open -binary file " << FLAGS_binary << ": "
+              << maybe_file.getError().message() << std::endl;
+    exit(EXIT_FAILURE);
+  }
+
+  memory.file = std::move(maybe_file.get());
+
+  auto maybe_obj =
+      llvm::object::ObjectFile::createObjectFile(memory.file->getMemBufferRef());
+  if (!maybe_obj) {
+    llvm::consumeError(maybe_obj.takeError());
+    memory.AddRange(FLAGS_address, memory.file->getBuffer());
+    return false;
+  }
+
+  auto obj = llvm::dyn_cast<llvm::object::ELFObjectFileBase>(maybe_obj->get());
+  if (!obj) {
+    std::cerr << "Only ELF files, or raw code images, can be passed to -binary."
+              << std::endl;
+    exit(EXIT_FAILURE);
+  }
+
+  // Relocatable objects have no program headers to take segments from.
+  if (obj->getEType() == llvm::ELF::ET_REL) {
+    std::cerr << "Relocatable object files can't be passed to -binary; "
+              << "link " << FLAGS_binary << " first." << std::endl;
+    exit(EXIT_FAILURE);
+  }
+
+  if (auto elf = llvm::dyn_cast<llvm::object::ELF32LEObjectFile>(obj)) {
+    AddExecutableSegments(*elf, memory);
+  } else if (auto elf = llvm::dyn_cast<llvm::object::ELF64LEObjectFile>(obj)) {
+    AddExecutableSegments(*elf, memory);
+  } else if (auto elf = llvm::dyn_cast<llvm::object::ELF32BEObjectFile>(obj)) {
+    AddExecutableSegments(*elf, memory);
+  } else if (auto elf = llvm::dyn_cast<llvm::object::ELF64BEObjectFile>(obj)) {
+    AddExecutableSegments(*elf, memory);
+  }
+
+  // NOTE: On ARM, a set low bit in a function symbol or the entrypoint marks
+  //       Thumb code, and isn't part of the address.
+  const bool is_arm = obj->getEMachine() == llvm::ELF::EM_ARM;
+  auto code_address = [=](uint64_t addr) -> uint64_t {
+    return is_arm ? (addr & ~1ull) : addr;
+  };
+
+  auto add_entrypoint = [&](const llvm::object::ELFSymbolRef &sym) {
+    if (sym.getELFType() != llvm::ELF::STT_FUNC) {
+      return;
+    }
+    auto maybe_addr = sym.getAddress();
+    if (!maybe_addr) {
+      llvm::consumeError(maybe_addr.takeError());
+    } else if (auto addr = code_address(*maybe_addr);
+               !memory.Find(addr).empty()) {
+      entrypoints.insert(addr);
+    }
+  };
+
+  for (const auto &sym : obj->symbols()) {
+    add_entrypoint(sym);
+  }
+
+  for (const auto &sym : obj->getDynamicSymbolIterators()) {
+    add_entrypoint(sym);
+  }
+
+  uint64_t elf_entry = 0;
+  if (auto maybe_start = obj->getStartAddress(); !maybe_start) {
+    llvm::consumeError(maybe_start.takeError());
+  } else {
+    elf_entry = *maybe_start;
+  }
+
+  if (FLAGS_arch.empty()) {
+    FLAGS_arch = ArchNameOfBinary(*obj);
+
+    // Decode Thumb code if the entrypoint is in Thumb code.
+    if (is_arm && (elf_entry & 1u)) {
+      FLAGS_arch = "thumb2";
+    }
+  }
+
+  if (FLAGS_entry_address != (uint64_t) -1) {
+    return true;
+  }
+
+  // Shared libraries often have an `e_entry` of zero, so start from the lowest
+  // function symbol instead.
+  if (elf_entry) {
+    FLAGS_entry_address = code_address(elf_entry);
+  } else if (!entrypoints.empty()) {
+    FLAGS_entry_address = *entrypoints.begin();
+  } else {
+    std::cerr << FLAGS_binary << " has no entrypoint and no function symbols; "
+              << "specify one with -entry_address." << std::endl;
+    exit(EXIT_FAILURE);
+  }
+
+  return true;
 }
 
 struct SimpleTraceManager : remill::TraceManager {
@@ -132,12 +407,17 @@ struct SimpleTraceManager : remill::TraceManager {
   uint64_t entry = 0;
   std::unordered_map<uint64_t, llvm::Function *> traces;
 
+  // If `true`, then lift any trace whose code is in `memory`, rather than
+  // only the trace starting at `entry`.
+  const bool lift_all;
+
   SimpleTraceManager(const remill::Arch *arch, llvm::Module *module,
-                     Memory &memory, uint64_t entry)
+                     Memory &memory, uint64_t entry, bool lift_all = false)
       : arch(arch),
         module(module),
         memory(memory),
-        entry(entry) {}
+        entry(entry),
+        lift_all(lift_all) {}
 
   // Called when we have lifted, i.e. defined the contents, of a new trace.
   // The derived class is expected to do something useful with this.
@@ -150,9 +430,14 @@ struct SimpleTraceManager : remill::TraceManager {
   //
   // NOTE: This is permitted to return a function from an arbitrary module.
   llvm::Function *GetLiftedTraceDefinition(uint64_t addr) override {
+    auto trace_it = traces.find(addr);
+    if (trace_it != traces.end()) {
+      return trace_it->second;
+    }
 
-    // The entry function needs to be lifted by the TraceLifter
-    if (addr == entry) {
+    // The entry function, and when lifting a whole binary, any other
+    // function whose code we have, needs to be lifted by the TraceLifter.
+    if (addr == entry || (lift_all && !memory.Find(addr).empty())) {
       return nullptr;
     }
 
@@ -181,16 +466,22 @@ struct SimpleTraceManager : remill::TraceManager {
   // at address `addr` is executable and readable, and updates the byte
   // pointed to by `byte` with the read value.
   bool TryReadExecutableByte(uint64_t addr, uint8_t *byte) override {
-    auto byte_it = memory.find(addr);
-    if (byte_it != memory.end()) {
+    auto bytes = memory.Find(addr);
+    if (!bytes.empty()) {
       if (byte != nullptr) {
-        *byte = byte_it->second;
+        *byte = static_cast<uint8_t>(bytes.front());
       }
       return true;
     } else {
       return false;
     }
   }
+
+  // Read up to `size` executable bytes starting at `addr`. The bytes are
+  // never copied.
+  std::string_view TryReadExecutableBytes(uint64_t addr, size_t size) override {
+    return memory.Find(addr).substr(0, size);
+  }
 };
 
 // Looks for calls to a function like `__remill_function_return`, and
@@ -298,9 +589,9 @@ int main(int argc, char *argv[]) {
   google::InitGoogleLogging(argv[0]);
 
 
-  if (FLAGS_bytes.empty()) {
-    std::cerr << "Please specify a sequence of hex bytes to -bytes."
-              << std::endl;
+  if (FLAGS_bytes.empty() == FLAGS_binary.empty()) {
+    std::cerr << "Please specify either a sequence of hex bytes to -bytes, "
+              << "or a file to -binary." << std::endl;
     return EXIT_FAILURE;
   } else if (FLAGS_bytes.size() % 2) {
     std::cerr << "Please specify an even number of nibbles to -bytes."
@@ -308,6 +599,19 @@ int main(int argc, char *argv[]) {
     return EXIT_FAILURE;
   }
 
+  if (FLAGS_address == (uint64_t) -1) {
+    FLAGS_address = 0;
+  }
+
+  // Map in the binary first, as it may tell us the architecture and the
+  // entrypoint.
+  Memory memory;
+  std::set<uint64_t> entrypoints;
+  bool is_elf = false;
+  if (!FLAGS_binary.empty()) {
+    is_elf = LoadInputBinary(memory, entrypoints);
+  }
+
   if (FLAGS_arch.empty()) {
     std::cerr
         << "No architecture specified. Valid architectures: x86, amd64 (with or without "
@@ -316,10 +620,6 @@ int main(int argc, char *argv[]) {
     return EXIT_FAILURE;
   }
 
-  if (FLAGS_address == (uint64_t) -1) {
-    FLAGS_address = 0;
-  }
-
   if (FLAGS_entry_address == (uint64_t) -1) {
     FLAGS_entry_address = FLAGS_address;
   }
@@ -345,13 +645,25 @@ int main(int argc, char *argv[]) {
     return EXIT_FAILURE;
   }
 
-  std::unique_ptr<llvm::Module> module(remill::LoadArchSemantics(arch.get()));
+  if (!memory.FitsInAddressSpace(addr_mask)) {
+    std::cerr << "The code in -binary does not fit into the "
+              << arch->address_size << "-bit address space of -arch "
+              << FLAGS_arch << "." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::unique_ptr<llvm::Module> module(
+      FLAGS_lazy_semantics ? remill::LoadArchSemanticsLazily(arch.get())
+                           : remill::LoadArchSemantics(arch.get()));
 
   const auto mem_ptr_type = arch->MemoryPointerType();
 
-  Memory memory = UnhexlifyInputBytes(addr_mask);
+  if (!FLAGS_bytes.empty()) {
+    UnhexlifyInputBytes(memory, addr_mask);
+  }
+
   SimpleTraceManager manager(arch.get(), module.get(), memory,
-                             FLAGS_entry_address);
+                             FLAGS_entry_address, is_elf);
   if (!manager.TryReadExecutableByte(FLAGS_entry_address, nullptr)) {
     std::cerr << "No executable code at address 0x" << std::hex
               << FLAGS_entry_address << std::endl;
@@ -362,11 +674,75 @@ int main(int argc, char *argv[]) {
 
   auto inst_lifter = arch->DefaultLifter(intrinsics);
 
-  remill::TraceLifter trace_lifter(arch.get(), manager);
+  // Settings that the cached traces are keyed on, so that runs using different
+  // optimization settings never share cached traces.
+  std::stringstream cache_options;
+  cache_options << "opt_level=" << FLAGS_opt_level
+                << ",promote_registers=" << FLAGS_promote_registers
+                << ",eliminate_dead_flags=" << FLAGS_eliminate_dead_flags
+                << ",coalesce_memory=" << FLAGS_coalesce_memory
+                << ",lower_memory=" << FLAGS_lower_memory;
+
+  // Configure either kind of trace lifter from the command-line flags.
+  auto configure_lifter = [&cache_options](auto &lifter) -> bool {
+    if (!FLAGS_lift_cache_dir.empty() &&
+        !lifter.EnableCache(FLAGS_lift_cache_dir, cache_options.str())) {
+      std::cerr << "Unable to use lift cache directory "
+                << FLAGS_lift_cache_dir << std::endl;
+      return false;
+    }
+    if (FLAGS_decode_cache_size) {
+      lifter.EnableDecodeCache(FLAGS_decode_cache_size);
+    }
+    lifter.EnableLiftTemplates(FLAGS_lift_templates);
+    return true;
+  };
 
   // Lift all discoverable traces starting from `-entry_address` into
-  // `module`.
-  trace_lifter.Lift(FLAGS_entry_address);
+  // `module`. When lifting an ELF binary, also lift everything reachable
+  // from the functions in its symbol tables.
+  remill::DecodeCacheStats stats;
+  if (FLAGS_lift_threads) {
+    remill::ParallelTraceLifter trace_lifter(arch.get(), manager,
+                                             FLAGS_lift_threads);
+    if (!configure_lifter(trace_lifter)) {
+      return EXIT_FAILURE;
+    }
+
+    std::vector<uint64_t> trace_heads = {FLAGS_entry_address};
+    trace_heads.insert(trace_heads.end(), entrypoints.begin(),
+                       entrypoints.end());
+    trace_lifter.Lift(trace_heads);
+    stats = trace_lifter.GetDecodeCacheStats();
+
+  } else {
+    remill::TraceLifter trace_lifter(arch.get(), manager);
+    if (!configure_lifter(trace_lifter)) {
+      return EXIT_FAILURE;
+    }
+
+    trace_lifter.Lift(FLAGS_entry_address);
+    for (auto entrypoint : entrypoints) {
+      trace_lifter.Lift(entrypoint);
+    }
+    stats = trace_lifter.GetDecodeCacheStats();
+  }
+
+  if (FLAGS_decode_cache_size) {
+    LOG(INFO) << "Decode cache: " << stats.hits << " hits, " << stats.misses
+              << " misses, " << stats.uncacheable << " uncacheable, "
+              << stats.evictions << " evictions (" << std::fixed
+              << std::setprecision(1) << (stats.HitRate() * 100.0)
+              << "% hit rate)";
+  }
+
+  // Read in the semantics used by the lifted code before any of the semantics
+  // functions are modified below.
+  if (!remill::MaterializeUsedFunctions(module.get())) {
+    std::cerr << "Unable to read the semantics used by the lifted code"
+              << std::endl;
+    return EXIT_FAILURE;
+  }
 
   // Remove llvm.compiler.used to not preserve unused semantics
   auto compilerUsed = module->getGlobalVariable("llvm.compiler.used", true);
@@ -436,6 +812,16 @@ int main(int argc, char *argv[]) {
   // Optimize the module, but with a particular focus on only the functions
   // that we actually lifted.
   remill::OptimizationGuide guide = {};
+  guide.level = FLAGS_opt_level;
+  guide.report = FLAGS_opt_report;
+  guide.promote_registers = FLAGS_promote_registers;
+  guide.eliminate_dead_flags = FLAGS_eliminate_dead_flags;
+  guide.coalesce_memory = FLAGS_coalesce_memory;
+  guide.lower_memory = FLAGS_lower_memory;
+  guide.memory_model.base_address = FLAGS_memory_base;
+  guide.memory_model.base_variable = FLAGS_memory_base_variable;
+  guide.memory_model.address_mask = FLAGS_memory_mask;
+  guide.memory_model.misaligned_atomics = FLAGS_memory_misaligned_atomics;
   remill::OptimizeModule(arch, module, manager.traces, guide);
 
   // Create a new module in which we will move all the lifted functions. Prepare
@@ -7,9 +7,14 @@
 namespace remill {
 inline const std::string_view kThumbModeRegName = "TMReg";
 
+// Interned ID of `kThumbModeRegName`, which decoding uses rather than the name
+// so that it doesn't need to intern the name for every instruction.
+inline const ContextRegId kThumbModeRegId =
+    InternContextReg(kThumbModeRegName);
+
 inline const remill::DecodingContext kThumbContext =
-    remill::DecodingContext({{std::string(remill::kThumbModeRegName), 1}});
+    remill::DecodingContext().PutContextReg(kThumbModeRegId, 1);
 inline const remill::DecodingContext kARMContext =
-    remill::DecodingContext({{std::string(remill::kThumbModeRegName), 0}});
+    remill::DecodingContext().PutContextReg(kThumbModeRegId, 0);
 
 }  // namespace remill
\ No newline at end of file
@@ -22,6 +22,8 @@ class AArch64ArchBase : public virtual ArchBase {
 
   std::string_view ProgramCounterRegisterName(void) const override;
 
+  bool IsFlagRegister(const Register *reg) const override;
+
 
   llvm::CallingConv::ID DefaultCallingConv(void) const override;
 
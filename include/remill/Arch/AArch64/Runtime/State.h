@@ -22,6 +22,10 @@
 #include "remill/Arch/Runtime/State.h"
 #include "remill/Arch/Runtime/Types.h"
 
+#ifndef REMILL_AARCH64_LAZY_FLAGS
+#  define REMILL_AARCH64_LAZY_FLAGS 0
+#endif
+
 struct Reg final {
   union {
     alignas(4) uint32_t dword;
@@ -311,6 +315,26 @@ struct alignas(8) SleighFlagState {
 static_assert(24 == sizeof(SleighFlagState),
               "Invalid packing of `struct SleighFlagState`.");
 
+enum LazyNZCVKind : uint8_t {
+  kLazyNZCVNone,  // The `N`, `Z`, `C`, and `V` flags in `SR` are up-to-date.
+  kLazyNZCVAddWithCarry32,
+  kLazyNZCVAddWithCarry64
+};
+
+// Operands of the last flag-setting add-with-carry, e.g. `adds`, `subs`, or
+// `ccmp`. This is only part of `State` when the semantics are built with
+// `REMILL_AARCH64_LAZY_FLAGS`, in which case the flags in `SR` are stale
+// until they are read, or until a hyper call.
+struct alignas(8) LazyNZCV final {
+  uint64_t lhs;
+  uint64_t rhs;
+  uint8_t kind;  // One of `LazyNZCVKind`.
+  uint8_t carry;
+  uint8_t _padding[6];
+} __attribute__((packed));
+
+static_assert(24 == sizeof(LazyNZCV), "Invalid packing of `struct LazyNZCV`.");
+
 struct alignas(16) AArch64State : public ArchState {
   SIMD simd;  // 512 bytes.
 
@@ -332,12 +356,21 @@ struct alignas(16) AArch64State : public ArchState {
 
   SleighFlagState sleigh_flags;
 
+#if REMILL_AARCH64_LAZY_FLAGS
+  LazyNZCV lazy_nzcv;  // 24 bytes.
+#else
   uint8_t padding[8];
+#endif
 
 } __attribute__((packed));
 
+#if REMILL_AARCH64_LAZY_FLAGS
+static_assert((1152 + 16 + 24 + 24) == sizeof(AArch64State),
+              "Invalid packing of `struct State`");
+#else
 static_assert((1152 + 16 + 24 + 8) == sizeof(AArch64State),
               "Invalid packing of `struct State`");
+#endif
 
 struct State : public AArch64State {};
 
@@ -120,6 +120,10 @@ struct Register {
   uint64_t offset;  // Byte offset in `State`.
   uint64_t size;  // Size of this register (in bytes).
 
+  // Dense number of this register, in the order in which the registers of
+  // `arch` were added. This can index flat per-register tables.
+  unsigned index{0};
+
   // LLVM type associated with the field in `State`.
   llvm::Type *type;
 
@@ -226,6 +230,10 @@ class Arch {
   // Return information about a register, given its name.
   virtual const Register *RegisterByName(std::string_view name) const = 0;
 
+  // Returns `true` if `reg` holds a single condition or status flag, e.g.
+  // `ZF` on x86, or `N` on AArch64.
+  virtual bool IsFlagRegister(const Register *reg) const;
+
   // Returns the name of the stack pointer register.
   virtual std::string_view StackPointerRegisterName(void) const = 0;
 
@@ -306,6 +314,37 @@ class Arch {
                                    std::move(context));
   }
 
+  // Decode the instructions laid out back-to-back in `instr_bytes`, starting
+  // at `address`, as in a linear sweep of a code section. `insts` is resized
+  // to hold one instruction per decoding attempt, in address order, and its
+  // existing instructions are `Reset` and reused. Bytes that don't decode
+  // produce an instruction whose `category` is `kCategoryInvalid`, whose
+  // `bytes` are the `MinInstructionAlign` bytes at its `pc`, and after which
+  // the sweep resumes. The sweep ends once fewer than `MinInstructionSize`
+  // bytes remain. Returns the number of instructions that decoded.
+  //
+  // The default decodes one instruction at a time with the same `context`, and
+  // never fuses idioms. Fixed-width architectures can override it.
+  virtual size_t DecodeInstructions(uint64_t address,
+                                    std::string_view instr_bytes,
+                                    std::vector<Instruction> &insts,
+                                    const DecodingContext &context) const;
+
+  // Returns `true` if decoding the same bytes, in the same context, at two
+  // different addresses produces the same instruction, save for its `pc`,
+  // `next_pc`, `delayed_pc`, `branch_taken_pc`, and `branch_not_taken_pc`,
+  // and the targets of its direct flows. That is, any PC-relative operands
+  // are expressed in terms of the `PC` or `NEXT_PC` registers. Only then can
+  // a `DecodeCache` reuse decoded instructions at other addresses.
+  virtual bool DecodingIsPositionIndependent(void) const;
+
+  // Maximum number of bytes past the end of a decoded instruction that the
+  // decoder may look at, e.g. to look for a fusable idiom. The decoding of an
+  // instruction depends only on its own bytes and on these. By default, this
+  // is as many bytes as the largest fused idiom could have past its first
+  // instruction.
+  virtual uint64_t MaxDecodeLookahead(const DecodingContext &context) const;
+
   // Minimum alignment of an instruction for this particular architecture.
   virtual uint64_t
   MinInstructionAlign(const DecodingContext &context) const = 0;
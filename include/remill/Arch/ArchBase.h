@@ -20,6 +20,8 @@
 #include <remill/Arch/Context.h>
 
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
@@ -123,6 +125,12 @@ class DefaultContextAndLifter : virtual public remill::ArchBase {
                                  Instruction &inst,
                                  DecodingContext context) const override;
 
+  size_t DecodeInstructions(uint64_t address, std::string_view instr_bytes,
+                            std::vector<Instruction> &insts,
+                            const DecodingContext &context) const override;
+
+  bool DecodingIsPositionIndependent(void) const override;
+
 
   OperandLifter::OpLifterPtr
   DefaultLifter(const remill::IntrinsicTable &intrinsics) const override;
@@ -135,6 +143,34 @@ class DefaultContextAndLifter : virtual public remill::ArchBase {
   virtual bool ArchDecodeInstruction(uint64_t address,
                                      std::string_view instr_bytes,
                                      Instruction &inst) const = 0;
+
+  // Decode the `num_insts` back-to-back fixed-width instructions in
+  // `instr_bytes` into the reset instructions `insts`. Instructions that
+  // fail to decode must be left with the category `kCategoryInvalid`. This
+  // is only used when `MinInstructionSize`, `MaxInstructionSize` (without
+  // idiom fusion), and `MinInstructionAlign` all agree, and `address` is
+  // aligned.
+  virtual void ArchDecodeInstructions(uint64_t address,
+                                      std::string_view instr_bytes,
+                                      Instruction *insts,
+                                      size_t num_insts) const;
+
+ private:
+  // Returns the lifter shared by all instructions decoded on the calling
+  // thread, creating it on the thread's first decode.
+  InstructionLifter::LifterPtr GetThreadLifter(void) const;
+
+  // Identifies this architecture to the per-thread caches of lifters. Unlike
+  // `this`, an ID is never reused by another architecture.
+  const uint64_t lifters_id;
+
+  // Lifters shared by the instructions decoded on each thread. A lifter caches
+  // its semantics function lookups and loaded registers without any locking,
+  // so each thread that decodes gets its own. They are created lazily because
+  // the semantics module may not yet be loaded when this is constructed.
+  mutable std::mutex lifters_lock;
+  mutable std::unordered_map<std::thread::id, InstructionLifter::LifterPtr>
+      lifters;
 };
 
 
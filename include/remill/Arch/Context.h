@@ -22,13 +22,24 @@
 
 #include <functional>
 #include <map>
-#include <string_view>
 #include <string>
+#include <string_view>
+#include <type_traits>
 
 namespace remill {
 
 using ContextValues = std::map<std::string, uint64_t>;
 
+/// Small integer that identifies a context register, e.g. ARM's `TMReg`.
+using ContextRegId = uint16_t;
+
+/// Returns the ID of the context register named `creg`. Every use of the same
+/// name gets the same ID. This is thread-safe.
+ContextRegId InternContextReg(std::string_view creg);
+
+/// Returns the name of the context register with ID `id`.
+std::string_view ContextRegName(ContextRegId id);
+
 /// A decoding context is contextual information about the state of the program that affects decoding, ie. the thumb mode register on ARM
 /// We allow clients to interpose on a context for resolution
 
@@ -36,30 +47,67 @@ using ContextValues = std::map<std::string, uint64_t>;
 /// previous context and the successor address that produces a new decoding.
 /// This definition of returned contexts allows us to cleanly handle situations like indirect jumps in arm
 ///
+/// Contexts are small, fixed-size, and trivially copyable, as one is made for
+/// every decoded instruction. Registers are stored by their interned IDs, and
+/// the overloads taking register names intern them first.
 class DecodingContext {
+ public:
+  // Maximum number of context registers with values in a context.
+  static constexpr unsigned kMaxNumContextRegs = 8u;
 
  private:
-  ContextValues context_value;
+  // Values of the context registers, sorted by register ID. Unused entries
+  // are zeroed, so that contexts can be compared entry-by-entry.
+  uint64_t reg_values[kMaxNumContextRegs]{};
+  ContextRegId reg_ids[kMaxNumContextRegs]{};
+  uint16_t num_regs{0};
+
+  // Returns the index of `creg` in `reg_ids`, or the index where it would go.
+  unsigned Find(ContextRegId creg) const;
 
  public:
   bool operator==(const DecodingContext &rhs) const;
 
   DecodingContext() = default;
 
-  DecodingContext(ContextValues context_value);
+  DecodingContext(const ContextValues &context_value);
+
 
+  void UpdateContextReg(ContextRegId creg, uint64_t value);
+  void UpdateContextReg(std::string_view creg, uint64_t value);
+  void DropReg(ContextRegId creg);
+  void DropReg(std::string_view creg);
 
-  void UpdateContextReg(std::string creg, uint64_t value);
-  void DropReg(const std::string &creg);
+  bool HasValueForReg(ContextRegId creg) const;
+  bool HasValueForReg(std::string_view creg) const;
 
-  bool HasValueForReg(const std::string &creg) const;
 
+  uint64_t GetContextValue(ContextRegId context_reg) const;
+  uint64_t GetContextValue(std::string_view context_reg) const;
+  DecodingContext PutContextReg(ContextRegId creg, uint64_t value) const;
+  DecodingContext PutContextReg(std::string_view creg, uint64_t value) const;
+  DecodingContext ContextWithoutRegister(ContextRegId creg) const;
+  DecodingContext ContextWithoutRegister(std::string_view creg) const;
 
-  uint64_t GetContextValue(const std::string &context_reg) const;
-  DecodingContext PutContextReg(std::string creg, uint64_t value) const;
-  DecodingContext ContextWithoutRegister(const std::string &creg) const;
+  // Number of context registers with values.
+  inline unsigned NumContextRegs(void) const {
+    return num_regs;
+  }
 
-  const ContextValues &GetContextValues() const;
+  // Call `cb(id, value)` for each context register with a value, in order of
+  // register ID.
+  template <typename CB>
+  inline void ForEachContextReg(CB cb) const {
+    for (auto i = 0u; i < num_regs; ++i) {
+      cb(reg_ids[i], reg_values[i]);
+    }
+  }
+
+  // Returns the values of the context registers keyed by their names.
+  ContextValues GetContextValues() const;
 };
 
+static_assert(std::is_trivially_copyable_v<DecodingContext>,
+              "Decoding contexts are copied for every decoded instruction");
+
 }  // namespace remill
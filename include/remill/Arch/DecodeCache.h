@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <remill/Arch/Context.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+namespace remill {
+
+class Arch;
+class Instruction;
+
+// Counters of how a `DecodeCache` was used.
+struct DecodeCacheStats {
+
+  // Decodes that were answered from the cache.
+  uint64_t hits{0};
+
+  // Decodes that went to the architecture, and whose result was cached.
+  uint64_t misses{0};
+
+  // Decodes that went to the architecture, and whose result can't be cached,
+  // e.g. because the architecture's decoding isn't position independent.
+  uint64_t uncacheable{0};
+
+  // Cached instructions that were dropped to make room for newer ones.
+  uint64_t evictions{0};
+
+  // Fraction of all decodes that were answered from the cache.
+  double HitRate(void) const;
+
+  DecodeCacheStats &operator+=(const DecodeCacheStats &that);
+};
+
+// A least-recently-used cache of decoded instructions, which sits in front of
+// `Arch::DecodeInstruction`. Instructions are cached by their bytes and the
+// `Arch::MaxDecodeLookahead` bytes after them, the decoding context, and the
+// alignment of their address, and so any bytes given to the decoder that
+// start with those bytes hit the same entry. A cached instruction can be
+// reused at any other address by adjusting its `pc`, `next_pc`, `delayed_pc`,
+// `branch_taken_pc`, `branch_not_taken_pc`, and direct flow targets, and so
+// the cache only serves architectures whose `DecodingIsPositionIndependent`.
+//
+// NOTE: Failed decodes, and decodes given too few bytes to look past the
+//       instruction, are cached by all of the bytes given to the decoder.
+//
+// Not thread-safe. A `DecodeCache` belongs to one `Arch`, and the instructions
+// that it returns refer to that `Arch`.
+class DecodeCache {
+ public:
+  ~DecodeCache(void);
+
+  // Cache up to `max_entries` decoded instructions.
+  DecodeCache(const Arch *arch_, size_t max_entries_ = kDefaultMaxEntries);
+
+  static constexpr size_t kDefaultMaxEntries = 1u << 16;
+
+  // Decode an instruction, as with `Arch::DecodeInstruction`, reusing a cached
+  // decoding if there is one.
+  bool DecodeInstruction(uint64_t address, std::string_view instr_bytes,
+                         Instruction &inst, DecodingContext context);
+
+  // Decode an instruction that is within a delay slot, as with
+  // `Arch::DecodeDelayedInstruction`.
+  bool DecodeDelayedInstruction(uint64_t address, std::string_view instr_bytes,
+                                Instruction &inst, DecodingContext context);
+
+  // Counters of how the cache has been used so far.
+  const DecodeCacheStats &Stats(void) const;
+
+  // Drop all cached instructions. This doesn't reset the counters.
+  void Clear(void);
+
+ private:
+  DecodeCache(void) = delete;
+
+  class Impl;
+
+  std::unique_ptr<Impl> impl;
+};
+
+}  // namespace remill
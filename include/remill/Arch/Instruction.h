@@ -16,9 +16,11 @@
 
 #pragma once
 
+#include <llvm/ADT/SmallVector.h>
 #include <remill/Arch/Context.h>
 #include <remill/BC/InstructionLifter.h>
 
+#include <memory>
 #include <optional>
 #include <string>
 #include <variant>
@@ -75,6 +77,9 @@ class Operand {
   uint64_t size;
 
   // kTypeRegister.
+  //
+  // Register names aren't interned. `Arch::DecodeInstruction` resolves each
+  // name into `resolved` once, and the lifters use that when it's set.
   class Register {
    public:
     Register(void);
@@ -82,6 +87,10 @@ class Operand {
 
     std::string name;
     uint64_t size;  // In bits.
+
+    // The architectural register named by `name`, or `nullptr` if `name` is
+    // empty or doesn't name an architectural register.
+    const ::remill::Register *resolved;
   } reg;
 
   class ShiftRegister {
@@ -177,16 +186,36 @@ class Condition {
 };
 
 // Generic instruction type.
+//
+// NOTE: Instructions are reused via `Reset`, so most of what they hold is kept
+//       inline, and the table of operand expressions is only allocated by
+//       decoders that use it.
 class Instruction {
  public:
-  ~Instruction(void) = default;
+  ~Instruction(void);
   Instruction(void);
 
+  // Copies have their own operand expressions, and so their operands refer
+  // to their own expressions rather than to those of `that`.
+  Instruction(const Instruction &that);
+  Instruction &operator=(const Instruction &that);
+
+  Instruction(Instruction &&) = default;
+  Instruction &operator=(Instruction &&) = default;
+
   void Reset(void);
 
   // Name of semantics function that implements this instruction.
   std::string function;
 
+  // Decoder-specific numeric identifier of the instruction form (e.g. the
+  // XED iform, or `aarch64::InstForm`), or `kUnknownForm`. The lifter uses
+  // this to index its table of semantics functions, and so only compares
+  // `function` against the few names seen for that form. Decoders that don't
+  // have a dense numeric form leave this as `kUnknownForm`.
+  static constexpr uint32_t kUnknownForm = ~0u;
+  uint32_t form;
+
   // The decoded bytes of the instruction.
   std::string bytes;
 
@@ -222,7 +251,9 @@ class Instruction {
   const Arch *arch;
 
   // Does the instruction require the use of the `__remill_atomic_begin` and
-  // `__remill_atomic_end`?
+  // `__remill_atomic_end`? This isn't set for instructions whose semantics
+  // are atomic on their own, e.g. because they use the
+  // `__remill_fetch_and_*` or `__remill_compare_exchange_memory_*` intrinsics.
   bool is_atomic_read_modify_write;
 
   // Does this instruction have a delay slot.
@@ -396,7 +427,11 @@ class Instruction {
 
   InstructionFlowCategory flows;
 
-  std::vector<Operand> operands;
+  // Number of operands that are stored inline, i.e. without allocating
+  // memory. Very few instructions have more operands than this.
+  static constexpr unsigned kNumInlineOperands = 4u;
+
+  llvm::SmallVector<Operand, kNumInlineOperands> operands;
 
   std::string Serialize(void) const;
 
@@ -500,8 +535,11 @@ class Instruction {
 
  private:
   InstructionLifter::LifterPtr lifter;
+
+  // Operand expressions, which are allocated on first use, and are then
+  // reused by later decodes into this instruction.
   static constexpr auto kMaxNumExpr = 64u;
-  OperandExpression exprs[kMaxNumExpr];
+  std::unique_ptr<OperandExpression[]> exprs;
   unsigned next_expr_index{0};
 };
 
@@ -63,6 +63,35 @@ __remill_write_memory_f80(Memory *, addr_t, const float80_t &);
 [[gnu::used]] extern Memory *__remill_write_memory_f128(Memory *, addr_t,
                                                         float128_t);
 
+// Whole vector memory intrinsics. Like the `float80_t` intrinsics, these pass
+// the vector by reference so that every target sees the same signature.
+[[gnu::used]] extern Memory *__remill_read_memory_v128(Memory *, addr_t,
+                                                       vec128_t &);
+
+[[gnu::used]] extern Memory *__remill_read_memory_v256(Memory *, addr_t,
+                                                       vec256_t &);
+
+[[gnu::used]] extern Memory *__remill_read_memory_v512(Memory *, addr_t,
+                                                       vec512_t &);
+
+[[gnu::used]] extern Memory *__remill_write_memory_v128(Memory *, addr_t,
+                                                        const vec128_t &);
+
+[[gnu::used]] extern Memory *__remill_write_memory_v256(Memory *, addr_t,
+                                                        const vec256_t &);
+
+[[gnu::used]] extern Memory *__remill_write_memory_v512(Memory *, addr_t,
+                                                        const vec512_t &);
+
+// Bulk memory intrinsics. `__remill_memcpy` copies `size` bytes from `src` to
+// `dst`, as if through a temporary buffer, so the two ranges may overlap.
+// `__remill_memset` fills `size` bytes at `dst` with `val`.
+[[gnu::used]] extern Memory *__remill_memcpy(Memory *, addr_t dst, addr_t src,
+                                             addr_t size);
+
+[[gnu::used]] extern Memory *__remill_memset(Memory *, addr_t dst,
+                                             uint8_t val, addr_t size);
+
 [[gnu::used]] extern uint8_t __remill_undefined_8(void);
 
 [[gnu::used]] extern uint16_t __remill_undefined_16(void);
@@ -163,6 +192,11 @@ __remill_barrier_store_store(Memory *);  // Store release.
 
 [[gnu::used]] extern Memory *__remill_delay_slot_end(Memory *);
 
+// Atomic read-modify-write operations. These are sequentially consistent, and
+// are used without the atomic begin/end intrinsics, so a runtime should
+// implement each with a single host atomic instruction when `addr` is
+// naturally aligned. The old value in memory is returned through `expected`
+// or `value`.
 [[gnu::used]] extern Memory *
 __remill_compare_exchange_memory_8(Memory *, addr_t addr, uint8_t &expected,
                                    uint8_t desired);
@@ -20,6 +20,7 @@ struct Memory;
 struct State;
 
 #include <limits>
+#include <type_traits>
 
 #include "Float.h"
 
@@ -298,30 +299,74 @@ MAKE_READV(F, 80, tdouble)
 
 #undef MAKE_READV
 
+// Vectors that can be read or written whole by one memory intrinsic call,
+// rather than by one call per element.
+template <typename T>
+struct HasVectorMemoryIntrinsic : public std::false_type {};
+
+template <>
+struct HasVectorMemoryIntrinsic<vec128_t> : public std::true_type {};
+
+template <>
+struct HasVectorMemoryIntrinsic<vec256_t> : public std::true_type {};
+
+template <>
+struct HasVectorMemoryIntrinsic<vec512_t> : public std::true_type {};
+
+#define MAKE_VECTOR_MEMORY_ACCESS(size) \
+  ALWAYS_INLINE static Memory *_ReadVectorMemory(Memory *memory, addr_t addr, \
+                                                 vec##size##_t &vec) { \
+    return __remill_read_memory_v##size(memory, addr, vec); \
+  } \
+\
+  ALWAYS_INLINE static Memory *_WriteVectorMemory( \
+      Memory *memory, addr_t addr, const vec##size##_t &vec) { \
+    return __remill_write_memory_v##size(memory, addr, vec); \
+  }
+
+MAKE_VECTOR_MEMORY_ACCESS(128)
+MAKE_VECTOR_MEMORY_ACCESS(256)
+MAKE_VECTOR_MEMORY_ACCESS(512)
+
+#undef MAKE_VECTOR_MEMORY_ACCESS
+
+// Reads of whole vectors don't produce a new memory pointer either.
 #define MAKE_MREADV(prefix, size, vec_accessor, mem_accessor) \
   template <typename T> \
   ALWAYS_INLINE static auto _##prefix##ReadV##size(Memory *memory, MVn<T> mem) \
       ->decltype(T().vec_accessor) { \
-    decltype(T().vec_accessor) vec = {}; \
-    const addr_t el_size = sizeof(vec.elems[0]); \
-    _Pragma("unroll") for (addr_t i = 0; i < NumVectorElems(vec); ++i) { \
-      vec.elems[i] = __remill_read_memory_##mem_accessor( \
-          memory, mem.addr + (i * el_size)); \
+    if constexpr (HasVectorMemoryIntrinsic<T>::value) { \
+      T vec; \
+      (void) _ReadVectorMemory(memory, mem.addr, vec); \
+      return vec.vec_accessor; \
+    } else { \
+      decltype(T().vec_accessor) vec = {}; \
+      const addr_t el_size = sizeof(vec.elems[0]); \
+      _Pragma("unroll") for (addr_t i = 0; i < NumVectorElems(vec); ++i) { \
+        vec.elems[i] = __remill_read_memory_##mem_accessor( \
+            memory, mem.addr + (i * el_size)); \
+      } \
+      return vec; \
     } \
-    return vec; \
   } \
 \
   template <typename T> \
   ALWAYS_INLINE static auto _##prefix##ReadV##size(Memory *memory, \
                                                    MVnW<T> mem) \
       ->decltype(T().vec_accessor) { \
-    decltype(T().vec_accessor) vec = {}; \
-    const addr_t el_size = sizeof(vec.elems[0]); \
-    _Pragma("unroll") for (addr_t i = 0; i < NumVectorElems(vec); ++i) { \
-      vec.elems[i] = __remill_read_memory_##mem_accessor( \
-          memory, mem.addr + (i * el_size)); \
+    if constexpr (HasVectorMemoryIntrinsic<T>::value) { \
+      T vec; \
+      (void) _ReadVectorMemory(memory, mem.addr, vec); \
+      return vec.vec_accessor; \
+    } else { \
+      decltype(T().vec_accessor) vec = {}; \
+      const addr_t el_size = sizeof(vec.elems[0]); \
+      _Pragma("unroll") for (addr_t i = 0; i < NumVectorElems(vec); ++i) { \
+        vec.elems[i] = __remill_read_memory_##mem_accessor( \
+            memory, mem.addr + (i * el_size)); \
+      } \
+      return vec; \
     } \
-    return vec; \
   }
 
 MAKE_MREADV(U, 8, bytes, 8)
@@ -422,14 +467,18 @@ MAKE_WRITEV(F, 80, tdoubles, RVnW, float80_t)
   ALWAYS_INLINE static Memory *_##prefix##WriteV##size( \
       Memory *memory, MVnW<T> mem, base_type val) { \
     T vec{}; \
-    const addr_t el_size = sizeof(base_type); \
     vec.vec_accessor.elems[0] = val; \
-    _Pragma("unroll") for (addr_t i = 0; i < NumVectorElems(vec.vec_accessor); \
-                           ++i) { \
-      memory = __remill_write_memory_##mem_accessor( \
-          memory, mem.addr + (i * el_size), vec.vec_accessor.elems[i]); \
+    if constexpr (HasVectorMemoryIntrinsic<T>::value) { \
+      return _WriteVectorMemory(memory, mem.addr, vec); \
+    } else { \
+      const addr_t el_size = sizeof(base_type); \
+      _Pragma("unroll") for (addr_t i = 0; \
+                             i < NumVectorElems(vec.vec_accessor); ++i) { \
+        memory = __remill_write_memory_##mem_accessor( \
+            memory, mem.addr + (i * el_size), vec.vec_accessor.elems[i]); \
+      } \
+      return memory; \
     } \
-    return memory; \
   } \
 \
   template <typename T, typename V> \
@@ -440,12 +489,18 @@ MAKE_WRITEV(F, 80, tdoubles, RVnW, float80_t)
     typedef decltype(V()) VT; \
     static_assert(std::is_same<BT, VT>::value, \
                   "Incompatible types to a write to a vector register"); \
-    const addr_t el_size = sizeof(base_type); \
-    _Pragma("unroll") for (addr_t i = 0; i < NumVectorElems(val); ++i) { \
-      memory = __remill_write_memory_##mem_accessor( \
-          memory, mem.addr + (i * el_size), val.elems[i]); \
+    if constexpr (HasVectorMemoryIntrinsic<T>::value) { \
+      T vec; \
+      vec.vec_accessor = val; \
+      return _WriteVectorMemory(memory, mem.addr, vec); \
+    } else { \
+      const addr_t el_size = sizeof(base_type); \
+      _Pragma("unroll") for (addr_t i = 0; i < NumVectorElems(val); ++i) { \
+        memory = __remill_write_memory_##mem_accessor( \
+            memory, mem.addr + (i * el_size), val.elems[i]); \
+      } \
+      return memory; \
     } \
-    return memory; \
   }
 
 MAKE_MWRITEV(U, 8, bytes, 8, uint8_t)
@@ -45,6 +45,10 @@
 #  define HAS_FEATURE_AVX512 1
 #endif
 
+#ifndef REMILL_X86_LAZY_FLAGS
+#  define REMILL_X86_LAZY_FLAGS 0
+#endif
+
 #if HAS_FEATURE_AVX
 #  define IF_AVX(...) __VA_ARGS__
 #  define IF_AVX_ELSE(a, b) a
@@ -445,6 +449,34 @@ struct alignas(8) ArithFlags final {
 
 static_assert(16 == sizeof(ArithFlags), "Invalid packing of `ArithFlags`.");
 
+enum LazyArithFlagsKind : uint8_t {
+  kLazyArithFlagsNone,  // The flags in `ArithFlags` are up-to-date.
+  kLazyArithFlagsAdd8,
+  kLazyArithFlagsAdd16,
+  kLazyArithFlagsAdd32,
+  kLazyArithFlagsAdd64,
+  kLazyArithFlagsSub8,
+  kLazyArithFlagsSub16,
+  kLazyArithFlagsSub32,
+  kLazyArithFlagsSub64
+};
+
+// Operands and result of the last `add`- or `sub`-like instruction, e.g.
+// `add`, `sub`, `cmp`, `neg`, or `cmpxchg`. This is only part of `State` when
+// the semantics are built with `REMILL_X86_LAZY_FLAGS`, in which case the
+// arithmetic flags in `ArithFlags` are stale until they are read, or until a
+// hyper call.
+struct alignas(8) LazyArithFlags final {
+  uint64_t lhs;
+  uint64_t rhs;
+  uint64_t res;
+  uint8_t kind;  // One of `LazyArithFlagsKind`.
+  uint8_t _padding[7];
+} __attribute__((packed));
+
+static_assert(32 == sizeof(LazyArithFlags),
+              "Invalid packing of `LazyArithFlags`.");
+
 union XCR0 {
   uint64_t flat;
 
@@ -798,10 +830,18 @@ struct alignas(16) X86State : public ArchState {
   FPU x87;  // 512 bytes
   SegmentCaches seg_caches;  // 96 bytes
   K_REG k_reg; // 128 bytes.
+#if REMILL_X86_LAZY_FLAGS
+  LazyArithFlags lazy_aflag;  // 32 bytes.
+#endif
 } __attribute__((packed));
 
+#if REMILL_X86_LAZY_FLAGS
+static_assert((96 + 3264 + 16 + 128 + 32) == sizeof(X86State),
+              "Invalid packing of `struct State`");
+#else
 static_assert((96 + 3264 + 16 + 128) == sizeof(X86State),
               "Invalid packing of `struct State`");
+#endif
 
 struct State : public X86State {};
 
@@ -22,6 +22,8 @@ class X86ArchBase : public virtual ArchBase {
 
   std::string_view ProgramCounterRegisterName(void) const override;
 
+  bool IsFlagRegister(const Register *reg) const override;
+
   uint64_t MinInstructionAlign(const DecodingContext &context) const override;
 
 
@@ -20,6 +20,7 @@
 #include <memory>
 #include <string_view>
 #include <string>
+#include <vector>
 
 namespace llvm {
 class Argument;
@@ -27,6 +28,7 @@ class ConstantInt;
 class Function;
 class Module;
 class GlobalVariable;
+class Instruction;
 class LLVMContext;
 class IntegerType;
 class BasicBlock;
@@ -42,6 +44,7 @@ class IntrinsicTable;
 class Operand;
 class OperandExpression;
 class TraceLifter;
+struct Register;
 
 enum LiftStatus {
   kLiftedInvalidInstruction,
@@ -120,9 +123,29 @@ class InstructionLifter : public InstructionLifterIntf {
   llvm::Value *LoadRegValue(llvm::BasicBlock *block, llvm::Value *state_ptr,
                             std::string_view reg_name) const override final;
 
+  // Load the address of a register of the lifter's architecture. Unlike
+  // loading it by name, this doesn't need to hash the name of the register.
+  std::pair<llvm::Value *, llvm::Type *>
+  LoadRegAddress(llvm::BasicBlock *block, llvm::Value *state_ptr,
+                 const Register *reg) const;
+
+  // Load the value of a register of the lifter's architecture.
+  llvm::Value *LoadRegValue(llvm::BasicBlock *block, llvm::Value *state_ptr,
+                            const Register *reg) const;
+
   // Clear out the cache of the current register values/addresses loaded.
   void ClearCache(void) const override;
 
+  // Reuse the IR that lifts the operands of an instruction for all later
+  // instructions that call the same semantics function with the same kinds of
+  // register and immediate operands, e.g. every `ADD_64_ADDSUB_IMM`. Only the
+  // register addresses and immediate values are changed between uses.
+  //
+  // NOTE: Subclasses that override how register or immediate operands are
+  //       lifted must produce the same IR for the same register types and
+  //       immediate sizes.
+  void EnableLiftTemplates(bool enable = true);
+
 
   virtual llvm::Type *GetMemoryType() override final;
 
@@ -187,6 +210,22 @@ class InstructionLifter : public InstructionLifterIntf {
   InstructionLifter(void) = delete;
 
   class Impl;
+  struct LiftTemplate;
+  struct LiftTemplateKey;
+
+  // Lift the operands of `inst` into `args` by instantiating `tpl`. Returns
+  // `false`, before copying any IR into `block`, if `tpl` doesn't fit `inst`.
+  bool InstantiateLiftTemplate(const LiftTemplate &tpl, Instruction &inst,
+                               llvm::BasicBlock *block, llvm::Value *state_ptr,
+                               llvm::Function *isel_func,
+                               std::vector<llvm::Value *> &args);
+
+  // Record the IR after `last_inst` in `block`, which lifted the operands of
+  // `inst` into `args`, as `tpl`.
+  void CaptureLiftTemplate(LiftTemplate &tpl, Instruction &inst,
+                           llvm::BasicBlock *block, llvm::Value *state_ptr,
+                           llvm::Instruction *last_inst,
+                           const std::vector<llvm::Value *> &args);
 
   const std::unique_ptr<Impl> impl;
 };
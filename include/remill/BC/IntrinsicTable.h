@@ -67,6 +67,19 @@ class IntrinsicTable {
   llvm::Function *const write_memory_f80;
   llvm::Function *const write_memory_f128;
 
+  // Whole vector memory intrinsics. The vector is passed by pointer.
+  llvm::Function *const read_memory_v128;
+  llvm::Function *const read_memory_v256;
+  llvm::Function *const read_memory_v512;
+
+  llvm::Function *const write_memory_v128;
+  llvm::Function *const write_memory_v256;
+  llvm::Function *const write_memory_v512;
+
+  // Bulk memory intrinsics.
+  llvm::Function *const memory_copy;
+  llvm::Function *const memory_set;
+
   // Memory barriers.
   llvm::Function *const barrier_load_load;
   llvm::Function *const barrier_load_store;
@@ -25,11 +25,13 @@
 #include <llvm/IR/Module.h>
 #pragma clang diagnostic pop
 
+#include <cstdint>
 #include <functional>
 #include <initializer_list>
 #include <map>
 #include <memory>
 #include <set>
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -41,13 +43,124 @@ namespace remill {
 
 class Arch;
 
+// Where `LowerMemoryIntrinsics` finds guest memory in the host's address
+// space. Guest address `addr` is at host address `base + (addr & mask)`.
+struct DirectMemoryModel {
+
+  // Host address of guest address zero. This is ignored if `base_variable`
+  // is non-empty.
+  uint64_t base_address{0};
+
+  // Name of a global pointer variable that holds the host address of guest
+  // address zero, e.g. one that a runtime sets after mapping guest memory.
+  // The variable is declared if it doesn't already exist.
+  std::string base_variable;
+
+  // If non-zero, guest addresses are masked with this before being added to
+  // the base. With a mask that is one less than a power of two, every access
+  // starts within `[base, base + mask]`.
+  //
+  // NOTE: Only the first byte of an access is masked, so the sandbox needs a
+  //       64-byte guard region after `base + mask`. Bulk copies and fills
+  //       aren't lowered when there is a mask.
+  uint64_t address_mask{0};
+
+  // Whether or not guest atomics may be misaligned, e.g. an x86 `LOCK`
+  // prefixed instruction on an unaligned address. By default, the atomics
+  // are assumed to be naturally aligned, and are lowered to host atomic
+  // instructions. Otherwise, LLVM turns each one into a call to a libatomic
+  // function, which takes a lock from a global table, and so is much slower.
+  bool misaligned_atomics{false};
+};
+
 struct OptimizationGuide {
   bool slp_vectorize;
   bool loop_vectorize;
   bool verify_input;
   bool verify_output;
+
+  // Optimization level, from `0` to `3`, in the style of `-O<level>`. At
+  // level `0`, calls to semantics functions are inlined, but the code is
+  // otherwise left as-is.
+  unsigned level{0};
+
+  // Log the number of instructions in the optimized functions before and
+  // after optimization, along with how long the optimization took.
+  bool report{false};
+
+  // Keep the guest registers accessed by each lifted trace in SSA form for the
+  // duration of the trace. See `PromoteStateRegisters`. This only applies
+  // when `level` is non-zero, and is off by default.
+  bool promote_registers{false};
+
+  // Remove stores to flag registers that are overwritten before they are
+  // read. See `EliminateDeadFlagStores`. This only applies when `level` is
+  // non-zero, and is off by default.
+  bool eliminate_dead_flags{false};
+
+  // Merge pairs of adjacent guest memory reads or writes in lifted traces into
+  // wider ones. See `CoalesceMemoryAccesses`.
+  bool coalesce_memory{false};
+
+  // Lower the memory intrinsics in lifted traces into direct accesses of host
+  // memory, as described by `memory_model`. See `LowerMemoryIntrinsics`.
+  // This is off by default, because it bakes in how guest memory is mapped.
+  bool lower_memory{false};
+  DirectMemoryModel memory_model;
 };
 
+// Merge pairs of calls to the 8-, 16-, 32-, and 64-bit memory read or write
+// intrinsics in the lifted function `func` into calls to intrinsics of twice
+// the size, when the two calls are in the same block, with no other calls
+// between them, and access adjacent addresses off of the same base value.
+// E.g. two `__remill_read_memory_64`s of `x + 8` and `x + 16` become one
+// `__remill_read_memory_v128` of `x + 8`. A merged access is only made when
+// it doesn't cross a page boundary, and otherwise the original accesses are
+// made, so that faults are unchanged.
+//
+// Returns the number of merged intrinsic calls.
+unsigned CoalesceMemoryAccesses(llvm::Function *func);
+
+// Replace the calls to memory read and write intrinsics (e.g.
+// `__remill_read_memory_32`) and to bulk memory intrinsics (`__remill_memcpy`
+// and `__remill_memset`) in `func` with LLVM loads, stores, and memory
+// intrinsics that access host memory, as described by `model`. Calls to the
+// `__remill_fetch_and_*` and `__remill_compare_exchange_memory_*` intrinsics
+// are replaced with sequentially consistent `atomicrmw` and `cmpxchg`
+// instructions, which are naturally aligned unless `model.misaligned_atomics`
+// is set. The `Memory` pointer passed to a replaced write is used in
+// place of the one that the write would have returned. The barrier and atomic
+// begin/end intrinsics are left alone, as are the bulk memory intrinsics when
+// `model.address_mask` is non-zero, because the mask can't bound the lengths
+// of their accesses.
+//
+// Returns the number of replaced calls.
+unsigned LowerMemoryIntrinsics(llvm::Function *func,
+                               const DirectMemoryModel &model);
+
+// Remove the stores to flag registers (see `Arch::IsFlagRegister`) in the
+// `State` structure that are overwritten within the lifted function `func`
+// before anything can read them, along with the computations of the stored
+// values. Calls and returns are assumed to read every flag. This is meant to
+// be applied after the semantics functions have been inlined into `func`.
+//
+// Returns the number of removed flag stores.
+unsigned EliminateDeadFlagStores(const Arch *arch, llvm::Function *func);
+
+// Promote the guest registers accessed through the `State` structure pointer
+// argument of the lifted function `func` into SSA values. The registers are
+// loaded from `State` on entry, and are only written back to `State` before
+// calls that are passed the `State` pointer (e.g. `__remill_*` intrinsics and
+// tail calls to other traces) and before returns. This is meant to be applied
+// after the semantics functions have been inlined into `func`.
+//
+// Registers accessed in ways that can't be redirected, e.g. by a load that
+// straddles two registers, stay in `State`. Nothing is promoted if the `State`
+// pointer escapes.
+//
+// Returns the number of promoted registers.
+unsigned PromoteStateRegisters(const Arch *arch, llvm::Function *func);
+
 template <typename T>
 inline static void
 OptimizeModule(const std::unique_ptr<const remill::Arch> &arch,
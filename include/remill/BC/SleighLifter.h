@@ -20,7 +20,10 @@
 #include <llvm/IR/IRBuilder.h>
 
 #include <mutex>
+#include <optional>
 #include <sleigh/libsleigh.hh>
+#include <string>
+#include <vector>
 
 #include "remill/Arch/Instruction.h"
 #include "remill/BC/InstructionLifter.h"
@@ -38,6 +41,15 @@ struct BranchTakenVar {
 };
 using MaybeBranchTakenVar = std::optional<BranchTakenVar>;
 
+// A p-code op emitted by SLEIGH when decoding an instruction.
+//
+// The varnodes' address spaces belong to the SLEIGH engine that decoded them.
+struct RemillPcodeOp {
+  OpCode op;
+  std::optional<VarnodeData> outvar;
+  std::vector<VarnodeData> vars;
+};
+
 class SleighDecoder;
 class SingleInstructionSleighContext;
 }  // namespace sleigh
@@ -47,12 +59,12 @@ class SleighLifter : public InstructionLifter {
  private:
   class PcodeToLLVMEmitIntoBlock;
 
-  std::unique_ptr<sleigh::SingleInstructionSleighContext> sleigh_context;
-  // Architecture being used for lifting.
-  // Decoder being used for disassembly
-
+  // Decoder being used for disassembly.
   const sleigh::SleighDecoder &decoder;
 
+  // Names of the user-defined p-code ops of the decoder's engine.
+  const std::vector<std::string> user_op_names;
+
  public:
   static const std::string_view kInstructionFunctionPrefix;
 
@@ -62,11 +74,15 @@ class SleighLifter : public InstructionLifter {
 
   virtual ~SleighLifter(void) = default;
 
+  // Lift `inst`, whose p-code `ops` were produced by `engine` when it was
+  // decoded.
   LiftStatus
   LiftIntoBlockWithSleighState(Instruction &inst, llvm::BasicBlock *block,
                                llvm::Value *state_ptr, bool is_delayed,
                                const sleigh::MaybeBranchTakenVar &btaken,
-                               const ContextValues &context_values);
+                               const DecodingContext &decoding_context,
+                               const std::vector<sleigh::RemillPcodeOp> &ops,
+                               ::Sleigh &engine);
 
  private:
   static void SetISelAttributes(llvm::Function *);
@@ -79,9 +95,8 @@ class SleighLifter : public InstructionLifter {
   LiftIntoInternalBlockWithSleighState(
       Instruction &inst, llvm::Module *target_mod, bool is_delayed,
       const sleigh::MaybeBranchTakenVar &btaken,
-      const ContextValues &context_values);
-
-  ::Sleigh &GetEngine(void) const;
+      const DecodingContext &decoding_context,
+      const std::vector<sleigh::RemillPcodeOp> &ops, ::Sleigh &engine);
 };
 
 
@@ -89,12 +104,20 @@ class SleighLifter : public InstructionLifter {
 class SleighLifterWithState final : public InstructionLifterIntf {
  private:
   sleigh::MaybeBranchTakenVar btaken;
-  ContextValues context_values;
+  DecodingContext decoding_context;
+
+  // The p-code of the decoded instruction, so that it needn't be decoded
+  // again in order to be lifted. The p-code is interpreted using the engine
+  // that produced it, which outlives the instruction.
+  std::vector<sleigh::RemillPcodeOp> ops;
+  ::Sleigh &engine;
   std::shared_ptr<SleighLifter> lifter;
 
  public:
   SleighLifterWithState(sleigh::MaybeBranchTakenVar btaken,
-                        ContextValues context_values,
+                        DecodingContext decoding_context,
+                        std::vector<sleigh::RemillPcodeOp> ops,
+                        ::Sleigh &engine_,
                         std::shared_ptr<SleighLifter> lifter_);
 
   // Lift a single instruction into a basic block. `is_delayed` signifies that
@@ -118,8 +141,8 @@ class SleighLifterWithState final : public InstructionLifterIntf {
 
   virtual void ClearCache(void) const override;
 
-  const ContextValues &GetContextValues() const {
-    return context_values;
+  ContextValues GetContextValues() const {
+    return decoding_context.GetContextValues();
   }
 };
 
@@ -16,10 +16,14 @@
 
 #pragma once
 
+#include <remill/Arch/DecodeCache.h>
 #include <remill/BC/Lifter.h>
 
+#include <filesystem>
 #include <functional>
+#include <string_view>
 #include <unordered_map>
+#include <vector>
 
 namespace remill {
 
@@ -79,6 +83,23 @@ class TraceManager {
   // at address `addr` is executable and readable, and updates the byte
   // pointed to by `byte` with the read value.
   virtual bool TryReadExecutableByte(uint64_t addr, uint8_t *byte) = 0;
+
+  // Try to read up to `size` bytes of executable memory starting at `addr`.
+  // Returns a view of the longest readable and executable prefix of that
+  // range, which may be empty.
+  //
+  // NOTE: The returned view does not own its bytes. It is only guaranteed to
+  //       stay valid until the next call to `TryReadExecutableBytes` on the
+  //       same thread, on any `TraceManager`. Callers that need the bytes for
+  //       longer must copy them. Overrides must keep the view valid for at
+  //       least that long.
+  //
+  // The default implementation calls `TryReadExecutableByte` once per byte
+  // and copies the bytes into a thread-local buffer, which the next call on
+  // the same thread overwrites. Managers that have a contiguous view of
+  // memory, e.g. a mapped binary, should override this to return a view
+  // directly into that memory.
+  virtual std::string_view TryReadExecutableBytes(uint64_t addr, size_t size);
 };
 
 // Implements a recursive decoder that lifts a trace of instructions to bitcode.
@@ -99,6 +120,37 @@ class TraceLifter {
   Lift(uint64_t addr,
        std::function<void(uint64_t, llvm::Function *)> callback = NullCallback);
 
+  // Cache lifted traces as bitcode files in the directory `dir`, which is
+  // created if it doesn't exist. A cached trace is reused in place of lifting
+  // when it was lifted from the same address, for the same architecture and
+  // semantics bitcode file, by the same version of the lifter with the same
+  // settings (e.g. `EnableLiftTemplates`), and the bytes that it decoded are
+  // unchanged. `options` describes any other settings of the caller that the
+  // cached traces depend on, and traces cached under different `options` are
+  // never reused for one another.
+  //
+  // NOTE: The cache assumes that the trace manager's knowledge of trace heads
+  //       and devirtualized targets is the same as when the trace was cached.
+  //
+  // Returns `false`, and leaves caching disabled, if the semantics bitcode
+  // file of the architecture can't be found or the directory can't be
+  // created.
+  bool EnableCache(std::filesystem::path dir, std::string_view options = {});
+
+  // Reuse the decodings of instructions whose bytes were already decoded,
+  // keeping up to `max_entries` of them in a `DecodeCache`.
+  void EnableDecodeCache(size_t max_entries = DecodeCache::kDefaultMaxEntries);
+
+  // Counters of the decode cache. These are all zero if the decode cache
+  // isn't enabled.
+  DecodeCacheStats GetDecodeCacheStats(void) const;
+
+  // Reuse the operand IR lifted for earlier instructions of the same form.
+  // See `InstructionLifter::EnableLiftTemplates`. This only changes the trace
+  // lifter's own instruction lifter, and not the lifters that the `Arch`
+  // attaches to decoded instructions.
+  void EnableLiftTemplates(bool enable = true);
+
  private:
   TraceLifter(void) = delete;
 
@@ -107,4 +159,58 @@ class TraceLifter {
   std::unique_ptr<Impl> impl;
 };
 
+// Lifts many traces at once using a pool of worker threads. Each worker owns
+// its own `llvm::LLVMContext`, `Arch` and semantics module, and lifts a
+// disjoint set of traces into that module. Trace heads that a worker discovers
+// while lifting are queued rather than lifted by that worker, so that idle
+// workers can steal them. Once all workers finish, the lifted traces are
+// merged into the semantics module of the `Arch` passed to the constructor,
+// i.e. the same module that a `TraceLifter` would lift into.
+//
+// NOTE: `TraceManager::TryReadExecutableByte`,
+//       `TraceManager::TryReadExecutableBytes` and `TraceManager::TraceName`
+//       of `manager` are invoked concurrently from the worker threads, and so
+//       must be thread-safe. All other `TraceManager` methods are invoked
+//       while holding a lock.
+class ParallelTraceLifter {
+ public:
+  ~ParallelTraceLifter(void);
+
+  inline ParallelTraceLifter(const Arch *arch_, TraceManager &manager_,
+                             unsigned num_workers_ = 0)
+      : ParallelTraceLifter(arch_, &manager_, num_workers_) {}
+
+  // If `num_workers_` is zero, then one worker per hardware thread is used.
+  ParallelTraceLifter(const Arch *arch_, TraceManager *manager_,
+                      unsigned num_workers_ = 0);
+
+  // Lift all traces reachable from `addrs`. Calls `callback` with each
+  // lifted trace once it has been merged into the destination module.
+  bool Lift(const std::vector<uint64_t> &addrs,
+            std::function<void(uint64_t, llvm::Function *)> callback =
+                TraceLifter::NullCallback);
+
+  // Share a cache of lifted traces in `dir` between all of the workers. See
+  // `TraceLifter::EnableCache`.
+  bool EnableCache(std::filesystem::path dir, std::string_view options = {});
+
+  // Give each of the workers its own decode cache. See
+  // `TraceLifter::EnableDecodeCache`.
+  void EnableDecodeCache(size_t max_entries = DecodeCache::kDefaultMaxEntries);
+
+  // Counters of the decode caches of all of the workers, added together.
+  DecodeCacheStats GetDecodeCacheStats(void) const;
+
+  // Have each of the workers reuse lifted operand IR. See
+  // `TraceLifter::EnableLiftTemplates`.
+  void EnableLiftTemplates(bool enable = true);
+
+ private:
+  ParallelTraceLifter(void) = delete;
+
+  class Impl;
+
+  std::unique_ptr<Impl> impl;
+};
+
 }  // namespace remill
@@ -184,6 +184,22 @@ std::unique_ptr<llvm::Module>
 LoadArchSemantics(const Arch *arch,
                   const std::vector<std::filesystem::path> &sem_dirs);
 
+// Loads the semantics for the `arch`-specific machine, like
+// `LoadArchSemantics`, but only reads the bodies of functions on demand,
+// e.g. when `MaterializeUsedFunctions` is called. This makes loading much
+// cheaper when only a few instructions are lifted.
+std::unique_ptr<llvm::Module> LoadArchSemanticsLazily(const Arch *arch);
+std::unique_ptr<llvm::Module>
+LoadArchSemanticsLazily(const Arch *arch,
+                        const std::vector<std::filesystem::path> &sem_dirs);
+
+// Materialize the bodies of all functions that are reachable from functions
+// with bodies, e.g. lifted traces, in a lazily loaded `module`. The remaining
+// unmaterialized functions are turned into declarations. This must be called
+// before optimizing, verifying or saving a lazily loaded module, and does
+// nothing if `module` wasn't lazily loaded.
+bool MaterializeUsedFunctions(llvm::Module *module);
+
 // Store an LLVM module into a file.
 bool StoreModuleToFile(llvm::Module *module, std::string_view file_name,
                        bool allow_failure = false);
@@ -117,8 +117,21 @@ class AArch64Arch final : public AArch64ArchBase, DefaultContextAndLifter {
   bool ArchDecodeInstruction(uint64_t address, std::string_view instr_bytes,
                              Instruction &inst) const final;
 
+  // Decode a batch of instructions.
+  void ArchDecodeInstructions(uint64_t address, std::string_view instr_bytes,
+                              Instruction *insts,
+                              size_t num_insts) const final;
+
  private:
   AArch64Arch(void) = delete;
+
+  // Fill in the parts of `inst` that don't depend on its encoding.
+  void InitInstruction(uint64_t address, Instruction &inst) const;
+
+  // Decode the operands of the instruction extracted into `dinst`.
+  bool DecodeExtracted(uint64_t address, std::string_view inst_bytes,
+                       const aarch64::InstData &dinst,
+                       Instruction &inst) const;
 };
 
 AArch64Arch::AArch64Arch(llvm::LLVMContext *context_, OSName os_name_,
@@ -433,6 +446,9 @@ static void AddImmOperand(Instruction &inst, uint64_t val,
   inst.operands.push_back(op);
 }
 
+// Add the operands of the exclusive monitor. `MONITOR` holds the address
+// marked by a load-exclusive, and `MONITOR_VALUE` holds the value that it
+// loaded, so that a store-exclusive can be a compare-exchange against it.
 static void AddMonitorOperand(Instruction &inst) {
   Operand op;
   op.action = Operand::kActionWrite;
@@ -441,6 +457,9 @@ static void AddMonitorOperand(Instruction &inst) {
   op.size = 64;
   op.type = Operand::kTypeRegister;
   inst.operands.push_back(op);
+
+  op.reg.name = "MONITOR_VALUE";
+  inst.operands.push_back(op);
 }
 
 static void AddPCRegOp(Instruction &inst, Operand::Action action, int64_t disp,
@@ -801,13 +820,7 @@ static uint64_t VFPExpandImmToFloat64(uint64_t imm) {
 }
 
 
-bool AArch64Arch::ArchDecodeInstruction(uint64_t address,
-                                        std::string_view inst_bytes,
-                                        Instruction &inst) const {
-
-  aarch64::InstData dinst = {};
-  auto bytes = reinterpret_cast<const uint8_t *>(inst_bytes.data());
-
+void AArch64Arch::InitInstruction(uint64_t address, Instruction &inst) const {
   inst.arch = this;
   inst.arch_name = arch_name;
   inst.sub_arch_name = arch_name;  // TODO(pag): Thumb.
@@ -815,6 +828,16 @@ bool AArch64Arch::ArchDecodeInstruction(uint64_t address,
   inst.pc = address;
   inst.next_pc = address + kInstructionSize;
   inst.category = Instruction::kCategoryInvalid;
+}
+
+bool AArch64Arch::ArchDecodeInstruction(uint64_t address,
+                                        std::string_view inst_bytes,
+                                        Instruction &inst) const {
+
+  aarch64::InstData dinst = {};
+  auto bytes = reinterpret_cast<const uint8_t *>(inst_bytes.data());
+
+  InitInstruction(address, inst);
 
   if (kInstructionSize != inst_bytes.size()) {
     inst.category = Instruction::kCategoryInvalid;
@@ -829,6 +852,47 @@ bool AArch64Arch::ArchDecodeInstruction(uint64_t address,
     return false;
   }
 
+  return DecodeExtracted(address, inst_bytes, dinst, inst);
+}
+
+// Extract the fields of the whole batch before decoding any operands, so that
+// the table lookups for neighbouring words can overlap.
+void AArch64Arch::ArchDecodeInstructions(uint64_t address,
+                                         std::string_view instr_bytes,
+                                         Instruction *insts,
+                                         size_t num_insts) const {
+  static constexpr size_t kBatchSize = 32u;
+  aarch64::InstData dinsts[kBatchSize];
+  bool extracted[kBatchSize];
+
+  auto bytes = reinterpret_cast<const uint8_t *>(instr_bytes.data());
+  for (size_t i = 0u; i < num_insts; i += kBatchSize) {
+    const auto batch_size = std::min(kBatchSize, num_insts - i);
+
+    for (size_t j = 0u; j < batch_size; ++j) {
+      dinsts[j] = {};
+      extracted[j] =
+          aarch64::TryExtract(&(bytes[(i + j) * kInstructionSize]), dinsts[j]);
+    }
+
+    for (size_t j = 0u; j < batch_size; ++j) {
+      const auto offset = (i + j) * kInstructionSize;
+      auto &inst = insts[i + j];
+      InitInstruction(address + offset, inst);
+      if (!extracted[j] ||
+          !DecodeExtracted(address + offset,
+                           instr_bytes.substr(offset, kInstructionSize),
+                           dinsts[j], inst)) {
+        inst.category = Instruction::kCategoryInvalid;
+      }
+    }
+  }
+}
+
+bool AArch64Arch::DecodeExtracted(uint64_t address,
+                                  std::string_view inst_bytes,
+                                  const aarch64::InstData &dinst,
+                                  Instruction &inst) const {
   if (!inst.bytes.empty() && inst.bytes.data() == inst_bytes.data()) {
     CHECK_LE(kInstructionSize, inst.bytes.size());
     inst.bytes.resize(kInstructionSize);
@@ -838,6 +902,7 @@ bool AArch64Arch::ArchDecodeInstruction(uint64_t address,
 
   inst.category = InstCategory(dinst);
   inst.function = aarch64::InstFormToString(dinst.iform);
+  inst.form = static_cast<uint32_t>(dinst.iform);
 
   if (!aarch64::TryDecode(dinst, inst)) {
     inst.category = Instruction::kCategoryInvalid;
@@ -4453,7 +4518,6 @@ bool TryDecodeLDAXR_LR64_LDSTEXCL(const InstData &data, Instruction &inst) {
 
 // LDXR  <Wt>, [<Xn|SP>{,#0}]
 bool TryDecodeLDXR_LR32_LDSTEXCL(const InstData &data, Instruction &inst) {
-  inst.is_atomic_read_modify_write = true;
   AddRegOperand(inst, kActionWrite, kRegW, kUseAsValue, data.Rt);
   AddBasePlusOffsetMemOp(inst, kActionRead, 32, data.Rn, 0);
   AddMonitorOperand(inst);
@@ -4462,7 +4526,6 @@ bool TryDecodeLDXR_LR32_LDSTEXCL(const InstData &data, Instruction &inst) {
 
 // LDXR  <Xt>, [<Xn|SP>{,#0}]
 bool TryDecodeLDXR_LR64_LDSTEXCL(const InstData &data, Instruction &inst) {
-  inst.is_atomic_read_modify_write = true;
   AddRegOperand(inst, kActionWrite, kRegX, kUseAsValue, data.Rt);
   AddBasePlusOffsetMemOp(inst, kActionRead, 64, data.Rn, 0);
   AddMonitorOperand(inst);
@@ -4471,7 +4534,6 @@ bool TryDecodeLDXR_LR64_LDSTEXCL(const InstData &data, Instruction &inst) {
 
 // STLXR  <Ws>, <Wt>, [<Xn|SP>{,#0}]
 bool TryDecodeSTLXR_SR32_LDSTEXCL(const InstData &data, Instruction &inst) {
-  inst.is_atomic_read_modify_write = true;
   AddRegOperand(inst, kActionWrite, kRegW, kUseAsValue, data.Rs);
   AddRegOperand(inst, kActionRead, kRegW, kUseAsValue, data.Rt);
   AddBasePlusOffsetMemOp(inst, kActionWrite, 32, data.Rn, 0);
@@ -4481,7 +4543,6 @@ bool TryDecodeSTLXR_SR32_LDSTEXCL(const InstData &data, Instruction &inst) {
 
 // STLXR  <Ws>, <Xt>, [<Xn|SP>{,#0}]
 bool TryDecodeSTLXR_SR64_LDSTEXCL(const InstData &data, Instruction &inst) {
-  inst.is_atomic_read_modify_write = true;
   AddRegOperand(inst, kActionWrite, kRegW, kUseAsValue, data.Rs);
   AddRegOperand(inst, kActionRead, kRegX, kUseAsValue, data.Rt);
   AddBasePlusOffsetMemOp(inst, kActionWrite, 64, data.Rn, 0);
@@ -7102,7 +7102,15 @@ bool TryDecodeLDCLRLB_32_MEMOP(const InstData &data, Instruction &inst);
 const char *InstNameToString(InstName iclass);
 const char *InstFormToString(InstForm iform);
 
+// Extract the fields of an instruction by walking a decision automaton over
+// its bits.
 bool TryExtract(const uint8_t *bytes, InstData &data);
+
+// Extract the fields of an instruction by trying, one at a time, each of the
+// encodings that share its bits 26 to 28. This gives the same results as
+// `TryExtract`, and is kept as a reference to test against.
+bool TryExtractWithTree(const uint8_t *bytes, InstData &data);
+
 bool TryDecode(const InstData &data, Instruction &inst);
 
 }  // namespace aarch64
@@ -0,0 +1,282 @@
+#!/usr/bin/env python
+# Copyright (c) 2023 Trail of Bits, Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Builds a decision automaton that maps a 32-bit AArch64 instruction word to
+# the short list of `TryExtract*` functions whose fixed bits it can match.
+#
+# Each node of the automaton is a packed `uint32_t`. Inner nodes select a
+# field of up to `MAX_FIELD_WIDTH` bits of the instruction word, and the value
+# of that field indexes into the node's contiguous children. Leaf nodes name a
+# run of indices into a table of `TryExtract*` function pointers. The run keeps
+# the order in which `GenOpMap.py` chains those functions within each group of
+# its first level, so that the automaton extracts exactly what the chains do.
+#
+# How to use:
+#
+#   `GenOpMap.py` imports this module and calls `write_automaton` when it
+#   generates `Extract.cpp`. The ARM XML that `GenOpMap.py` reads isn't kept
+#   in the tree, so this module can also rebuild the automaton from the
+#   existing `Extract.cpp`:
+#
+#     python GenDecodeAutomaton.py ../Extract.cpp > /tmp/Automaton.cpp
+#
+#   and then the output replaces everything from the `kExtractors` table down
+#   to, and including, the end of the anonymous namespace in `Extract.cpp`.
+
+import collections
+import re
+import sys
+
+MAX_FIELD_WIDTH = 3
+
+LEAF_NODE = 1 << 31
+MAX_LEAF_SIZE = 0xff
+MAX_NODE_INDEX = (1 << 23) - 1
+
+FIRST_LEVEL_SHIFT = 26
+FIRST_LEVEL_WIDTH = 3
+
+
+class Encoding(object):
+  def __init__(self, index, name, mask, accept):
+    self.index = index
+    self.name = name
+    self.mask = mask
+    self.accept = accept
+
+
+def _split(cands, shift, width):
+  """Partition `cands` by the value of the field `[shift, shift + width)`.
+  A candidate goes to every child whose field value agrees with the
+  candidate's fixed bits in that field."""
+  field_mask = (1 << width) - 1
+  children = []
+  for value in range(1 << width):
+    child = []
+    for enc in cands:
+      enc_mask = (enc.mask >> shift) & field_mask
+      enc_accept = (enc.accept >> shift) & field_mask
+      if (value & enc_mask) == enc_accept:
+        child.append(enc)
+    children.append(child)
+  return children
+
+
+def _choose_field(cands, decided):
+  """Find the field that most shrinks the candidate lists, or `None` if no
+  field makes progress."""
+  best = None
+  best_score = None
+  for shift in range(32):
+    for width in range(1, MAX_FIELD_WIDTH + 1):
+      if shift + width > 32:
+        break
+      field = ((1 << width) - 1) << shift
+      if field & decided:
+        break
+      children = _split(cands, shift, width)
+      largest = max(len(child) for child in children)
+      if largest >= len(cands):
+        continue
+
+      # Prefer the smallest average list, then the shallowest worst case, then
+      # the narrowest field (i.e. the smallest table).
+      total = sum(len(child) for child in children)
+      score = (float(total) / (1 << width), largest, width)
+      if best_score is None or score < best_score:
+        best_score = score
+        best = (shift, width, children)
+  return best
+
+
+class Automaton(object):
+  def __init__(self, buckets):
+    """`buckets` lists, for each value of the first level field
+    (bits 26 to 28), the `Encoding`s chained for that value, in order."""
+    self.nodes = []
+    self.leaves = []
+    self.leaf_offsets = {}
+    self.extractors = []
+    self.num_inner = 0
+    self.max_depth = 0
+
+    seen = set()
+    for bucket in buckets:
+      for enc in bucket:
+        if enc.index not in seen:
+          seen.add(enc.index)
+          self.extractors.append(enc)
+    self.extractors.sort(key=lambda enc: enc.index)
+    self.extractor_index = dict(
+        (enc.index, i) for i, enc in enumerate(self.extractors))
+
+    decided = ((1 << FIRST_LEVEL_WIDTH) - 1) << FIRST_LEVEL_SHIFT
+    self.nodes.append(None)
+    work = [(0, FIRST_LEVEL_SHIFT, FIRST_LEVEL_WIDTH, buckets, decided, 1)]
+    while work:
+      index, shift, width, children, decided, depth = work.pop(0)
+      first_child = len(self.nodes)
+      assert first_child <= MAX_NODE_INDEX
+      self.nodes[index] = (first_child << 8) | (width << 5) | shift
+      self.num_inner += 1
+      self.nodes.extend([None] * len(children))
+      for i, child in enumerate(children):
+        self._add(first_child + i, child, decided, depth + 1, work)
+
+  def _add(self, index, cands, decided, depth, work):
+    field = None
+    if len(cands) > 1:
+      field = _choose_field(cands, decided)
+
+    if field is None:
+      self.nodes[index] = self._leaf(cands)
+      self.max_depth = max(self.max_depth, depth)
+    else:
+      shift, width, children = field
+      decided |= ((1 << width) - 1) << shift
+      work.append((index, shift, width, children, decided, depth))
+
+  def _leaf(self, cands):
+    assert len(cands) <= MAX_LEAF_SIZE
+    key = tuple(self.extractor_index[enc.index] for enc in cands)
+    if key not in self.leaf_offsets:
+      offset = len(self.leaves)
+      for i in range(len(key)):
+        if tuple(self.leaves[i:i + len(key)]) == key:
+          offset = i
+          break
+      else:
+        self.leaves.extend(key)
+      self.leaf_offsets[key] = offset
+    offset = self.leaf_offsets[key] if key else 0
+    assert offset <= MAX_NODE_INDEX
+    return LEAF_NODE | (offset << 8) | len(key)
+
+
+def _write_table(out, decl, values, fmt, per_line):
+  out.write('{} = {{\n'.format(decl))
+  for i in range(0, len(values), per_line):
+    out.write('    {},\n'.format(', '.join(
+        fmt.format(v) for v in values[i:i + per_line])))
+  out.write('};\n\n')
+
+
+def write_automaton(out, buckets):
+  """Write the tables of the automaton, and the `TryExtract` function that
+  walks them, to `out`. The `TryExtract*` functions named by `buckets` must
+  already be declared."""
+  automaton = Automaton(buckets)
+
+  out.write('// Functions that extract each encoding, indexed by ')
+  out.write('`kLeafExtractors`.\n')
+  out.write('static bool (*const kExtractors[])(InstData &, uint32_t) = {\n')
+  for enc in automaton.extractors:
+    out.write('    TryExtract{},\n'.format(enc.name))
+  out.write('};\n\n')
+
+  out.write('// Runs of indices into `kExtractors`, named by the leaves of ')
+  out.write('the decoder\n// automaton.\n')
+  _write_table(out, 'static const uint16_t kLeafExtractors[]',
+               automaton.leaves, '{}', 12)
+
+  out.write("""// Nodes of the decoder automaton, of which {} are inner nodes and {} are
+// leaves. No path is longer than {} nodes. An inner node selects a field of
+// the instruction bits, and the value of that field picks one of its children:
+//
+//    bits 0 to 4:   shift of the field
+//    bits 5 to 7:   width of the field
+//    bits 8 to 30:  index of the first child node
+//
+// A leaf names a run of `kLeafExtractors` to try, in order:
+//
+//    bits 0 to 7:   number of extractors to try
+//    bits 8 to 30:  index of the first extractor in `kLeafExtractors`
+//    bit 31:        set
+""".format(automaton.num_inner, len(automaton.nodes) - automaton.num_inner,
+           automaton.max_depth))
+  _write_table(out, 'static const uint32_t kDecodeNodes[]', automaton.nodes,
+               '0x{:08x}U', 5)
+
+  out.write("""static constexpr uint32_t kLeafNode = 0x{:08x}U;
+
+// Extract the fields of the instruction in `bits` by walking the decoder
+// automaton down to the short list of encodings that `bits` may match.
+static bool TryExtractWithAutomaton(InstData &inst, uint32_t bits) {{
+  auto node = kDecodeNodes[0];
+  while (!(node & kLeafNode)) {{
+    const auto shift = node & 0x1fU;
+    const auto field_mask = (1U << ((node >> 5U) & 0x7U)) - 1U;
+    node = kDecodeNodes[(node >> 8U) + ((bits >> shift) & field_mask)];
+  }}
+
+  const auto first = (node >> 8U) & 0x7fffffU;
+  const auto last = first + (node & 0xffU);
+  for (auto i = first; i < last; ++i) {{
+    if (kExtractors[kLeafExtractors[i]](inst, bits)) {{
+      return true;
+    }}
+  }}
+  return false;
+}}
+
+}}  // namespace
+""".format(LEAF_NODE))
+
+
+_DEF = re.compile(r'^static bool TryExtract(\w+)\(InstData &inst,(?!.*;)')
+_MASK = re.compile(r'^  if \(\(bits & 0x([0-9a-f]+)U\) != 0x([0-9a-f]+)U\) \{')
+_CHAIN = re.compile(r'TryExtract(\w+)\(inst, bits\)')
+
+
+def read_extract_cpp(path):
+  """Recover the encodings, and the chains of the first level, from an
+  existing `Extract.cpp`."""
+  encodings = {}
+  chains = {}
+  current = None
+  with open(path) as f:
+    for line in f:
+      match = _DEF.match(line)
+      if match:
+        current = match.group(1)
+        if current.isdigit():
+          chains[int(current)] = []
+        continue
+
+      if current is None:
+        continue
+
+      if current.isdigit():
+        chains[int(current)].extend(_CHAIN.findall(line))
+        if line.startswith('}'):
+          current = None
+        continue
+
+      match = _MASK.match(line)
+      if match:
+        encodings[current] = Encoding(len(encodings), current,
+                                      int(match.group(1), 16),
+                                      int(match.group(2), 16))
+        current = None
+
+  assert len(chains) == 1 << FIRST_LEVEL_WIDTH
+  return [[encodings[name] for name in chains[i]] for i in sorted(chains)]
+
+
+if __name__ == '__main__':
+  if len(sys.argv) != 2:
+    sys.stderr.write('Usage: {} path/to/Extract.cpp\n'.format(sys.argv[0]))
+    sys.exit(1)
+  write_automaton(sys.stdout, read_extract_cpp(sys.argv[1]))
@@ -31,6 +31,8 @@ import math
 import os
 import sys
 
+import GenDecodeAutomaton
+
 try:
   import xml.etree.cElementTree as ET
 except:
@@ -663,7 +665,15 @@ decl.write("""
 const char *InstNameToString(InstName iclass);
 const char *InstFormToString(InstForm iform);
 
+// Extract the fields of an instruction by walking a decision automaton over
+// its bits.
 bool TryExtract(const uint8_t *bytes, InstData &data);
+
+// Extract the fields of an instruction by trying, one at a time, each of the
+// encodings that share its bits 26 to 28. This gives the same results as
+// `TryExtract`, and is kept as a reference to test against.
+bool TryExtractWithTree(const uint8_t *bytes, InstData &data);
+
 bool TryDecode(const InstData &data, Instruction &inst);
 
 }  // namespace aarch64
@@ -910,6 +920,8 @@ for base in ENCODINGS:
 mask_str = chosen_to_string(0xFFFFFFFF, chosen).replace('0', '1').replace('-', '0')
 mask = int(mask_str, 2)
 all_bases = set()
+encoding_index = dict((base, i) for i, base in enumerate(ENCODINGS))
+buckets = []
 
 for i in xrange(int(2**len(chosen))):
 
@@ -947,6 +959,16 @@ for i in xrange(int(2**len(chosen))):
   bases = list(bases)
   bases.sort(key=lambda b: num_var_bits[b])
 
+  # The decoder automaton tries these encodings in the same order.
+  bucket = []
+  for base in bases:
+    base_bits = "".join(reversed(base.bits))
+    bucket.append(GenDecodeAutomaton.Encoding(
+        encoding_index[base], base.iform.upper(),
+        int(base_bits.replace('0', '1').replace('x', '0'), 2),
+        int(base_bits.replace('x', '0'), 2)))
+  buckets.append(bucket)
+
   # exit()
   impl.write("// {}\n".format(sel_mask_str))
   impl.write('static bool TryExtract{}(InstData &inst, uint32_t bits) {{\n'.format(i))
@@ -962,7 +984,7 @@ for i in xrange(int(2**len(chosen))):
   impl.write('  TryExtract{},  // {}\n'.format(i, chosen_to_string(i, chosen)))
 impl.write('};\n\n')
 
-impl.write("}  // namespace\n")
+GenDecodeAutomaton.write_automaton(impl, buckets)
 
 impl.write("""
 const char *InstNameToString(InstName iclass) {{
@@ -990,7 +1012,7 @@ const char *InstFormToString(InstForm iform) {{
 """.format(iclass_names[-1].upper(), iform_names[-1].upper()))
 
 impl.write("""
-bool TryExtract(const uint8_t *bytes, InstData &inst) {
+bool TryExtractWithTree(const uint8_t *bytes, InstData &inst) {
   uint32_t bits = 0;
   bits = (bits << 8) | static_cast<uint32_t>(bytes[3]);
   bits = (bits << 8) | static_cast<uint32_t>(bytes[2]);
@@ -1012,6 +1034,17 @@ for i, bit in enumerate(reversed(chosen)):
 impl.write('  return kFirstLevel[index](inst, bits);\n')
 impl.write('}\n\n')
 
+impl.write("""bool TryExtract(const uint8_t *bytes, InstData &inst) {
+  uint32_t bits = 0;
+  bits = (bits << 8) | static_cast<uint32_t>(bytes[3]);
+  bits = (bits << 8) | static_cast<uint32_t>(bytes[2]);
+  bits = (bits << 8) | static_cast<uint32_t>(bytes[1]);
+  bits = (bits << 8) | static_cast<uint32_t>(bytes[0]);
+  return TryExtractWithAutomaton(inst, bits);
+}
+
+""")
+
 
 impl.write("}  // namespace aarch64\n")
 impl.write("}  // namespace remill\n\n")
@@ -77391,6 +77391,3047 @@ static bool (*const kFirstLevel[])(InstData &, uint32_t) = {
     TryExtract7,  // ---111--------------------------
 };
 
+// Functions that extract each encoding, indexed by `kLeafExtractors`.
+static bool (*const kExtractors[])(InstData &, uint32_t) = {
+    TryExtractFRECPX_ASISDMISCFP16_R,
+    TryExtractFRECPX_ASISDMISC_R,
+    TryExtractLDP_32_LDSTPAIR_POST,
+    TryExtractLDP_64_LDSTPAIR_POST,
+    TryExtractLDP_32_LDSTPAIR_PRE,
+    TryExtractLDP_64_LDSTPAIR_PRE,
+    TryExtractLDP_32_LDSTPAIR_OFF,
+    TryExtractLDP_64_LDSTPAIR_OFF,
+    TryExtractSTSMAXH_32S_MEMOP,
+    TryExtractSTSMAXLH_32S_MEMOP,
+    TryExtractREV_32_DP_1SRC,
+    TryExtractREV_64_DP_1SRC,
+    TryExtractUMINV_ASIMDALL_ONLY,
+    TryExtractFADDP_ASIMDSAMEFP16_ONLY,
+    TryExtractFADDP_ASIMDSAME_ONLY,
+    TryExtractFABS_ASIMDMISCFP16_R,
+    TryExtractFABS_ASIMDMISC_R,
+    TryExtractMADD_32A_DP_3SRC,
+    TryExtractMADD_64A_DP_3SRC,
+    TryExtractSCVTF_ASISDSHF_C,
+    TryExtractSCVTF_ASIMDSHF_C,
+    TryExtractCLZ_ASIMDMISC_R,
+    TryExtractFCVT_SH_FLOATDP1,
+    TryExtractFCVT_DH_FLOATDP1,
+    TryExtractFCVT_HS_FLOATDP1,
+    TryExtractFCVT_DS_FLOATDP1,
+    TryExtractFCVT_HD_FLOATDP1,
+    TryExtractFCVT_SD_FLOATDP1,
+    TryExtractLDLARH_LR32_LDSTEXCL,
+    TryExtractLDUR_B_LDST_UNSCALED,
+    TryExtractLDUR_H_LDST_UNSCALED,
+    TryExtractLDUR_S_LDST_UNSCALED,
+    TryExtractLDUR_D_LDST_UNSCALED,
+    TryExtractLDUR_Q_LDST_UNSCALED,
+    TryExtractCLZ_32_DP_1SRC,
+    TryExtractCLZ_64_DP_1SRC,
+    TryExtractFCVTN_ASIMDMISC_N,
+    TryExtractLDRSH_32_LDST_IMMPOST,
+    TryExtractLDRSH_64_LDST_IMMPOST,
+    TryExtractLDRSH_32_LDST_IMMPRE,
+    TryExtractLDRSH_64_LDST_IMMPRE,
+    TryExtractLDRSH_32_LDST_POS,
+    TryExtractLDRSH_64_LDST_POS,
+    TryExtractABS_ASISDMISC_R,
+    TryExtractABS_ASIMDMISC_R,
+    TryExtractHINT_1,
+    TryExtractHINT_2,
+    TryExtractHINT_3,
+    TryExtractFMAX_ASIMDSAMEFP16_ONLY,
+    TryExtractFMAX_ASIMDSAME_ONLY,
+    TryExtractFMIN_H_FLOATDP2,
+    TryExtractFMIN_S_FLOATDP2,
+    TryExtractFMIN_D_FLOATDP2,
+    TryExtractUMLSL_ASIMDELEM_L,
+    TryExtractFMAXNM_ASIMDSAMEFP16_ONLY,
+    TryExtractFMAXNM_ASIMDSAME_ONLY,
+    TryExtractFCVTPS_32H_FLOAT2INT,
+    TryExtractFCVTPS_64H_FLOAT2INT,
+    TryExtractFCVTPS_32S_FLOAT2INT,
+    TryExtractFCVTPS_64S_FLOAT2INT,
+    TryExtractFCVTPS_32D_FLOAT2INT,
+    TryExtractFCVTPS_64D_FLOAT2INT,
+    TryExtractFMINNM_H_FLOATDP2,
+    TryExtractFMINNM_S_FLOATDP2,
+    TryExtractFMINNM_D_FLOATDP2,
+    TryExtractLDTRSW_64_LDST_UNPRIV,
+    TryExtractFSQRT_H_FLOATDP1,
+    TryExtractFSQRT_S_FLOATDP1,
+    TryExtractFSQRT_D_FLOATDP1,
+    TryExtractLDEORA_32_MEMOP,
+    TryExtractLDEORAL_32_MEMOP,
+    TryExtractLDEOR_32_MEMOP,
+    TryExtractLDEORL_32_MEMOP,
+    TryExtractLDEORA_64_MEMOP,
+    TryExtractLDEORAL_64_MEMOP,
+    TryExtractLDEOR_64_MEMOP,
+    TryExtractLDEORL_64_MEMOP,
+    TryExtractSHRN_ASIMDSHF_N,
+    TryExtractFRINTM_H_FLOATDP1,
+    TryExtractFRINTM_S_FLOATDP1,
+    TryExtractFRINTM_D_FLOATDP1,
+    TryExtractLDUMINAB_32_MEMOP,
+    TryExtractLDUMINALB_32_MEMOP,
+    TryExtractLDUMINB_32_MEMOP,
+    TryExtractLDUMINLB_32_MEMOP,
+    TryExtractSHA256SU0_VV_CRYPTOSHA2,
+    TryExtractFMINP_ASIMDSAMEFP16_ONLY,
+    TryExtractFMINP_ASIMDSAME_ONLY,
+    TryExtractBFM_32M_BITFIELD,
+    TryExtractBFM_64M_BITFIELD,
+    TryExtractLDR_B_LDST_REGOFF,
+    TryExtractLDR_BL_LDST_REGOFF,
+    TryExtractLDR_H_LDST_REGOFF,
+    TryExtractLDR_S_LDST_REGOFF,
+    TryExtractLDR_D_LDST_REGOFF,
+    TryExtractLDR_Q_LDST_REGOFF,
+    TryExtractSQRDMLSH_ASISDELEM_R,
+    TryExtractSQRDMLSH_ASIMDELEM_R,
+    TryExtractANDS_32S_LOG_IMM,
+    TryExtractANDS_64S_LOG_IMM,
+    TryExtractLDCLRA_32_MEMOP,
+    TryExtractLDCLRAL_32_MEMOP,
+    TryExtractLDCLR_32_MEMOP,
+    TryExtractLDCLRL_32_MEMOP,
+    TryExtractLDCLRA_64_MEMOP,
+    TryExtractLDCLRAL_64_MEMOP,
+    TryExtractLDCLR_64_MEMOP,
+    TryExtractLDCLRL_64_MEMOP,
+    TryExtractUABD_ASIMDSAME_ONLY,
+    TryExtractSTURB_32_LDST_UNSCALED,
+    TryExtractORR_ASIMDSAME_ONLY,
+    TryExtractFRINTA_ASIMDMISCFP16_R,
+    TryExtractFRINTA_ASIMDMISC_R,
+    TryExtractSUBS_32_ADDSUB_SHIFT,
+    TryExtractSUBS_64_ADDSUB_SHIFT,
+    TryExtractSTXP_SP32_LDSTEXCL,
+    TryExtractSTXP_SP64_LDSTEXCL,
+    TryExtractLDXP_LP32_LDSTEXCL,
+    TryExtractLDXP_LP64_LDSTEXCL,
+    TryExtractORR_32_LOG_IMM,
+    TryExtractORR_64_LOG_IMM,
+    TryExtractUCVTF_ASISDMISCFP16_R,
+    TryExtractUCVTF_ASISDMISC_R,
+    TryExtractUCVTF_ASIMDMISCFP16_R,
+    TryExtractUCVTF_ASIMDMISC_R,
+    TryExtractSQDMULH_ASISDSAME_ONLY,
+    TryExtractSQDMULH_ASIMDSAME_ONLY,
+    TryExtractFCVTL_ASIMDMISC_L,
+    TryExtractCCMN_32_CONDCMP_IMM,
+    TryExtractCCMN_64_CONDCMP_IMM,
+    TryExtractDMB_BO_SYSTEM,
+    TryExtractYIELD_HI_SYSTEM,
+    TryExtractSTADD_32S_MEMOP,
+    TryExtractSTADDL_32S_MEMOP,
+    TryExtractSTADD_64S_MEMOP,
+    TryExtractSTADDL_64S_MEMOP,
+    TryExtractUSRA_ASISDSHF_R,
+    TryExtractUSRA_ASIMDSHF_R,
+    TryExtractMLS_ASIMDSAME_ONLY,
+    TryExtractST1_ASISDLSE_R1_1V,
+    TryExtractST1_ASISDLSE_R2_2V,
+    TryExtractST1_ASISDLSE_R3_3V,
+    TryExtractST1_ASISDLSE_R4_4V,
+    TryExtractST1_ASISDLSEP_I1_I1,
+    TryExtractST1_ASISDLSEP_R1_R1,
+    TryExtractST1_ASISDLSEP_I2_I2,
+    TryExtractST1_ASISDLSEP_R2_R2,
+    TryExtractST1_ASISDLSEP_I3_I3,
+    TryExtractST1_ASISDLSEP_R3_R3,
+    TryExtractST1_ASISDLSEP_I4_I4,
+    TryExtractST1_ASISDLSEP_R4_R4,
+    TryExtractAESIMC_B_CRYPTOAES,
+    TryExtractUMULH_64_DP_3SRC,
+    TryExtractUADDW_ASIMDDIFF_W,
+    TryExtractSTRH_32_LDST_IMMPOST,
+    TryExtractSTRH_32_LDST_IMMPRE,
+    TryExtractSTRH_32_LDST_POS,
+    TryExtractSCVTF_H32_FLOAT2INT,
+    TryExtractSCVTF_S32_FLOAT2INT,
+    TryExtractSCVTF_D32_FLOAT2INT,
+    TryExtractSCVTF_H64_FLOAT2INT,
+    TryExtractSCVTF_S64_FLOAT2INT,
+    TryExtractSCVTF_D64_FLOAT2INT,
+    TryExtractSTUMAXB_32S_MEMOP,
+    TryExtractSTUMAXLB_32S_MEMOP,
+    TryExtractCMHI_ASISDSAME_ONLY,
+    TryExtractCMHI_ASIMDSAME_ONLY,
+    TryExtractSQDMLAL_ASISDDIFF_ONLY,
+    TryExtractSQDMLAL_ASIMDDIFF_L,
+    TryExtractCBNZ_32_COMPBRANCH,
+    TryExtractCBNZ_64_COMPBRANCH,
+    TryExtractSEVL_HI_SYSTEM,
+    TryExtractFRINTX_H_FLOATDP1,
+    TryExtractFRINTX_S_FLOATDP1,
+    TryExtractFRINTX_D_FLOATDP1,
+    TryExtractSMIN_ASIMDSAME_ONLY,
+    TryExtractLDUMAXAB_32_MEMOP,
+    TryExtractLDUMAXALB_32_MEMOP,
+    TryExtractLDUMAXB_32_MEMOP,
+    TryExtractLDUMAXLB_32_MEMOP,
+    TryExtractAESE_B_CRYPTOAES,
+    TryExtractSMAXP_ASIMDSAME_ONLY,
+    TryExtractSTXR_SR32_LDSTEXCL,
+    TryExtractSTXR_SR64_LDSTEXCL,
+    TryExtractSUB_32_ADDSUB_IMM,
+    TryExtractSUB_64_ADDSUB_IMM,
+    TryExtractCMLT_ASISDMISC_Z,
+    TryExtractCMLT_ASIMDMISC_Z,
+    TryExtractFCMEQ_ASISDSAMEFP16_ONLY,
+    TryExtractFCMEQ_ASISDSAME_ONLY,
+    TryExtractFCMEQ_ASIMDSAMEFP16_ONLY,
+    TryExtractFCMEQ_ASIMDSAME_ONLY,
+    TryExtractCLREX_BN_SYSTEM,
+    TryExtractFSUB_ASIMDSAMEFP16_ONLY,
+    TryExtractFSUB_ASIMDSAME_ONLY,
+    TryExtractSHLL_ASIMDMISC_S,
+    TryExtractSQADD_ASISDSAME_ONLY,
+    TryExtractSQADD_ASIMDSAME_ONLY,
+    TryExtractBIC_ASIMDSAME_ONLY,
+    TryExtractSUB_ASISDSAME_ONLY,
+    TryExtractSUB_ASIMDSAME_ONLY,
+    TryExtractSWPA_32_MEMOP,
+    TryExtractSWPAL_32_MEMOP,
+    TryExtractSWP_32_MEMOP,
+    TryExtractSWPL_32_MEMOP,
+    TryExtractSWPA_64_MEMOP,
+    TryExtractSWPAL_64_MEMOP,
+    TryExtractSWP_64_MEMOP,
+    TryExtractSWPL_64_MEMOP,
+    TryExtractSMC_EX_EXCEPTION,
+    TryExtractLDUR_32_LDST_UNSCALED,
+    TryExtractLDUR_64_LDST_UNSCALED,
+    TryExtractCMGE_ASISDMISC_Z,
+    TryExtractCMGE_ASIMDMISC_Z,
+    TryExtractUCVTF_ASISDSHF_C,
+    TryExtractUCVTF_ASIMDSHF_C,
+    TryExtractSTLLR_SL32_LDSTEXCL,
+    TryExtractSTLLR_SL64_LDSTEXCL,
+    TryExtractSSUBL_ASIMDDIFF_L,
+    TryExtractSMLSL_ASIMDDIFF_L,
+    TryExtractSTTRB_32_LDST_UNPRIV,
+    TryExtractBIC_32_LOG_SHIFT,
+    TryExtractBIC_64_LOG_SHIFT,
+    TryExtractAND_ASIMDSAME_ONLY,
+    TryExtractSTLXP_SP32_LDSTEXCL,
+    TryExtractSTLXP_SP64_LDSTEXCL,
+    TryExtractSQRSHL_ASISDSAME_ONLY,
+    TryExtractSQRSHL_ASIMDSAME_ONLY,
+    TryExtractUABAL_ASIMDDIFF_L,
+    TryExtractMVNI_ASIMDIMM_L_HL,
+    TryExtractMVNI_ASIMDIMM_L_SL,
+    TryExtractMVNI_ASIMDIMM_M_SM,
+    TryExtractSRSHR_ASISDSHF_R,
+    TryExtractSRSHR_ASIMDSHF_R,
+    TryExtractCLS_32_DP_1SRC,
+    TryExtractCLS_64_DP_1SRC,
+    TryExtractSEV_HI_SYSTEM,
+    TryExtractUMIN_ASIMDSAME_ONLY,
+    TryExtractFMULX_ASISDSAMEFP16_ONLY,
+    TryExtractFMULX_ASISDSAME_ONLY,
+    TryExtractFMULX_ASIMDSAMEFP16_ONLY,
+    TryExtractFMULX_ASIMDSAME_ONLY,
+    TryExtractADDS_32S_ADDSUB_IMM,
+    TryExtractADDS_64S_ADDSUB_IMM,
+    TryExtractUQSHL_ASISDSAME_ONLY,
+    TryExtractUQSHL_ASIMDSAME_ONLY,
+    TryExtractSTEORB_32S_MEMOP,
+    TryExtractSTEORLB_32S_MEMOP,
+    TryExtractLDPSW_64_LDSTPAIR_POST,
+    TryExtractLDPSW_64_LDSTPAIR_PRE,
+    TryExtractLDPSW_64_LDSTPAIR_OFF,
+    TryExtractSTUMAXH_32S_MEMOP,
+    TryExtractSTUMAXLH_32S_MEMOP,
+    TryExtractSMOV_ASIMDINS_W_W,
+    TryExtractSMOV_ASIMDINS_X_X,
+    TryExtractUABA_ASIMDSAME_ONLY,
+    TryExtractSTSMINB_32S_MEMOP,
+    TryExtractSTSMINLB_32S_MEMOP,
+    TryExtractFCMGE_ASISDMISCFP16_FZ,
+    TryExtractFCMGE_ASISDMISC_FZ,
+    TryExtractFCMGE_ASIMDMISCFP16_FZ,
+    TryExtractFCMGE_ASIMDMISC_FZ,
+    TryExtractSTLLRB_SL32_LDSTEXCL,
+    TryExtractFRINTZ_ASIMDMISCFP16_R,
+    TryExtractFRINTZ_ASIMDMISC_R,
+    TryExtractSTXRH_SR32_LDSTEXCL,
+    TryExtractSTEORH_32S_MEMOP,
+    TryExtractSTEORLH_32S_MEMOP,
+    TryExtractFMINNMP_ASIMDSAMEFP16_ONLY,
+    TryExtractFMINNMP_ASIMDSAME_ONLY,
+    TryExtractLDLAR_LR32_LDSTEXCL,
+    TryExtractLDLAR_LR64_LDSTEXCL,
+    TryExtractADD_32_ADDSUB_SHIFT,
+    TryExtractADD_64_ADDSUB_SHIFT,
+    TryExtractSSHLL_ASIMDSHF_L,
+    TryExtractRORV_32_DP_2SRC,
+    TryExtractRORV_64_DP_2SRC,
+    TryExtractSTCLRB_32S_MEMOP,
+    TryExtractSTCLRLB_32S_MEMOP,
+    TryExtractLDARH_LR32_LDSTEXCL,
+    TryExtractSTSMAX_32S_MEMOP,
+    TryExtractSTSMAXL_32S_MEMOP,
+    TryExtractSTSMAX_64S_MEMOP,
+    TryExtractSTSMAXL_64S_MEMOP,
+    TryExtractBLR_64_BRANCH_REG,
+    TryExtractSQDMULL_ASISDELEM_L,
+    TryExtractSQDMULL_ASIMDELEM_L,
+    TryExtractLD1_ASISDLSO_B1_1B,
+    TryExtractLD1_ASISDLSO_H1_1H,
+    TryExtractLD1_ASISDLSO_S1_1S,
+    TryExtractLD1_ASISDLSO_D1_1D,
+    TryExtractLD1_ASISDLSOP_B1_I1B,
+    TryExtractLD1_ASISDLSOP_BX1_R1B,
+    TryExtractLD1_ASISDLSOP_H1_I1H,
+    TryExtractLD1_ASISDLSOP_HX1_R1H,
+    TryExtractLD1_ASISDLSOP_S1_I1S,
+    TryExtractLD1_ASISDLSOP_SX1_R1S,
+    TryExtractLD1_ASISDLSOP_D1_I1D,
+    TryExtractLD1_ASISDLSOP_DX1_R1D,
+    TryExtractCCMN_32_CONDCMP_REG,
+    TryExtractCCMN_64_CONDCMP_REG,
+    TryExtractSTNP_S_LDSTNAPAIR_OFFS,
+    TryExtractSTNP_D_LDSTNAPAIR_OFFS,
+    TryExtractSTNP_Q_LDSTNAPAIR_OFFS,
+    TryExtractFSUB_H_FLOATDP2,
+    TryExtractFSUB_S_FLOATDP2,
+    TryExtractFSUB_D_FLOATDP2,
+    TryExtractCSNEG_32_CONDSEL,
+    TryExtractCSNEG_64_CONDSEL,
+    TryExtractFCMGT_ASISDSAMEFP16_ONLY,
+    TryExtractFCMGT_ASISDSAME_ONLY,
+    TryExtractFCMGT_ASIMDSAMEFP16_ONLY,
+    TryExtractFCMGT_ASIMDSAME_ONLY,
+    TryExtractUSUBW_ASIMDDIFF_W,
+    TryExtractREV32_64_DP_1SRC,
+    TryExtractFSQRT_ASIMDMISCFP16_R,
+    TryExtractFSQRT_ASIMDMISC_R,
+    TryExtractEXTR_32_EXTRACT,
+    TryExtractEXTR_64_EXTRACT,
+    TryExtractFCVTAU_ASISDMISCFP16_R,
+    TryExtractFCVTAU_ASISDMISC_R,
+    TryExtractFCVTAU_ASIMDMISCFP16_R,
+    TryExtractFCVTAU_ASIMDMISC_R,
+    TryExtractZIP1_ASIMDPERM_ONLY,
+    TryExtractLDSETAH_32_MEMOP,
+    TryExtractLDSETALH_32_MEMOP,
+    TryExtractLDSETH_32_MEMOP,
+    TryExtractLDSETLH_32_MEMOP,
+    TryExtractLDR_32_LDST_REGOFF,
+    TryExtractLDR_64_LDST_REGOFF,
+    TryExtractLDADDAH_32_MEMOP,
+    TryExtractLDADDALH_32_MEMOP,
+    TryExtractLDADDH_32_MEMOP,
+    TryExtractLDADDLH_32_MEMOP,
+    TryExtractANDS_32_LOG_SHIFT,
+    TryExtractANDS_64_LOG_SHIFT,
+    TryExtractLD3_ASISDLSE_R3,
+    TryExtractLD3_ASISDLSEP_I3_I,
+    TryExtractLD3_ASISDLSEP_R3_R,
+    TryExtractFMUL_H_FLOATDP2,
+    TryExtractFMUL_S_FLOATDP2,
+    TryExtractFMUL_D_FLOATDP2,
+    TryExtractLDAXR_LR32_LDSTEXCL,
+    TryExtractLDAXR_LR64_LDSTEXCL,
+    TryExtractLDRB_32B_LDST_REGOFF,
+    TryExtractLDRB_32BL_LDST_REGOFF,
+    TryExtractUADALP_ASIMDMISC_P,
+    TryExtractFRINTX_ASIMDMISCFP16_R,
+    TryExtractFRINTX_ASIMDMISC_R,
+    TryExtractHLT_EX_EXCEPTION,
+    TryExtractSABA_ASIMDSAME_ONLY,
+    TryExtractFMAX_H_FLOATDP2,
+    TryExtractFMAX_S_FLOATDP2,
+    TryExtractFMAX_D_FLOATDP2,
+    TryExtractAESD_B_CRYPTOAES,
+    TryExtractAESMC_B_CRYPTOAES,
+    TryExtractLD2_ASISDLSO_B2_2B,
+    TryExtractLD2_ASISDLSO_H2_2H,
+    TryExtractLD2_ASISDLSO_S2_2S,
+    TryExtractLD2_ASISDLSO_D2_2D,
+    TryExtractLD2_ASISDLSOP_B2_I2B,
+    TryExtractLD2_ASISDLSOP_BX2_R2B,
+    TryExtractLD2_ASISDLSOP_H2_I2H,
+    TryExtractLD2_ASISDLSOP_HX2_R2H,
+    TryExtractLD2_ASISDLSOP_S2_I2S,
+    TryExtractLD2_ASISDLSOP_SX2_R2S,
+    TryExtractLD2_ASISDLSOP_D2_I2D,
+    TryExtractLD2_ASISDLSOP_DX2_R2D,
+    TryExtractBR_64_BRANCH_REG,
+    TryExtractFCVTZU_ASISDMISCFP16_R,
+    TryExtractFCVTZU_ASISDMISC_R,
+    TryExtractFCVTZU_ASIMDMISCFP16_R,
+    TryExtractFCVTZU_ASIMDMISC_R,
+    TryExtractSTEOR_32S_MEMOP,
+    TryExtractSTEORL_32S_MEMOP,
+    TryExtractSTEOR_64S_MEMOP,
+    TryExtractSTEORL_64S_MEMOP,
+    TryExtractTBX_ASIMDTBL_L2_2,
+    TryExtractTBX_ASIMDTBL_L3_3,
+    TryExtractTBX_ASIMDTBL_L4_4,
+    TryExtractTBX_ASIMDTBL_L1_1,
+    TryExtractUMLAL_ASIMDELEM_L,
+    TryExtractUMINP_ASIMDSAME_ONLY,
+    TryExtractCMLE_ASISDMISC_Z,
+    TryExtractCMLE_ASIMDMISC_Z,
+    TryExtractEOR_ASIMDSAME_ONLY,
+    TryExtractCMEQ_ASISDMISC_Z,
+    TryExtractCMEQ_ASIMDMISC_Z,
+    TryExtractLDUMAXAH_32_MEMOP,
+    TryExtractLDUMAXALH_32_MEMOP,
+    TryExtractLDUMAXH_32_MEMOP,
+    TryExtractLDUMAXLH_32_MEMOP,
+    TryExtractST3_ASISDLSO_B3_3B,
+    TryExtractST3_ASISDLSO_H3_3H,
+    TryExtractST3_ASISDLSO_S3_3S,
+    TryExtractST3_ASISDLSO_D3_3D,
+    TryExtractST3_ASISDLSOP_B3_I3B,
+    TryExtractST3_ASISDLSOP_BX3_R3B,
+    TryExtractST3_ASISDLSOP_H3_I3H,
+    TryExtractST3_ASISDLSOP_HX3_R3H,
+    TryExtractST3_ASISDLSOP_S3_I3S,
+    TryExtractST3_ASISDLSOP_SX3_R3S,
+    TryExtractST3_ASISDLSOP_D3_I3D,
+    TryExtractST3_ASISDLSOP_DX3_R3D,
+    TryExtractLDRSW_64_LOADLIT,
+    TryExtractLDADDA_32_MEMOP,
+    TryExtractLDADDAL_32_MEMOP,
+    TryExtractLDADD_32_MEMOP,
+    TryExtractLDADDL_32_MEMOP,
+    TryExtractLDADDA_64_MEMOP,
+    TryExtractLDADDAL_64_MEMOP,
+    TryExtractLDADD_64_MEMOP,
+    TryExtractLDADDL_64_MEMOP,
+    TryExtractFCVTZS_ASISDSHF_C,
+    TryExtractFCVTZS_ASIMDSHF_C,
+    TryExtractST2_ASISDLSO_B2_2B,
+    TryExtractST2_ASISDLSO_H2_2H,
+    TryExtractST2_ASISDLSO_S2_2S,
+    TryExtractST2_ASISDLSO_D2_2D,
+    TryExtractST2_ASISDLSOP_B2_I2B,
+    TryExtractST2_ASISDLSOP_BX2_R2B,
+    TryExtractST2_ASISDLSOP_H2_I2H,
+    TryExtractST2_ASISDLSOP_HX2_R2H,
+    TryExtractST2_ASISDLSOP_S2_I2S,
+    TryExtractST2_ASISDLSOP_SX2_R2S,
+    TryExtractST2_ASISDLSOP_D2_I2D,
+    TryExtractST2_ASISDLSOP_DX2_R2D,
+    TryExtractRADDHN_ASIMDDIFF_N,
+    TryExtractSTUR_32_LDST_UNSCALED,
+    TryExtractSTUR_64_LDST_UNSCALED,
+    TryExtractCLS_ASIMDMISC_R,
+    TryExtractSADDL_ASIMDDIFF_L,
+    TryExtractADDP_ASISDPAIR_ONLY,
+    TryExtractSTR_B_LDST_IMMPOST,
+    TryExtractSTR_H_LDST_IMMPOST,
+    TryExtractSTR_S_LDST_IMMPOST,
+    TryExtractSTR_D_LDST_IMMPOST,
+    TryExtractSTR_Q_LDST_IMMPOST,
+    TryExtractSTR_B_LDST_IMMPRE,
+    TryExtractSTR_H_LDST_IMMPRE,
+    TryExtractSTR_S_LDST_IMMPRE,
+    TryExtractSTR_D_LDST_IMMPRE,
+    TryExtractSTR_Q_LDST_IMMPRE,
+    TryExtractSTR_B_LDST_POS,
+    TryExtractSTR_H_LDST_POS,
+    TryExtractSTR_S_LDST_POS,
+    TryExtractSTR_D_LDST_POS,
+    TryExtractSTR_Q_LDST_POS,
+    TryExtractLDSETAB_32_MEMOP,
+    TryExtractLDSETALB_32_MEMOP,
+    TryExtractLDSETB_32_MEMOP,
+    TryExtractLDSETLB_32_MEMOP,
+    TryExtractFRINTP_H_FLOATDP1,
+    TryExtractFRINTP_S_FLOATDP1,
+    TryExtractFRINTP_D_FLOATDP1,
+    TryExtractCASA_C32_LDSTEXCL,
+    TryExtractCASAL_C32_LDSTEXCL,
+    TryExtractCAS_C32_LDSTEXCL,
+    TryExtractCASL_C32_LDSTEXCL,
+    TryExtractCASA_C64_LDSTEXCL,
+    TryExtractCASAL_C64_LDSTEXCL,
+    TryExtractCAS_C64_LDSTEXCL,
+    TryExtractCASL_C64_LDSTEXCL,
+    TryExtractWFE_HI_SYSTEM,
+    TryExtractLDUMINA_32_MEMOP,
+    TryExtractLDUMINAL_32_MEMOP,
+    TryExtractLDUMIN_32_MEMOP,
+    TryExtractLDUMINL_32_MEMOP,
+    TryExtractLDUMINA_64_MEMOP,
+    TryExtractLDUMINAL_64_MEMOP,
+    TryExtractLDUMIN_64_MEMOP,
+    TryExtractLDUMINL_64_MEMOP,
+    TryExtractSTXRB_SR32_LDSTEXCL,
+    TryExtractSTLXRH_SR32_LDSTEXCL,
+    TryExtractSTLLRH_SL32_LDSTEXCL,
+    TryExtractLDUMINAH_32_MEMOP,
+    TryExtractLDUMINALH_32_MEMOP,
+    TryExtractLDUMINH_32_MEMOP,
+    TryExtractLDUMINLH_32_MEMOP,
+    TryExtractLSLV_32_DP_2SRC,
+    TryExtractLSLV_64_DP_2SRC,
+    TryExtractINS_ASIMDINS_IR_R,
+    TryExtractCMGT_ASISDMISC_Z,
+    TryExtractCMGT_ASIMDMISC_Z,
+    TryExtractSMLAL_ASIMDELEM_L,
+    TryExtractSTCLR_32S_MEMOP,
+    TryExtractSTCLRL_32S_MEMOP,
+    TryExtractSTCLR_64S_MEMOP,
+    TryExtractSTCLRL_64S_MEMOP,
+    TryExtractBIT_ASIMDSAME_ONLY,
+    TryExtractCMEQ_ASISDSAME_ONLY,
+    TryExtractCMEQ_ASIMDSAME_ONLY,
+    TryExtractCRC32CB_32C_DP_2SRC,
+    TryExtractCRC32CH_32C_DP_2SRC,
+    TryExtractCRC32CW_32C_DP_2SRC,
+    TryExtractCRC32CX_64C_DP_2SRC,
+    TryExtractSTRH_32_LDST_REGOFF,
+    TryExtractBRK_EX_EXCEPTION,
+    TryExtractUADDLP_ASIMDMISC_P,
+    TryExtractUMAXV_ASIMDALL_ONLY,
+    TryExtractLDEORAH_32_MEMOP,
+    TryExtractLDEORALH_32_MEMOP,
+    TryExtractLDEORH_32_MEMOP,
+    TryExtractLDEORLH_32_MEMOP,
+    TryExtractSMAXV_ASIMDALL_ONLY,
+    TryExtractXTN_ASIMDMISC_N,
+    TryExtractSTRB_32_LDST_IMMPOST,
+    TryExtractSTRB_32_LDST_IMMPRE,
+    TryExtractSTRB_32_LDST_POS,
+    TryExtractUSQADD_ASISDMISC_R,
+    TryExtractUSQADD_ASIMDMISC_R,
+    TryExtractFCVTZS_32H_FLOAT2FIX,
+    TryExtractFCVTZS_64H_FLOAT2FIX,
+    TryExtractFCVTZS_32S_FLOAT2FIX,
+    TryExtractFCVTZS_64S_FLOAT2FIX,
+    TryExtractFCVTZS_32D_FLOAT2FIX,
+    TryExtractFCVTZS_64D_FLOAT2FIX,
+    TryExtractUQADD_ASISDSAME_ONLY,
+    TryExtractUQADD_ASIMDSAME_ONLY,
+    TryExtractLDR_32_LOADLIT,
+    TryExtractLDR_64_LOADLIT,
+    TryExtractFNMSUB_H_FLOATDP3,
+    TryExtractFNMSUB_S_FLOATDP3,
+    TryExtractFNMSUB_D_FLOATDP3,
+    TryExtractADDP_ASIMDSAME_ONLY,
+    TryExtractSHA1M_QSV_CRYPTOSHA3,
+    TryExtractLDAXP_LP32_LDSTEXCL,
+    TryExtractLDAXP_LP64_LDSTEXCL,
+    TryExtractCASPA_CP32_LDSTEXCL,
+    TryExtractCASPAL_CP32_LDSTEXCL,
+    TryExtractCASP_CP32_LDSTEXCL,
+    TryExtractCASPL_CP32_LDSTEXCL,
+    TryExtractCASPA_CP64_LDSTEXCL,
+    TryExtractCASPAL_CP64_LDSTEXCL,
+    TryExtractCASP_CP64_LDSTEXCL,
+    TryExtractCASPL_CP64_LDSTEXCL,
+    TryExtractFCVTZU_32H_FLOAT2FIX,
+    TryExtractFCVTZU_64H_FLOAT2FIX,
+    TryExtractFCVTZU_32S_FLOAT2FIX,
+    TryExtractFCVTZU_64S_FLOAT2FIX,
+    TryExtractFCVTZU_32D_FLOAT2FIX,
+    TryExtractFCVTZU_64D_FLOAT2FIX,
+    TryExtractSHA1P_QSV_CRYPTOSHA3,
+    TryExtractSADDLV_ASIMDALL_ONLY,
+    TryExtractTBL_ASIMDTBL_L2_2,
+    TryExtractTBL_ASIMDTBL_L3_3,
+    TryExtractTBL_ASIMDTBL_L4_4,
+    TryExtractTBL_ASIMDTBL_L1_1,
+    TryExtractADD_32_ADDSUB_EXT,
+    TryExtractADD_64_ADDSUB_EXT,
+    TryExtractFMAXNMP_ASISDPAIR_ONLY_H,
+    TryExtractFMAXNMP_ASISDPAIR_ONLY_SD,
+    TryExtractBICS_32_LOG_SHIFT,
+    TryExtractBICS_64_LOG_SHIFT,
+    TryExtractFNMUL_H_FLOATDP2,
+    TryExtractFNMUL_S_FLOATDP2,
+    TryExtractFNMUL_D_FLOATDP2,
+    TryExtractSQSUB_ASISDSAME_ONLY,
+    TryExtractSQSUB_ASIMDSAME_ONLY,
+    TryExtractSQXTN_ASISDMISC_N,
+    TryExtractSQXTN_ASIMDMISC_N,
+    TryExtractSTLXRB_SR32_LDSTEXCL,
+    TryExtractSTTRH_32_LDST_UNPRIV,
+    TryExtractSMINP_ASIMDSAME_ONLY,
+    TryExtractSHA256SU1_VVV_CRYPTOSHA3,
+    TryExtractFMSUB_H_FLOATDP3,
+    TryExtractFMSUB_S_FLOATDP3,
+    TryExtractFMSUB_D_FLOATDP3,
+    TryExtractSTR_32_LDST_IMMPOST,
+    TryExtractSTR_64_LDST_IMMPOST,
+    TryExtractSTR_32_LDST_IMMPRE,
+    TryExtractSTR_64_LDST_IMMPRE,
+    TryExtractSTR_32_LDST_POS,
+    TryExtractSTR_64_LDST_POS,
+    TryExtractINS_ASIMDINS_IV_V,
+    TryExtractDCPS2_DC_EXCEPTION,
+    TryExtractDCPS1_DC_EXCEPTION,
+    TryExtractFMLA_ASISDELEM_RH_H,
+    TryExtractFMLA_ASISDELEM_R_SD,
+    TryExtractFMLA_ASIMDELEM_RH_H,
+    TryExtractFMLA_ASIMDELEM_R_SD,
+    TryExtractSCVTF_ASISDMISCFP16_R,
+    TryExtractSCVTF_ASISDMISC_R,
+    TryExtractSCVTF_ASIMDMISCFP16_R,
+    TryExtractSCVTF_ASIMDMISC_R,
+    TryExtractUMULL_ASIMDDIFF_L,
+    TryExtractFMUL_ASIMDSAMEFP16_ONLY,
+    TryExtractFMUL_ASIMDSAME_ONLY,
+    TryExtractFMLA_ASIMDSAMEFP16_ONLY,
+    TryExtractFMLA_ASIMDSAME_ONLY,
+    TryExtractSDIV_32_DP_2SRC,
+    TryExtractSDIV_64_DP_2SRC,
+    TryExtractADD_32_ADDSUB_IMM,
+    TryExtractADD_64_ADDSUB_IMM,
+    TryExtractRBIT_32_DP_1SRC,
+    TryExtractRBIT_64_DP_1SRC,
+    TryExtractZIP2_ASIMDPERM_ONLY,
+    TryExtractLDAXRB_LR32_LDSTEXCL,
+    TryExtractHVC_EX_EXCEPTION,
+    TryExtractDCPS3_DC_EXCEPTION,
+    TryExtractFCVTNU_ASISDMISCFP16_R,
+    TryExtractFCVTNU_ASISDMISC_R,
+    TryExtractFCVTNU_ASIMDMISCFP16_R,
+    TryExtractFCVTNU_ASIMDMISC_R,
+    TryExtractSTUMINB_32S_MEMOP,
+    TryExtractSTUMINLB_32S_MEMOP,
+    TryExtractTBNZ_ONLY_TESTBRANCH,
+    TryExtractSTCLRH_32S_MEMOP,
+    TryExtractSTCLRLH_32S_MEMOP,
+    TryExtractBL_ONLY_BRANCH_IMM,
+    TryExtractFCVTMU_ASISDMISCFP16_R,
+    TryExtractFCVTMU_ASISDMISC_R,
+    TryExtractFCVTMU_ASIMDMISCFP16_R,
+    TryExtractFCVTMU_ASIMDMISC_R,
+    TryExtractFMAXNMP_ASIMDSAMEFP16_ONLY,
+    TryExtractFMAXNMP_ASIMDSAME_ONLY,
+    TryExtractFMOV_32H_FLOAT2INT,
+    TryExtractFMOV_64H_FLOAT2INT,
+    TryExtractFMOV_H32_FLOAT2INT,
+    TryExtractFMOV_S32_FLOAT2INT,
+    TryExtractFMOV_32S_FLOAT2INT,
+    TryExtractFMOV_H64_FLOAT2INT,
+    TryExtractFMOV_D64_FLOAT2INT,
+    TryExtractFMOV_V64I_FLOAT2INT,
+    TryExtractFMOV_64D_FLOAT2INT,
+    TryExtractFMOV_64VX_FLOAT2INT,
+    TryExtractLDCLRAH_32_MEMOP,
+    TryExtractLDCLRALH_32_MEMOP,
+    TryExtractLDCLRH_32_MEMOP,
+    TryExtractLDCLRLH_32_MEMOP,
+    TryExtractSABAL_ASIMDDIFF_L,
+    TryExtractLDSETA_32_MEMOP,
+    TryExtractLDSETAL_32_MEMOP,
+    TryExtractLDSET_32_MEMOP,
+    TryExtractLDSETL_32_MEMOP,
+    TryExtractLDSETA_64_MEMOP,
+    TryExtractLDSETAL_64_MEMOP,
+    TryExtractLDSET_64_MEMOP,
+    TryExtractLDSETL_64_MEMOP,
+    TryExtractFRECPS_ASISDSAMEFP16_ONLY,
+    TryExtractFRECPS_ASISDSAME_ONLY,
+    TryExtractFRECPS_ASIMDSAMEFP16_ONLY,
+    TryExtractFRECPS_ASIMDSAME_ONLY,
+    TryExtractSMLAL_ASIMDDIFF_L,
+    TryExtractLDSMINAH_32_MEMOP,
+    TryExtractLDSMINALH_32_MEMOP,
+    TryExtractLDSMINH_32_MEMOP,
+    TryExtractLDSMINLH_32_MEMOP,
+    TryExtractFRINTI_H_FLOATDP1,
+    TryExtractFRINTI_S_FLOATDP1,
+    TryExtractFRINTI_D_FLOATDP1,
+    TryExtractSMULH_64_DP_3SRC,
+    TryExtractFMADD_H_FLOATDP3,
+    TryExtractFMADD_S_FLOATDP3,
+    TryExtractFMADD_D_FLOATDP3,
+    TryExtractCCMP_32_CONDCMP_REG,
+    TryExtractCCMP_64_CONDCMP_REG,
+    TryExtractSRSHL_ASISDSAME_ONLY,
+    TryExtractSRSHL_ASIMDSAME_ONLY,
+    TryExtractFADD_H_FLOATDP2,
+    TryExtractFADD_S_FLOATDP2,
+    TryExtractFADD_D_FLOATDP2,
+    TryExtractFMULX_ASISDELEM_RH_H,
+    TryExtractFMULX_ASISDELEM_R_SD,
+    TryExtractFMULX_ASIMDELEM_RH_H,
+    TryExtractFMULX_ASIMDELEM_R_SD,
+    TryExtractBIC_ASIMDIMM_L_HL,
+    TryExtractBIC_ASIMDIMM_L_SL,
+    TryExtractPRFM_P_LDST_REGOFF,
+    TryExtractSTUMINH_32S_MEMOP,
+    TryExtractSTUMINLH_32S_MEMOP,
+    TryExtractORR_ASIMDIMM_L_HL,
+    TryExtractORR_ASIMDIMM_L_SL,
+    TryExtractFCVTAU_32H_FLOAT2INT,
+    TryExtractFCVTAU_64H_FLOAT2INT,
+    TryExtractFCVTAU_32S_FLOAT2INT,
+    TryExtractFCVTAU_64S_FLOAT2INT,
+    TryExtractFCVTAU_32D_FLOAT2INT,
+    TryExtractFCVTAU_64D_FLOAT2INT,
+    TryExtractLDXR_LR32_LDSTEXCL,
+    TryExtractLDXR_LR64_LDSTEXCL,
+    TryExtractSVC_EX_EXCEPTION,
+    TryExtractFCMPE_H_FLOATCMP,
+    TryExtractFCMPE_HZ_FLOATCMP,
+    TryExtractFCMPE_S_FLOATCMP,
+    TryExtractFCMPE_SZ_FLOATCMP,
+    TryExtractFCMPE_D_FLOATCMP,
+    TryExtractFCMPE_DZ_FLOATCMP,
+    TryExtractFRSQRTS_ASISDSAMEFP16_ONLY,
+    TryExtractFRSQRTS_ASISDSAME_ONLY,
+    TryExtractFRSQRTS_ASIMDSAMEFP16_ONLY,
+    TryExtractFRSQRTS_ASIMDSAME_ONLY,
+    TryExtractFRINTN_H_FLOATDP1,
+    TryExtractFRINTN_S_FLOATDP1,
+    TryExtractFRINTN_D_FLOATDP1,
+    TryExtractFMOV_H_FLOATIMM,
+    TryExtractFMOV_S_FLOATIMM,
+    TryExtractFMOV_D_FLOATIMM,
+    TryExtractEOR_32_LOG_IMM,
+    TryExtractEOR_64_LOG_IMM,
+    TryExtractMRS_RS_SYSTEM,
+    TryExtractESB_HI_SYSTEM,
+    TryExtractFCMLT_ASISDMISCFP16_FZ,
+    TryExtractFCMLT_ASISDMISC_FZ,
+    TryExtractFCMLT_ASIMDMISCFP16_FZ,
+    TryExtractFCMLT_ASIMDMISC_FZ,
+    TryExtractSQRDMULH_ASISDSAME_ONLY,
+    TryExtractSQRDMULH_ASIMDSAME_ONLY,
+    TryExtractSWPAH_32_MEMOP,
+    TryExtractSWPALH_32_MEMOP,
+    TryExtractSWPH_32_MEMOP,
+    TryExtractSWPLH_32_MEMOP,
+    TryExtractDUP_ASISDONE_ONLY,
+    TryExtractDUP_ASIMDINS_DV_V,
+    TryExtractSTLRH_SL32_LDSTEXCL,
+    TryExtractLDUMAXA_32_MEMOP,
+    TryExtractLDUMAXAL_32_MEMOP,
+    TryExtractLDUMAX_32_MEMOP,
+    TryExtractLDUMAXL_32_MEMOP,
+    TryExtractLDUMAXA_64_MEMOP,
+    TryExtractLDUMAXAL_64_MEMOP,
+    TryExtractLDUMAX_64_MEMOP,
+    TryExtractLDUMAXL_64_MEMOP,
+    TryExtractSQNEG_ASISDMISC_R,
+    TryExtractSQNEG_ASIMDMISC_R,
+    TryExtractUHADD_ASIMDSAME_ONLY,
+    TryExtractCASAH_C32_LDSTEXCL,
+    TryExtractCASALH_C32_LDSTEXCL,
+    TryExtractCASH_C32_LDSTEXCL,
+    TryExtractCASLH_C32_LDSTEXCL,
+    TryExtractADCS_32_ADDSUB_CARRY,
+    TryExtractADCS_64_ADDSUB_CARRY,
+    TryExtractFRINTZ_H_FLOATDP1,
+    TryExtractFRINTZ_S_FLOATDP1,
+    TryExtractFRINTZ_D_FLOATDP1,
+    TryExtractSCVTF_H32_FLOAT2FIX,
+    TryExtractSCVTF_S32_FLOAT2FIX,
+    TryExtractSCVTF_D32_FLOAT2FIX,
+    TryExtractSCVTF_H64_FLOAT2FIX,
+    TryExtractSCVTF_S64_FLOAT2FIX,
+    TryExtractSCVTF_D64_FLOAT2FIX,
+    TryExtractSQDMLAL_ASISDELEM_L,
+    TryExtractSQDMLAL_ASIMDELEM_L,
+    TryExtractSHL_ASISDSHF_R,
+    TryExtractSHL_ASIMDSHF_R,
+    TryExtractLD2_ASISDLSE_R2,
+    TryExtractLD2_ASISDLSEP_I2_I,
+    TryExtractLD2_ASISDLSEP_R2_R,
+    TryExtractSBFM_32M_BITFIELD,
+    TryExtractSBFM_64M_BITFIELD,
+    TryExtractFMAXV_ASIMDALL_ONLY_H,
+    TryExtractFMAXV_ASIMDALL_ONLY_SD,
+    TryExtractSTADDB_32S_MEMOP,
+    TryExtractSTADDLB_32S_MEMOP,
+    TryExtractSTUMAX_32S_MEMOP,
+    TryExtractSTUMAXL_32S_MEMOP,
+    TryExtractSTUMAX_64S_MEMOP,
+    TryExtractSTUMAXL_64S_MEMOP,
+    TryExtractSQDMULH_ASISDELEM_R,
+    TryExtractSQDMULH_ASIMDELEM_R,
+    TryExtractFRSQRTE_ASISDMISCFP16_R,
+    TryExtractFRSQRTE_ASISDMISC_R,
+    TryExtractFRSQRTE_ASIMDMISCFP16_R,
+    TryExtractFRSQRTE_ASIMDMISC_R,
+    TryExtractADD_ASISDSAME_ONLY,
+    TryExtractADD_ASIMDSAME_ONLY,
+    TryExtractSABDL_ASIMDDIFF_L,
+    TryExtractUCVTF_H32_FLOAT2INT,
+    TryExtractUCVTF_S32_FLOAT2INT,
+    TryExtractUCVTF_D32_FLOAT2INT,
+    TryExtractUCVTF_H64_FLOAT2INT,
+    TryExtractUCVTF_S64_FLOAT2INT,
+    TryExtractUCVTF_D64_FLOAT2INT,
+    TryExtractUCVTF_H32_FLOAT2FIX,
+    TryExtractUCVTF_S32_FLOAT2FIX,
+    TryExtractUCVTF_D32_FLOAT2FIX,
+    TryExtractUCVTF_H64_FLOAT2FIX,
+    TryExtractUCVTF_S64_FLOAT2FIX,
+    TryExtractUCVTF_D64_FLOAT2FIX,
+    TryExtractMOVI_ASIMDIMM_N_B,
+    TryExtractMOVI_ASIMDIMM_L_HL,
+    TryExtractMOVI_ASIMDIMM_L_SL,
+    TryExtractMOVI_ASIMDIMM_M_SM,
+    TryExtractMOVI_ASIMDIMM_D_DS,
+    TryExtractMOVI_ASIMDIMM_D2_D,
+    TryExtractREV16_32_DP_1SRC,
+    TryExtractREV16_64_DP_1SRC,
+    TryExtractSQRDMLAH_ASISDELEM_R,
+    TryExtractSQRDMLAH_ASIMDELEM_R,
+    TryExtractFMAXP_ASISDPAIR_ONLY_H,
+    TryExtractFMAXP_ASISDPAIR_ONLY_SD,
+    TryExtractBIF_ASIMDSAME_ONLY,
+    TryExtractFCMLE_ASISDMISCFP16_FZ,
+    TryExtractFCMLE_ASISDMISC_FZ,
+    TryExtractFCMLE_ASIMDMISCFP16_FZ,
+    TryExtractFCMLE_ASIMDMISC_FZ,
+    TryExtractDRPS_64E_BRANCH_REG,
+    TryExtractSLI_ASISDSHF_R,
+    TryExtractSLI_ASIMDSHF_R,
+    TryExtractLDAXRH_LR32_LDSTEXCL,
+    TryExtractLDADDAB_32_MEMOP,
+    TryExtractLDADDALB_32_MEMOP,
+    TryExtractLDADDB_32_MEMOP,
+    TryExtractLDADDLB_32_MEMOP,
+    TryExtractLDRH_32_LDST_IMMPOST,
+    TryExtractLDRH_32_LDST_IMMPRE,
+    TryExtractLDRH_32_LDST_POS,
+    TryExtractERET_64E_BRANCH_REG,
+    TryExtractSTUMIN_32S_MEMOP,
+    TryExtractSTUMINL_32S_MEMOP,
+    TryExtractSTUMIN_64S_MEMOP,
+    TryExtractSTUMINL_64S_MEMOP,
+    TryExtractSHA1SU1_VV_CRYPTOSHA2,
+    TryExtractLD1_ASISDLSE_R1_1V,
+    TryExtractLD1_ASISDLSE_R2_2V,
+    TryExtractLD1_ASISDLSE_R3_3V,
+    TryExtractLD1_ASISDLSE_R4_4V,
+    TryExtractLD1_ASISDLSEP_I1_I1,
+    TryExtractLD1_ASISDLSEP_R1_R1,
+    TryExtractLD1_ASISDLSEP_I2_I2,
+    TryExtractLD1_ASISDLSEP_R2_R2,
+    TryExtractLD1_ASISDLSEP_I3_I3,
+    TryExtractLD1_ASISDLSEP_R3_R3,
+    TryExtractLD1_ASISDLSEP_I4_I4,
+    TryExtractLD1_ASISDLSEP_R4_R4,
+    TryExtractSHA1H_SS_CRYPTOSHA2,
+    TryExtractFRINTM_ASIMDMISCFP16_R,
+    TryExtractFRINTM_ASIMDMISC_R,
+    TryExtractSTURH_32_LDST_UNSCALED,
+    TryExtractSQSHLU_ASISDSHF_R,
+    TryExtractSQSHLU_ASIMDSHF_R,
+    TryExtractUMULL_ASIMDELEM_L,
+    TryExtractNOT_ASIMDMISC_R,
+    TryExtractLDR_B_LDST_IMMPOST,
+    TryExtractLDR_H_LDST_IMMPOST,
+    TryExtractLDR_S_LDST_IMMPOST,
+    TryExtractLDR_D_LDST_IMMPOST,
+    TryExtractLDR_Q_LDST_IMMPOST,
+    TryExtractLDR_B_LDST_IMMPRE,
+    TryExtractLDR_H_LDST_IMMPRE,
+    TryExtractLDR_S_LDST_IMMPRE,
+    TryExtractLDR_D_LDST_IMMPRE,
+    TryExtractLDR_Q_LDST_IMMPRE,
+    TryExtractLDR_B_LDST_POS,
+    TryExtractLDR_H_LDST_POS,
+    TryExtractLDR_S_LDST_POS,
+    TryExtractLDR_D_LDST_POS,
+    TryExtractLDR_Q_LDST_POS,
+    TryExtractSWPAB_32_MEMOP,
+    TryExtractSWPALB_32_MEMOP,
+    TryExtractSWPB_32_MEMOP,
+    TryExtractSWPLB_32_MEMOP,
+    TryExtractFMOV_ASIMDIMM_H_H,
+    TryExtractFMOV_ASIMDIMM_S_S,
+    TryExtractFMOV_ASIMDIMM_D2_D,
+    TryExtractFMIN_ASIMDSAMEFP16_ONLY,
+    TryExtractFMIN_ASIMDSAME_ONLY,
+    TryExtractSQXTUN_ASISDMISC_N,
+    TryExtractSQXTUN_ASIMDMISC_N,
+    TryExtractLDEORAB_32_MEMOP,
+    TryExtractLDEORALB_32_MEMOP,
+    TryExtractLDEORB_32_MEMOP,
+    TryExtractLDEORLB_32_MEMOP,
+    TryExtractFCVTPS_ASISDMISCFP16_R,
+    TryExtractFCVTPS_ASISDMISC_R,
+    TryExtractFCVTPS_ASIMDMISCFP16_R,
+    TryExtractFCVTPS_ASIMDMISC_R,
+    TryExtractLDR_S_LOADLIT,
+    TryExtractLDR_D_LOADLIT,
+    TryExtractLDR_Q_LOADLIT,
+    TryExtractFRINTP_ASIMDMISCFP16_R,
+    TryExtractFRINTP_ASIMDMISC_R,
+    TryExtractLDLARB_LR32_LDSTEXCL,
+    TryExtractFNEG_ASIMDMISCFP16_R,
+    TryExtractFNEG_ASIMDMISC_R,
+    TryExtractADDHN_ASIMDDIFF_N,
+    TryExtractLDNP_32_LDSTNAPAIR_OFFS,
+    TryExtractLDNP_64_LDSTNAPAIR_OFFS,
+    TryExtractSQRSHRN_ASISDSHF_N,
+    TryExtractSQRSHRN_ASIMDSHF_N,
+    TryExtractCMGT_ASISDSAME_ONLY,
+    TryExtractCMGT_ASIMDSAME_ONLY,
+    TryExtractST4_ASISDLSE_R4,
+    TryExtractST4_ASISDLSEP_I4_I,
+    TryExtractST4_ASISDLSEP_R4_R,
+    TryExtractASRV_32_DP_2SRC,
+    TryExtractASRV_64_DP_2SRC,
+    TryExtractUHSUB_ASIMDSAME_ONLY,
+    TryExtractCMHS_ASISDSAME_ONLY,
+    TryExtractCMHS_ASIMDSAME_ONLY,
+    TryExtractMOVZ_32_MOVEWIDE,
+    TryExtractMOVZ_64_MOVEWIDE,
+    TryExtractSADDW_ASIMDDIFF_W,
+    TryExtractSADDLP_ASIMDMISC_P,
+    TryExtractST2_ASISDLSE_R2,
+    TryExtractST2_ASISDLSEP_I2_I,
+    TryExtractST2_ASISDLSEP_R2_R,
+    TryExtractLDSMINA_32_MEMOP,
+    TryExtractLDSMINAL_32_MEMOP,
+    TryExtractLDSMIN_32_MEMOP,
+    TryExtractLDSMINL_32_MEMOP,
+    TryExtractLDSMINA_64_MEMOP,
+    TryExtractLDSMINAL_64_MEMOP,
+    TryExtractLDSMIN_64_MEMOP,
+    TryExtractLDSMINL_64_MEMOP,
+    TryExtractPSB_HC_SYSTEM,
+    TryExtractFMUL_ASISDELEM_RH_H,
+    TryExtractFMUL_ASISDELEM_R_SD,
+    TryExtractFMUL_ASIMDELEM_RH_H,
+    TryExtractFMUL_ASIMDELEM_R_SD,
+    TryExtractSHADD_ASIMDSAME_ONLY,
+    TryExtractFMINP_ASISDPAIR_ONLY_H,
+    TryExtractFMINP_ASISDPAIR_ONLY_SD,
+    TryExtractREV64_ASIMDMISC_R,
+    TryExtractSSUBW_ASIMDDIFF_W,
+    TryExtractMLS_ASIMDELEM_R,
+    TryExtractSQDMLSL_ASISDELEM_L,
+    TryExtractSQDMLSL_ASIMDELEM_L,
+    TryExtractCSINV_32_CONDSEL,
+    TryExtractCSINV_64_CONDSEL,
+    TryExtractFCVTZU_ASISDSHF_C,
+    TryExtractFCVTZU_ASIMDSHF_C,
+    TryExtractSSHL_ASISDSAME_ONLY,
+    TryExtractSSHL_ASIMDSAME_ONLY,
+    TryExtractSSRA_ASISDSHF_R,
+    TryExtractSSRA_ASIMDSHF_R,
+    TryExtractLDRSW_64_LDST_REGOFF,
+    TryExtractSQSHL_ASISDSAME_ONLY,
+    TryExtractSQSHL_ASIMDSAME_ONLY,
+    TryExtractADDV_ASIMDALL_ONLY,
+    TryExtractPMUL_ASIMDSAME_ONLY,
+    TryExtractSMLSL_ASIMDELEM_L,
+    TryExtractFCMP_H_FLOATCMP,
+    TryExtractFCMP_HZ_FLOATCMP,
+    TryExtractFCMP_S_FLOATCMP,
+    TryExtractFCMP_SZ_FLOATCMP,
+    TryExtractFCMP_D_FLOATCMP,
+    TryExtractFCMP_DZ_FLOATCMP,
+    TryExtractORR_32_LOG_SHIFT,
+    TryExtractORR_64_LOG_SHIFT,
+    TryExtractSHA1SU0_VVV_CRYPTOSHA3,
+    TryExtractSTSET_32S_MEMOP,
+    TryExtractSTSETL_32S_MEMOP,
+    TryExtractSTSET_64S_MEMOP,
+    TryExtractSTSETL_64S_MEMOP,
+    TryExtractMLA_ASIMDSAME_ONLY,
+    TryExtractADDS_32_ADDSUB_SHIFT,
+    TryExtractADDS_64_ADDSUB_SHIFT,
+    TryExtractLD3R_ASISDLSO_R3,
+    TryExtractLD3R_ASISDLSOP_R3_I,
+    TryExtractLD3R_ASISDLSOP_RX3_R,
+    TryExtractPRFM_P_LOADLIT,
+    TryExtractCASAB_C32_LDSTEXCL,
+    TryExtractCASALB_C32_LDSTEXCL,
+    TryExtractCASB_C32_LDSTEXCL,
+    TryExtractCASLB_C32_LDSTEXCL,
+    TryExtractLDSMAXAH_32_MEMOP,
+    TryExtractLDSMAXALH_32_MEMOP,
+    TryExtractLDSMAXH_32_MEMOP,
+    TryExtractLDSMAXLH_32_MEMOP,
+    TryExtractMSUB_32A_DP_3SRC,
+    TryExtractMSUB_64A_DP_3SRC,
+    TryExtractLD4_ASISDLSE_R4,
+    TryExtractLD4_ASISDLSEP_I4_I,
+    TryExtractLD4_ASISDLSEP_R4_R,
+    TryExtractUQXTN_ASISDMISC_N,
+    TryExtractUQXTN_ASIMDMISC_N,
+    TryExtractTBZ_ONLY_TESTBRANCH,
+    TryExtractFMINNMV_ASIMDALL_ONLY_H,
+    TryExtractFMINNMV_ASIMDALL_ONLY_SD,
+    TryExtractFCVTZS_ASISDMISCFP16_R,
+    TryExtractFCVTZS_ASISDMISC_R,
+    TryExtractFCVTZS_ASIMDMISCFP16_R,
+    TryExtractFCVTZS_ASIMDMISC_R,
+    TryExtractFMAXNM_H_FLOATDP2,
+    TryExtractFMAXNM_S_FLOATDP2,
+    TryExtractFMAXNM_D_FLOATDP2,
+    TryExtractLDR_32_LDST_IMMPOST,
+    TryExtractLDR_64_LDST_IMMPOST,
+    TryExtractLDR_32_LDST_IMMPRE,
+    TryExtractLDR_64_LDST_IMMPRE,
+    TryExtractLDR_32_LDST_POS,
+    TryExtractLDR_64_LDST_POS,
+    TryExtractCNT_ASIMDMISC_R,
+    TryExtractSQSHL_ASISDSHF_R,
+    TryExtractSQSHL_ASIMDSHF_R,
+    TryExtractLDTR_32_LDST_UNPRIV,
+    TryExtractLDTR_64_LDST_UNPRIV,
+    TryExtractCCMP_32_CONDCMP_IMM,
+    TryExtractCCMP_64_CONDCMP_IMM,
+    TryExtractUZP2_ASIMDPERM_ONLY,
+    TryExtractLDURB_32_LDST_UNSCALED,
+    TryExtractSQRDMLSH_ASISDSAME2_ONLY,
+    TryExtractSQRDMLSH_ASIMDSAME2_ONLY,
+    TryExtractLDTRSB_32_LDST_UNPRIV,
+    TryExtractLDTRSB_64_LDST_UNPRIV,
+    TryExtractSMINV_ASIMDALL_ONLY,
+    TryExtractURHADD_ASIMDSAME_ONLY,
+    TryExtractAND_32_LOG_IMM,
+    TryExtractAND_64_LOG_IMM,
+    TryExtractSABD_ASIMDSAME_ONLY,
+    TryExtractFCMGE_ASISDSAMEFP16_ONLY,
+    TryExtractFCMGE_ASISDSAME_ONLY,
+    TryExtractFCMGE_ASIMDSAMEFP16_ONLY,
+    TryExtractFCMGE_ASIMDSAME_ONLY,
+    TryExtractSTSMIN_32S_MEMOP,
+    TryExtractSTSMINL_32S_MEMOP,
+    TryExtractSTSMIN_64S_MEMOP,
+    TryExtractSTSMINL_64S_MEMOP,
+    TryExtractTRN1_ASIMDPERM_ONLY,
+    TryExtractSBCS_32_ADDSUB_CARRY,
+    TryExtractSBCS_64_ADDSUB_CARRY,
+    TryExtractSMULL_ASIMDDIFF_L,
+    TryExtractLSRV_32_DP_2SRC,
+    TryExtractLSRV_64_DP_2SRC,
+    TryExtractURSQRTE_ASIMDMISC_R,
+    TryExtractFCCMPE_H_FLOATCCMP,
+    TryExtractFCCMPE_S_FLOATCCMP,
+    TryExtractFCCMPE_D_FLOATCCMP,
+    TryExtractFMAXP_ASIMDSAMEFP16_ONLY,
+    TryExtractFMAXP_ASIMDSAME_ONLY,
+    TryExtractSTTR_32_LDST_UNPRIV,
+    TryExtractSTTR_64_LDST_UNPRIV,
+    TryExtractFCMGT_ASISDMISCFP16_FZ,
+    TryExtractFCMGT_ASISDMISC_FZ,
+    TryExtractFCMGT_ASIMDMISCFP16_FZ,
+    TryExtractFCMGT_ASIMDMISC_FZ,
+    TryExtractBSL_ASIMDSAME_ONLY,
+    TryExtractUQSUB_ASISDSAME_ONLY,
+    TryExtractUQSUB_ASIMDSAME_ONLY,
+    TryExtractWFI_HI_SYSTEM,
+    TryExtractLDXRH_LR32_LDSTEXCL,
+    TryExtractFMAXNMV_ASIMDALL_ONLY_H,
+    TryExtractFMAXNMV_ASIMDALL_ONLY_SD,
+    TryExtractSTLXR_SR32_LDSTEXCL,
+    TryExtractSTLXR_SR64_LDSTEXCL,
+    TryExtractSTLRB_SL32_LDSTEXCL,
+    TryExtractST3_ASISDLSE_R3,
+    TryExtractST3_ASISDLSEP_I3_I,
+    TryExtractST3_ASISDLSEP_R3_R,
+    TryExtractSQRDMULH_ASISDELEM_R,
+    TryExtractSQRDMULH_ASIMDELEM_R,
+    TryExtractUSHR_ASISDSHF_R,
+    TryExtractUSHR_ASIMDSHF_R,
+    TryExtractB_ONLY_BRANCH_IMM,
+    TryExtractFCMEQ_ASISDMISCFP16_FZ,
+    TryExtractFCMEQ_ASISDMISC_FZ,
+    TryExtractFCMEQ_ASIMDMISCFP16_FZ,
+    TryExtractFCMEQ_ASIMDMISC_FZ,
+    TryExtractFACGE_ASISDSAMEFP16_ONLY,
+    TryExtractFACGE_ASISDSAME_ONLY,
+    TryExtractFACGE_ASIMDSAMEFP16_ONLY,
+    TryExtractFACGE_ASIMDSAME_ONLY,
+    TryExtractCSEL_32_CONDSEL,
+    TryExtractCSEL_64_CONDSEL,
+    TryExtractFCVTAS_32H_FLOAT2INT,
+    TryExtractFCVTAS_64H_FLOAT2INT,
+    TryExtractFCVTAS_32S_FLOAT2INT,
+    TryExtractFCVTAS_64S_FLOAT2INT,
+    TryExtractFCVTAS_32D_FLOAT2INT,
+    TryExtractFCVTAS_64D_FLOAT2INT,
+    TryExtractLDURSH_32_LDST_UNSCALED,
+    TryExtractLDURSH_64_LDST_UNSCALED,
+    TryExtractLDURSW_64_LDST_UNSCALED,
+    TryExtractMOVN_32_MOVEWIDE,
+    TryExtractMOVN_64_MOVEWIDE,
+    TryExtractST1_ASISDLSO_B1_1B,
+    TryExtractST1_ASISDLSO_H1_1H,
+    TryExtractST1_ASISDLSO_S1_1S,
+    TryExtractST1_ASISDLSO_D1_1D,
+    TryExtractST1_ASISDLSOP_B1_I1B,
+    TryExtractST1_ASISDLSOP_BX1_R1B,
+    TryExtractST1_ASISDLSOP_H1_I1H,
+    TryExtractST1_ASISDLSOP_HX1_R1H,
+    TryExtractST1_ASISDLSOP_S1_I1S,
+    TryExtractST1_ASISDLSOP_SX1_R1S,
+    TryExtractST1_ASISDLSOP_D1_I1D,
+    TryExtractST1_ASISDLSOP_DX1_R1D,
+    TryExtractUZP1_ASIMDPERM_ONLY,
+    TryExtractSTUR_B_LDST_UNSCALED,
+    TryExtractSTUR_H_LDST_UNSCALED,
+    TryExtractSTUR_S_LDST_UNSCALED,
+    TryExtractSTUR_D_LDST_UNSCALED,
+    TryExtractSTUR_Q_LDST_UNSCALED,
+    TryExtractMLA_ASIMDELEM_R,
+    TryExtractFCVTPU_32H_FLOAT2INT,
+    TryExtractFCVTPU_64H_FLOAT2INT,
+    TryExtractFCVTPU_32S_FLOAT2INT,
+    TryExtractFCVTPU_64S_FLOAT2INT,
+    TryExtractFCVTPU_32D_FLOAT2INT,
+    TryExtractFCVTPU_64D_FLOAT2INT,
+    TryExtractSTSETH_32S_MEMOP,
+    TryExtractSTSETLH_32S_MEMOP,
+    TryExtractFMINV_ASIMDALL_ONLY_H,
+    TryExtractFMINV_ASIMDALL_ONLY_SD,
+    TryExtractDSB_BO_SYSTEM,
+    TryExtractFCVTMS_32H_FLOAT2INT,
+    TryExtractFCVTMS_64H_FLOAT2INT,
+    TryExtractFCVTMS_32S_FLOAT2INT,
+    TryExtractFCVTMS_64S_FLOAT2INT,
+    TryExtractFCVTMS_32D_FLOAT2INT,
+    TryExtractFCVTMS_64D_FLOAT2INT,
+    TryExtractSTSMINH_32S_MEMOP,
+    TryExtractSTSMINLH_32S_MEMOP,
+    TryExtractST4_ASISDLSO_B4_4B,
+    TryExtractST4_ASISDLSO_H4_4H,
+    TryExtractST4_ASISDLSO_S4_4S,
+    TryExtractST4_ASISDLSO_D4_4D,
+    TryExtractST4_ASISDLSOP_B4_I4B,
+    TryExtractST4_ASISDLSOP_BX4_R4B,
+    TryExtractST4_ASISDLSOP_H4_I4H,
+    TryExtractST4_ASISDLSOP_HX4_R4H,
+    TryExtractST4_ASISDLSOP_S4_I4S,
+    TryExtractST4_ASISDLSOP_SX4_R4S,
+    TryExtractST4_ASISDLSOP_D4_I4D,
+    TryExtractST4_ASISDLSOP_DX4_R4D,
+    TryExtractLDNP_S_LDSTNAPAIR_OFFS,
+    TryExtractLDNP_D_LDSTNAPAIR_OFFS,
+    TryExtractLDNP_Q_LDSTNAPAIR_OFFS,
+    TryExtractADDS_32S_ADDSUB_EXT,
+    TryExtractADDS_64S_ADDSUB_EXT,
+    TryExtractCBZ_32_COMPBRANCH,
+    TryExtractCBZ_64_COMPBRANCH,
+    TryExtractURSHL_ASISDSAME_ONLY,
+    TryExtractURSHL_ASIMDSAME_ONLY,
+    TryExtractSQRSHRUN_ASISDSHF_N,
+    TryExtractSQRSHRUN_ASIMDSHF_N,
+    TryExtractFRINTI_ASIMDMISCFP16_R,
+    TryExtractFRINTI_ASIMDMISC_R,
+    TryExtractLDXRB_LR32_LDSTEXCL,
+    TryExtractSTP_S_LDSTPAIR_POST,
+    TryExtractSTP_D_LDSTPAIR_POST,
+    TryExtractSTP_Q_LDSTPAIR_POST,
+    TryExtractSTP_S_LDSTPAIR_PRE,
+    TryExtractSTP_D_LDSTPAIR_PRE,
+    TryExtractSTP_Q_LDSTPAIR_PRE,
+    TryExtractSTP_S_LDSTPAIR_OFF,
+    TryExtractSTP_D_LDSTPAIR_OFF,
+    TryExtractSTP_Q_LDSTPAIR_OFF,
+    TryExtractADR_ONLY_PCRELADDR,
+    TryExtractLDSMINAB_32_MEMOP,
+    TryExtractLDSMINALB_32_MEMOP,
+    TryExtractLDSMINB_32_MEMOP,
+    TryExtractLDSMINLB_32_MEMOP,
+    TryExtractLD4_ASISDLSO_B4_4B,
+    TryExtractLD4_ASISDLSO_H4_4H,
+    TryExtractLD4_ASISDLSO_S4_4S,
+    TryExtractLD4_ASISDLSO_D4_4D,
+    TryExtractLD4_ASISDLSOP_B4_I4B,
+    TryExtractLD4_ASISDLSOP_BX4_R4B,
+    TryExtractLD4_ASISDLSOP_H4_I4H,
+    TryExtractLD4_ASISDLSOP_HX4_R4H,
+    TryExtractLD4_ASISDLSOP_S4_I4S,
+    TryExtractLD4_ASISDLSOP_SX4_R4S,
+    TryExtractLD4_ASISDLSOP_D4_I4D,
+    TryExtractLD4_ASISDLSOP_DX4_R4D,
+    TryExtractSTRB_32B_LDST_REGOFF,
+    TryExtractSTRB_32BL_LDST_REGOFF,
+    TryExtractUMAX_ASIMDSAME_ONLY,
+    TryExtractCRC32B_32C_DP_2SRC,
+    TryExtractCRC32H_32C_DP_2SRC,
+    TryExtractCRC32W_32C_DP_2SRC,
+    TryExtractCRC32X_64C_DP_2SRC,
+    TryExtractURSHR_ASISDSHF_R,
+    TryExtractURSHR_ASIMDSHF_R,
+    TryExtractPRFM_P_LDST_POS,
+    TryExtractSUBS_32S_ADDSUB_IMM,
+    TryExtractSUBS_64S_ADDSUB_IMM,
+    TryExtractSUBS_32S_ADDSUB_EXT,
+    TryExtractSUBS_64S_ADDSUB_EXT,
+    TryExtractSYSL_RC_SYSTEM,
+    TryExtractSMSUBL_64WA_DP_3SRC,
+    TryExtractURSRA_ASISDSHF_R,
+    TryExtractURSRA_ASIMDSHF_R,
+    TryExtractLDURH_32_LDST_UNSCALED,
+    TryExtractSUB_32_ADDSUB_SHIFT,
+    TryExtractSUB_64_ADDSUB_SHIFT,
+    TryExtractSRI_ASISDSHF_R,
+    TryExtractSRI_ASIMDSHF_R,
+    TryExtractUMAXP_ASIMDSAME_ONLY,
+    TryExtractLDTRSH_32_LDST_UNPRIV,
+    TryExtractLDTRSH_64_LDST_UNPRIV,
+    TryExtractSADALP_ASIMDMISC_P,
+    TryExtractLDTRH_32_LDST_UNPRIV,
+    TryExtractSMAX_ASIMDSAME_ONLY,
+    TryExtractFCVTPU_ASISDMISCFP16_R,
+    TryExtractFCVTPU_ASISDMISC_R,
+    TryExtractFCVTPU_ASIMDMISCFP16_R,
+    TryExtractFCVTPU_ASIMDMISC_R,
+    TryExtractRET_64R_BRANCH_REG,
+    TryExtractUQRSHL_ASISDSAME_ONLY,
+    TryExtractUQRSHL_ASIMDSAME_ONLY,
+    TryExtractLDRB_32_LDST_IMMPOST,
+    TryExtractLDRB_32_LDST_IMMPRE,
+    TryExtractLDRB_32_LDST_POS,
+    TryExtractFCVTXN_ASISDMISC_N,
+    TryExtractFCVTXN_ASIMDMISC_N,
+    TryExtractMSR_SI_SYSTEM,
+    TryExtractUABDL_ASIMDDIFF_L,
+    TryExtractMSR_SR_SYSTEM,
+    TryExtractLDRH_32_LDST_REGOFF,
+    TryExtractUQSHL_ASISDSHF_R,
+    TryExtractUQSHL_ASIMDSHF_R,
+    TryExtractFMINNMP_ASISDPAIR_ONLY_H,
+    TryExtractFMINNMP_ASISDPAIR_ONLY_SD,
+    TryExtractUMADDL_64WA_DP_3SRC,
+    TryExtractFMOV_H_FLOATDP1,
+    TryExtractFMOV_S_FLOATDP1,
+    TryExtractFMOV_D_FLOATDP1,
+    TryExtractSRHADD_ASIMDSAME_ONLY,
+    TryExtractUMSUBL_64WA_DP_3SRC,
+    TryExtractFCVTMU_32H_FLOAT2INT,
+    TryExtractFCVTMU_64H_FLOAT2INT,
+    TryExtractFCVTMU_32S_FLOAT2INT,
+    TryExtractFCVTMU_64S_FLOAT2INT,
+    TryExtractFCVTMU_32D_FLOAT2INT,
+    TryExtractFCVTMU_64D_FLOAT2INT,
+    TryExtractLDP_S_LDSTPAIR_POST,
+    TryExtractLDP_D_LDSTPAIR_POST,
+    TryExtractLDP_Q_LDSTPAIR_POST,
+    TryExtractLDP_S_LDSTPAIR_PRE,
+    TryExtractLDP_D_LDSTPAIR_PRE,
+    TryExtractLDP_Q_LDSTPAIR_PRE,
+    TryExtractLDP_S_LDSTPAIR_OFF,
+    TryExtractLDP_D_LDSTPAIR_OFF,
+    TryExtractLDP_Q_LDSTPAIR_OFF,
+    TryExtractSBC_32_ADDSUB_CARRY,
+    TryExtractSBC_64_ADDSUB_CARRY,
+    TryExtractFCVTZU_32H_FLOAT2INT,
+    TryExtractFCVTZU_64H_FLOAT2INT,
+    TryExtractFCVTZU_32S_FLOAT2INT,
+    TryExtractFCVTZU_64S_FLOAT2INT,
+    TryExtractFCVTZU_32D_FLOAT2INT,
+    TryExtractFCVTZU_64D_FLOAT2INT,
+    TryExtractSTR_32_LDST_REGOFF,
+    TryExtractSTR_64_LDST_REGOFF,
+    TryExtractFDIV_H_FLOATDP2,
+    TryExtractFDIV_S_FLOATDP2,
+    TryExtractFDIV_D_FLOATDP2,
+    TryExtractURECPE_ASIMDMISC_R,
+    TryExtractISB_BI_SYSTEM,
+    TryExtractRSUBHN_ASIMDDIFF_N,
+    TryExtractSMULL_ASIMDELEM_L,
+    TryExtractSUQADD_ASISDMISC_R,
+    TryExtractSUQADD_ASIMDMISC_R,
+    TryExtractLDRSH_32_LDST_REGOFF,
+    TryExtractLDRSH_64_LDST_REGOFF,
+    TryExtractADRP_ONLY_PCRELADDR,
+    TryExtractDUP_ASIMDINS_DR_R,
+    TryExtractFABS_H_FLOATDP1,
+    TryExtractFABS_S_FLOATDP1,
+    TryExtractFABS_D_FLOATDP1,
+    TryExtractREV32_ASIMDMISC_R,
+    TryExtractUQRSHRN_ASISDSHF_N,
+    TryExtractUQRSHRN_ASIMDSHF_N,
+    TryExtractUBFM_32M_BITFIELD,
+    TryExtractUBFM_64M_BITFIELD,
+    TryExtractSTNP_32_LDSTNAPAIR_OFFS,
+    TryExtractSTNP_64_LDSTNAPAIR_OFFS,
+    TryExtractLDARB_LR32_LDSTEXCL,
+    TryExtractSRSRA_ASISDSHF_R,
+    TryExtractSRSRA_ASIMDSHF_R,
+    TryExtractCMGE_ASISDSAME_ONLY,
+    TryExtractCMGE_ASIMDSAME_ONLY,
+    TryExtractFADD_ASIMDSAMEFP16_ONLY,
+    TryExtractFADD_ASIMDSAME_ONLY,
+    TryExtractSQRDMLAH_ASISDSAME2_ONLY,
+    TryExtractSQRDMLAH_ASIMDSAME2_ONLY,
+    TryExtractORN_ASIMDSAME_ONLY,
+    TryExtractSTSETB_32S_MEMOP,
+    TryExtractSTSETLB_32S_MEMOP,
+    TryExtractADC_32_ADDSUB_CARRY,
+    TryExtractADC_64_ADDSUB_CARRY,
+    TryExtractLD2R_ASISDLSO_R2,
+    TryExtractLD2R_ASISDLSOP_R2_I,
+    TryExtractLD2R_ASISDLSOP_RX2_R,
+    TryExtractCSINC_32_CONDSEL,
+    TryExtractCSINC_64_CONDSEL,
+    TryExtractFMLS_ASISDELEM_RH_H,
+    TryExtractFMLS_ASISDELEM_R_SD,
+    TryExtractFMLS_ASIMDELEM_RH_H,
+    TryExtractFMLS_ASIMDELEM_R_SD,
+    TryExtractSHA256H2_QQV_CRYPTOSHA3,
+    TryExtractRBIT_ASIMDMISC_R,
+    TryExtractRSHRN_ASIMDSHF_N,
+    TryExtractUMOV_ASIMDINS_W_W,
+    TryExtractUMOV_ASIMDINS_X_X,
+    TryExtractFCVTZS_32H_FLOAT2INT,
+    TryExtractFCVTZS_64H_FLOAT2INT,
+    TryExtractFCVTZS_32S_FLOAT2INT,
+    TryExtractFCVTZS_64S_FLOAT2INT,
+    TryExtractFCVTZS_32D_FLOAT2INT,
+    TryExtractFCVTZS_64D_FLOAT2INT,
+    TryExtractNOP_HI_SYSTEM,
+    TryExtractFCVTMS_ASISDMISCFP16_R,
+    TryExtractFCVTMS_ASISDMISC_R,
+    TryExtractFCVTMS_ASIMDMISCFP16_R,
+    TryExtractFCVTMS_ASIMDMISC_R,
+    TryExtractFRINTA_H_FLOATDP1,
+    TryExtractFRINTA_S_FLOATDP1,
+    TryExtractFRINTA_D_FLOATDP1,
+    TryExtractFCSEL_H_FLOATSEL,
+    TryExtractFCSEL_S_FLOATSEL,
+    TryExtractFCSEL_D_FLOATSEL,
+    TryExtractSUBHN_ASIMDDIFF_N,
+    TryExtractLDRSB_32_LDST_IMMPOST,
+    TryExtractLDRSB_64_LDST_IMMPOST,
+    TryExtractLDRSB_32_LDST_IMMPRE,
+    TryExtractLDRSB_64_LDST_IMMPRE,
+    TryExtractLDRSB_32_LDST_POS,
+    TryExtractLDRSB_64_LDST_POS,
+    TryExtractFACGT_ASISDSAMEFP16_ONLY,
+    TryExtractFACGT_ASISDSAME_ONLY,
+    TryExtractFACGT_ASIMDSAMEFP16_ONLY,
+    TryExtractFACGT_ASIMDSAME_ONLY,
+    TryExtractNEG_ASISDMISC_R,
+    TryExtractNEG_ASIMDMISC_R,
+    TryExtractUMLAL_ASIMDDIFF_L,
+    TryExtractREV16_ASIMDMISC_R,
+    TryExtractPMULL_ASIMDDIFF_L,
+    TryExtractFMLS_ASIMDSAMEFP16_ONLY,
+    TryExtractFMLS_ASIMDSAME_ONLY,
+    TryExtractEOR_32_LOG_SHIFT,
+    TryExtractEOR_64_LOG_SHIFT,
+    TryExtractLDSMAXA_32_MEMOP,
+    TryExtractLDSMAXAL_32_MEMOP,
+    TryExtractLDSMAX_32_MEMOP,
+    TryExtractLDSMAXL_32_MEMOP,
+    TryExtractLDSMAXA_64_MEMOP,
+    TryExtractLDSMAXAL_64_MEMOP,
+    TryExtractLDSMAX_64_MEMOP,
+    TryExtractLDSMAXL_64_MEMOP,
+    TryExtractSYS_CR_SYSTEM,
+    TryExtractSQABS_ASISDMISC_R,
+    TryExtractSQABS_ASIMDMISC_R,
+    TryExtractLDAR_LR32_LDSTEXCL,
+    TryExtractLDAR_LR64_LDSTEXCL,
+    TryExtractSTADDH_32S_MEMOP,
+    TryExtractSTADDLH_32S_MEMOP,
+    TryExtractLDRSW_64_LDST_IMMPOST,
+    TryExtractLDRSW_64_LDST_IMMPRE,
+    TryExtractLDRSW_64_LDST_POS,
+    TryExtractFCVTAS_ASISDMISCFP16_R,
+    TryExtractFCVTAS_ASISDMISC_R,
+    TryExtractFCVTAS_ASIMDMISCFP16_R,
+    TryExtractFCVTAS_ASIMDMISC_R,
+    TryExtractUQSHRN_ASISDSHF_N,
+    TryExtractUQSHRN_ASIMDSHF_N,
+    TryExtractEXT_ASIMDEXT_ONLY,
+    TryExtractUSHL_ASISDSAME_ONLY,
+    TryExtractUSHL_ASIMDSAME_ONLY,
+    TryExtractFADDP_ASISDPAIR_ONLY_H,
+    TryExtractFADDP_ASISDPAIR_ONLY_SD,
+    TryExtractSSHR_ASISDSHF_R,
+    TryExtractSSHR_ASIMDSHF_R,
+    TryExtractSHSUB_ASIMDSAME_ONLY,
+    TryExtractFMINNM_ASIMDSAMEFP16_ONLY,
+    TryExtractFMINNM_ASIMDSAME_ONLY,
+    TryExtractUMLSL_ASIMDDIFF_L,
+    TryExtractUSHLL_ASIMDSHF_L,
+    TryExtractSTLR_SL32_LDSTEXCL,
+    TryExtractSTLR_SL64_LDSTEXCL,
+    TryExtractEON_32_LOG_SHIFT,
+    TryExtractEON_64_LOG_SHIFT,
+    TryExtractSTSMAXB_32S_MEMOP,
+    TryExtractSTSMAXLB_32S_MEMOP,
+    TryExtractFCVTNS_32H_FLOAT2INT,
+    TryExtractFCVTNS_64H_FLOAT2INT,
+    TryExtractFCVTNS_32S_FLOAT2INT,
+    TryExtractFCVTNS_64S_FLOAT2INT,
+    TryExtractFCVTNS_32D_FLOAT2INT,
+    TryExtractFCVTNS_64D_FLOAT2INT,
+    TryExtractSQSHRN_ASISDSHF_N,
+    TryExtractSQSHRN_ASIMDSHF_N,
+    TryExtractLDTRB_32_LDST_UNPRIV,
+    TryExtractLDRSB_32B_LDST_REGOFF,
+    TryExtractLDRSB_32BL_LDST_REGOFF,
+    TryExtractLDRSB_64B_LDST_REGOFF,
+    TryExtractLDRSB_64BL_LDST_REGOFF,
+    TryExtractLDURSB_32_LDST_UNSCALED,
+    TryExtractLDURSB_64_LDST_UNSCALED,
+    TryExtractSHA256H_QQV_CRYPTOSHA3,
+    TryExtractLD4R_ASISDLSO_R4,
+    TryExtractLD4R_ASISDLSOP_R4_I,
+    TryExtractLD4R_ASISDLSOP_RX4_R,
+    TryExtractFCVTNS_ASISDMISCFP16_R,
+    TryExtractFCVTNS_ASISDMISC_R,
+    TryExtractFCVTNS_ASIMDMISCFP16_R,
+    TryExtractFCVTNS_ASIMDMISC_R,
+    TryExtractFDIV_ASIMDSAMEFP16_ONLY,
+    TryExtractFDIV_ASIMDSAME_ONLY,
+    TryExtractFRECPE_ASISDMISCFP16_R,
+    TryExtractFRECPE_ASISDMISC_R,
+    TryExtractFRECPE_ASIMDMISCFP16_R,
+    TryExtractFRECPE_ASIMDMISC_R,
+    TryExtractLD1R_ASISDLSO_R1,
+    TryExtractLD1R_ASISDLSOP_R1_I,
+    TryExtractLD1R_ASISDLSOP_RX1_R,
+    TryExtractMUL_ASIMDELEM_R,
+    TryExtractUADDLV_ASIMDALL_ONLY,
+    TryExtractFNEG_H_FLOATDP1,
+    TryExtractFNEG_S_FLOATDP1,
+    TryExtractFNEG_D_FLOATDP1,
+    TryExtractUSUBL_ASIMDDIFF_L,
+    TryExtractSHA1C_QSV_CRYPTOSHA3,
+    TryExtractSQDMLSL_ASISDDIFF_ONLY,
+    TryExtractSQDMLSL_ASIMDDIFF_L,
+    TryExtractPRFUM_P_LDST_UNSCALED,
+    TryExtractLDSMAXAB_32_MEMOP,
+    TryExtractLDSMAXALB_32_MEMOP,
+    TryExtractLDSMAXB_32_MEMOP,
+    TryExtractLDSMAXLB_32_MEMOP,
+    TryExtractFABD_ASISDSAMEFP16_ONLY,
+    TryExtractFABD_ASISDSAME_ONLY,
+    TryExtractFABD_ASIMDSAMEFP16_ONLY,
+    TryExtractFABD_ASIMDSAME_ONLY,
+    TryExtractB_ONLY_CONDBRANCH,
+    TryExtractFCVTNU_32H_FLOAT2INT,
+    TryExtractFCVTNU_64H_FLOAT2INT,
+    TryExtractFCVTNU_32S_FLOAT2INT,
+    TryExtractFCVTNU_64S_FLOAT2INT,
+    TryExtractFCVTNU_32D_FLOAT2INT,
+    TryExtractFCVTNU_64D_FLOAT2INT,
+    TryExtractMUL_ASIMDSAME_ONLY,
+    TryExtractUDIV_32_DP_2SRC,
+    TryExtractUDIV_64_DP_2SRC,
+    TryExtractCMTST_ASISDSAME_ONLY,
+    TryExtractCMTST_ASIMDSAME_ONLY,
+    TryExtractUADDL_ASIMDDIFF_L,
+    TryExtractTRN2_ASIMDPERM_ONLY,
+    TryExtractMOVK_32_MOVEWIDE,
+    TryExtractMOVK_64_MOVEWIDE,
+    TryExtractSMADDL_64WA_DP_3SRC,
+    TryExtractAND_32_LOG_SHIFT,
+    TryExtractAND_64_LOG_SHIFT,
+    TryExtractSQSHRUN_ASISDSHF_N,
+    TryExtractSQSHRUN_ASIMDSHF_N,
+    TryExtractSQDMULL_ASISDDIFF_ONLY,
+    TryExtractSQDMULL_ASIMDDIFF_L,
+    TryExtractFNMADD_H_FLOATDP3,
+    TryExtractFNMADD_S_FLOATDP3,
+    TryExtractFNMADD_D_FLOATDP3,
+    TryExtractFCCMP_H_FLOATCCMP,
+    TryExtractFCCMP_S_FLOATCCMP,
+    TryExtractFCCMP_D_FLOATCCMP,
+    TryExtractLD3_ASISDLSO_B3_3B,
+    TryExtractLD3_ASISDLSO_H3_3H,
+    TryExtractLD3_ASISDLSO_S3_3S,
+    TryExtractLD3_ASISDLSO_D3_3D,
+    TryExtractLD3_ASISDLSOP_B3_I3B,
+    TryExtractLD3_ASISDLSOP_BX3_R3B,
+    TryExtractLD3_ASISDLSOP_H3_I3H,
+    TryExtractLD3_ASISDLSOP_HX3_R3H,
+    TryExtractLD3_ASISDLSOP_S3_I3S,
+    TryExtractLD3_ASISDLSOP_SX3_R3S,
+    TryExtractLD3_ASISDLSOP_D3_I3D,
+    TryExtractLD3_ASISDLSOP_DX3_R3D,
+    TryExtractFRINTN_ASIMDMISCFP16_R,
+    TryExtractFRINTN_ASIMDMISC_R,
+    TryExtractSUB_32_ADDSUB_EXT,
+    TryExtractSUB_64_ADDSUB_EXT,
+    TryExtractSTR_B_LDST_REGOFF,
+    TryExtractSTR_BL_LDST_REGOFF,
+    TryExtractSTR_H_LDST_REGOFF,
+    TryExtractSTR_S_LDST_REGOFF,
+    TryExtractSTR_D_LDST_REGOFF,
+    TryExtractSTR_Q_LDST_REGOFF,
+    TryExtractSTP_32_LDSTPAIR_POST,
+    TryExtractSTP_64_LDSTPAIR_POST,
+    TryExtractSTP_32_LDSTPAIR_PRE,
+    TryExtractSTP_64_LDSTPAIR_PRE,
+    TryExtractSTP_32_LDSTPAIR_OFF,
+    TryExtractSTP_64_LDSTPAIR_OFF,
+    TryExtractORN_32_LOG_SHIFT,
+    TryExtractORN_64_LOG_SHIFT,
+    TryExtractLDCLRAB_32_MEMOP,
+    TryExtractLDCLRALB_32_MEMOP,
+    TryExtractLDCLRB_32_MEMOP,
+    TryExtractLDCLRLB_32_MEMOP,
+};
+
+// Runs of indices into `kExtractors`, named by the leaves of the decoder
+// automaton.
+static const uint16_t kLeafExtractors[] = {
+    1044, 1416, 609, 272, 946, 1175, 248, 250, 249, 113, 273, 947,
+    1176, 114, 97, 1139, 592, 998, 1064, 748, 317, 242, 119, 88,
+    184, 698, 890, 1255, 1166, 98, 1430, 1247, 593, 999, 1065, 749,
+    318, 243, 120, 89, 185, 699, 891, 1256, 1167, 99, 1431, 1121,
+    169, 967, 606, 1122, 170, 519, 1271, 508, 1194, 1310, 1309, 520,
+    1226, 156, 806, 42, 41, 404, 1272, 572, 981, 1341, 951, 1227,
+    573, 982, 1165, 867, 443, 843, 447, 847, 869, 445, 845, 446,
+    846, 1433, 221, 548, 1257, 876, 1467, 2, 1471, 6, 1469, 4,
+    938, 1473, 1119, 1322, 1362, 1459, 334, 552, 1168, 1434, 222, 549,
+    1258, 877, 1468, 3, 1472, 7, 1470, 5, 939, 1474, 1120, 1323,
+    1363, 1460, 335, 553, 1169, 301, 1116, 302, 1117, 303, 1118, 1130,
+    1217, 1131, 1218, 1132, 1219, 1136, 1137, 1138, 1223, 1224, 1225, 168,
+    1406, 524, 589, 1438, 1319, 1052, 1084, 579, 742, 915, 1280, 917,
+    1398, 286, 759, 580, 1281, 681, 598, 209, 349, 1189, 576, 575,
+    599, 1332, 1199, 1170, 700, 494, 17, 960, 506, 507, 1192, 1193,
+    1306, 1308, 1305, 1307, 10, 154, 155, 804, 805, 38, 40, 37,
+    39, 1054, 1277, 495, 651, 152, 568, 570, 977, 979, 1339, 1340,
+    101, 70, 632, 1325, 898, 716, 465, 314, 11, 569, 571, 978,
+    980, 668, 105, 74, 636, 1329, 902, 720, 469, 1079, 433, 1462,
+    1461, 438, 29, 833, 91, 90, 838, 1083, 437, 1466, 442, 33,
+    837, 95, 842, 868, 1353, 232, 758, 19, 916, 444, 844, 383,
+    1163, 1172, 1177, 663, 787, 96, 624, 622, 1056, 674, 1081, 435,
+    1464, 440, 31, 835, 93, 840, 1082, 436, 1465, 441, 32, 836,
+    94, 841, 472, 530, 1129, 528, 561, 531, 597, 529, 262, 954,
+    872, 952, 1036, 955, 1259, 953, 265, 534, 1031, 532, 473, 535,
+    799, 533, 474, 728, 28, 726, 714, 729, 279, 727, 182, 1034,
+    115, 224, 679, 342, 117, 526, 216, 457, 270, 455, 1360, 458,
+    1335, 456, 183, 1035, 116, 225, 680, 343, 118, 527, 217, 461,
+    271, 459, 1361, 462, 1336, 460, 1037, 336, 141, 815, 139, 813,
+    1039, 1038, 1039, 338, 337, 338, 148, 147, 148, 822, 821, 822,
+    144, 143, 144, 818, 817, 818, 1066, 392, 1067, 393, 415, 1104,
+    416, 1105, 287, 1445, 288, 1446, 1395, 948, 356, 1144, 357, 1145,
+    1273, 1382, 1071, 1070, 1071, 420, 419, 420, 292, 291, 292, 361,
+    360, 361, 1133, 1220, 1134, 1221, 1135, 1222, 397, 396, 397, 1109,
+    1108, 1109, 1450, 1449, 1450, 1149, 1148, 1149, 1073, 1072, 1073, 422,
+    421, 422, 294, 293, 294, 363, 362, 363, 399, 398, 399, 1111,
+    1110, 1111, 1452, 1451, 1452, 1151, 1150, 1151, 1397, 1396, 1397, 1275,
+    1274, 1275, 950, 949, 950, 1384, 1383, 1384, 1348, 518, 923, 1350,
+    180, 928, 245, 658, 1124, 990, 227, 1191, 1184, 1158, 355, 175,
+    237, 1000, 108, 350, 255, 643, 1317, 765, 1427, 945, 138, 1423,
+    930, 219, 1358, 181, 1179, 563, 382, 126, 707, 929, 1012, 585,
+    55, 615, 1265, 14, 241, 587, 191, 1004, 49, 1020, 750, 751,
+    642, 1390, 153, 1078, 1009, 313, 323, 889, 228, 1241, 1429, 766,
+    1198, 781, 1354, 230, 1043, 672, 925, 667, 137, 484, 381, 781,
+    233, 230, 1164, 672, 1261, 667, 1173, 781, 230, 1178, 672, 744,
+    667, 798, 931, 53, 230, 830, 672, 985, 667, 1202, 780, 77,
+    229, 1436, 1284, 1126, 908, 664, 671, 1373, 666, 1347, 879, 1254,
+    1242, 831, 780, 274, 229, 1359, 671, 666, 782, 231, 1041, 788,
+    779, 20, 783, 215, 784, 215, 853, 854, 852, 414, 921, 909,
+    665, 368, 497, 807, 796, 1197, 1053, 1276, 1424, 885, 1161, 590,
+    275, 492, 493, 109, 220, 1157, 1156, 345, 344, 1380, 995, 1378,
+    1377, 1379, 994, 1376, 1375, 918, 594, 307, 785, 34, 234, 828,
+    562, 496, 1200, 1062, 1181, 1246, 1061, 1180, 1245, 480, 1014, 1425,
+    886, 591, 276, 1162, 18, 961, 1432, 1171, 1205, 1210, 428, 1021,
+    1234, 328, 1063, 65, 926, 406, 202, 919, 595, 308, 786, 35,
+    235, 429, 1022, 1235, 329, 1407, 410, 206, 736, 774, 513, 538,
+    1302, 696, 737, 775, 515, 540, 1303, 697, 735, 773, 511, 536,
+    1301, 695, 653, 566, 1440, 522, 654, 567, 1441, 523, 652, 565,
+    1439, 521, 1404, 764, 482, 238, 167, 386, 878, 578, 907, 525,
+    188, 557, 186, 1405, 1260, 741, 285, 1381, 922, 927, 657, 1437,
+    226, 743, 1279, 1040, 564, 189, 703, 702, 640, 1333, 689, 984,
+    413, 1080, 30, 434, 834, 1463, 92, 439, 839, 212, 1001, 888,
+    551, 1123, 1190, 1002, 1195, 1050, 723, 790, 1412, 309, 310, 1312,
+    912, 1125, 662, 1253, 797, 829, 214, 1201, 920, 739, 161, 740,
+    162, 777, 771, 778, 772, 1058, 1060, 676, 678, 512, 1367, 57,
+    1097, 1288, 537, 1418, 1086, 1212, 1229, 738, 160, 776, 770, 617,
+    625, 621, 623, 882, 962, 894, 745, 142, 816, 140, 814, 884,
+    896, 883, 884, 895, 896, 964, 747, 963, 964, 746, 747, 150,
+    146, 149, 150, 145, 146, 824, 820, 823, 824, 819, 820, 1068,
+    1069, 394, 395, 417, 418, 1106, 1107, 289, 290, 1447, 1448, 358,
+    359, 1146, 1147, 1075, 1077, 1074, 1075, 1076, 1077, 424, 426, 423,
+    424, 425, 426, 296, 298, 295, 296, 297, 298, 365, 367, 364,
+    365, 366, 367, 401, 403, 400, 401, 402, 403, 1113, 1115, 1112,
+    1113, 1114, 1115, 1454, 1456, 1453, 1454, 1455, 1456, 1153, 1155, 1152,
+    1153, 1154, 1155, 547, 431, 1428, 713, 910, 54, 725, 614, 574,
+    913, 1252, 1248, 197, 588, 380, 892, 1209, 1264, 997, 13, 1318,
+    223, 240, 198, 385, 586, 1027, 481, 544, 218, 1403, 1355, 190,
+    887, 1003, 253, 558, 1029, 1051, 254, 377, 914, 881, 48, 166,
+    1019, 195, 543, 1399, 1285, 1263, 641, 1389, 1286, 545, 875, 427,
+    378, 630, 354, 983, 1283, 546, 1304, 379, 596, 724, 151, 1267,
+    200, 483, 213, 993, 491, 387, 384, 187, 1387, 602, 1296, 612,
+    1345, 322, 1032, 1033, 1344, 321, 584, 124, 583, 123, 1356, 871,
+    870, 1320, 193, 1414, 311, 1313, 855, 86, 44, 1316, 690, 1357,
+    269, 430, 21, 560, 966, 1239, 1015, 1321, 194, 1415, 312, 705,
+    704, 1314, 856, 1093, 15, 691, 87, 284, 192, 1095, 130, 1240,
+    479, 1159, 1013, 1160, 752, 802, 246, 861, 1364, 1410, 163, 178,
+    850, 277, 1477, 1269, 450, 256, 1142, 604, 83, 753, 803, 247,
+    862, 1365, 1411, 164, 179, 851, 991, 299, 1374, 128, 278, 1478,
+    1270, 451, 257, 1143, 605, 84, 800, 859, 1408, 176, 848, 1475,
+    448, 1140, 81, 801, 860, 1409, 177, 849, 1476, 449, 1141, 82,
+    1337, 332, 266, 502, 8, 958, 251, 390, 710, 607, 628, 1091,
+    326, 1102, 646, 669, 477, 1338, 333, 267, 503, 9, 959, 252,
+    391, 711, 1174, 655, 1183, 988, 608, 629, 1092, 327, 1103, 647,
+    670, 478, 330, 500, 956, 388, 708, 626, 324, 644, 475, 331,
+    501, 957, 389, 709, 627, 325, 645, 476, 132, 407, 373, 71,
+    280, 1326, 754, 717, 203, 485, 102, 941, 633, 1005, 899, 808,
+    466, 133, 408, 374, 72, 281, 1327, 755, 718, 204, 210, 300,
+    986, 129, 486, 103, 942, 634, 1006, 900, 809, 467, 405, 69,
+    1324, 715, 201, 100, 631, 897, 464, 134, 411, 375, 75, 282,
+    1330, 756, 721, 207, 487, 106, 943, 637, 1007, 903, 810, 470,
+    135, 412, 376, 76, 283, 1331, 757, 722, 208, 211, 656, 987,
+    989, 488, 107, 944, 638, 1008, 904, 811, 471, 409, 73, 1328,
+    719, 205, 104, 635, 901, 468, 1443, 1017, 340, 660, 352, 975,
+    555, 1237, 305, 51, 63, 1444, 1018, 341, 661, 353, 976, 556,
+    1238, 306, 52, 64, 1442, 1016, 339, 659, 351, 974, 554, 1236,
+    304, 50, 62, 712, 825, 196, 1426, 542, 812, 577, 906, 924,
+    1372, 85, 864, 863, 940, 880, 125, 1243, 43, 1262, 639, 688,
+    550, 559, 1024, 1203, 1023, 1282, 582, 1351, 581, 239, 1278, 789,
+    911, 1266, 199, 517, 857, 1028, 1049, 165, 706, 509, 1315, 1349,
+    244, 965, 320, 319, 122, 1352, 121, 1311, 259, 1204, 258, 1413,
+    1042, 1435, 136, 1346, 514, 516, 1369, 1371, 59, 61, 1099, 1101,
+    1290, 1292, 539, 541, 1420, 1422, 1088, 1090, 1214, 1216, 1231, 1233,
+    893, 505, 498, 858, 1244, 510, 832, 1182, 346, 36, 1196, 1334,
+    127, 1458, 112, 1457, 111, 827, 348, 826, 347, 1388, 603, 504,
+    499, 996, 12, 1297, 613, 268, 264, 1128, 263, 1127, 110, 1268,
+    489, 791, 866, 1188, 865, 1187, 973, 372, 972, 371, 1026, 261,
+    968, 969, 1025, 260, 1048, 795, 1047, 794, 1394, 763, 1393, 762,
+    16, 874, 1094, 873, 316, 315, 46, 701, 47, 46, 905, 47,
+    46, 730, 1010, 731, 1011, 158, 768, 1057, 675, 620, 619, 934,
+    935, 684, 685, 1207, 1401, 693, 79, 1299, 173, 1250, 67, 25,
+    24, 453, 733, 649, 159, 769, 1059, 677, 936, 937, 686, 687,
+    1208, 1402, 27, 694, 80, 1300, 174, 1251, 68, 26, 454, 734,
+    650, 157, 767, 1055, 673, 616, 618, 932, 933, 682, 683, 1206,
+    1400, 22, 692, 78, 1298, 172, 1249, 66, 23, 452, 732, 648,
+    1386, 1385, 1295, 432, 1294, 971, 970, 1343, 1342, 1046, 1045, 1392,
+    1391, 1, 0, 992, 490, 601, 600, 611, 610, 1186, 1185, 370,
+    369, 793, 792, 761, 760, 1293, 46, 463, 46, 236, 46, 45,
+    46, 131, 46, 1030, 46, 171, 46, 1368, 58, 1419, 1087, 1098,
+    1289, 1213, 1230, 1370, 60, 1421, 1089, 1100, 1291, 1215, 1232, 1366,
+    56, 1417, 1085, 1096, 1287, 1211, 1228,
+};
+
+// Nodes of the decoder automaton, of which 1318 are inner nodes and 5607 are
+// leaves. No path is longer than 9 nodes. An inner node selects a field of
+// the instruction bits, and the value of that field picks one of its children:
+//
+//    bits 0 to 4:   shift of the field
+//    bits 5 to 7:   width of the field
+//    bits 8 to 30:  index of the first child node
+//
+// A leaf names a run of `kLeafExtractors` to try, in order:
+//
+//    bits 0 to 7:   number of extractors to try
+//    bits 8 to 30:  index of the first extractor in `kLeafExtractors`
+//    bit 31:        set
+static const uint32_t kDecodeNodes[] = {
+    0x0000017aU, 0x80000000U, 0x80000000U, 0x0000097dU, 0x00001177U,
+    0x0000197dU, 0x0000217dU, 0x0000297dU, 0x0000317dU, 0x00003977U,
+    0x00004177U, 0x00004977U, 0x00005177U, 0x00005977U, 0x00006177U,
+    0x00006977U, 0x00007177U, 0x0000797dU, 0x0000817dU, 0x00008974U,
+    0x0000916dU, 0x0000996dU, 0x0000a16cU, 0x0000a96dU, 0x0000b16dU,
+    0x0000b977U, 0x0000c177U, 0x0000c977U, 0x0000d177U, 0x0000d977U,
+    0x0000e177U, 0x0000e977U, 0x0000f177U, 0x80000001U, 0x0000f958U,
+    0x80000101U, 0x80000000U, 0x80000201U, 0x0000fd58U, 0x00010176U,
+    0x80000000U, 0x00010977U, 0x00011176U, 0x00011977U, 0x00012176U,
+    0x00012977U, 0x00013176U, 0x00013977U, 0x00014176U, 0x00014977U,
+    0x00015176U, 0x0001596cU, 0x00016177U, 0x00016977U, 0x00017176U,
+    0x80000000U, 0x00017976U, 0x0001816dU, 0x0001896dU, 0x80000000U,
+    0x80000000U, 0x00019135U, 0x00019335U, 0x00019555U, 0x80000301U,
+    0x00019936U, 0x00019b36U, 0x00019d36U, 0x00019f36U, 0x0001a135U,
+    0x0001a335U, 0x0001a555U, 0x80000401U, 0x0001a96dU, 0x0001b16dU,
+    0x80000000U, 0x80000000U, 0x0001b935U, 0x0001bb35U, 0x0001bd55U,
+    0x80000501U, 0x80000000U, 0x80000601U, 0x80000701U, 0x80000801U,
+    0x0001c135U, 0x0001c335U, 0x0001c555U, 0x80000901U, 0x0001c974U,
+    0x0001d16dU, 0x80000000U, 0x80000000U, 0x0001d935U, 0x0001db35U,
+    0x0001dd55U, 0x80000a01U, 0x0001e136U, 0x0001e336U, 0x0001e536U,
+    0x0001e736U, 0x0001e935U, 0x0001eb35U, 0x0001ed55U, 0x80000b01U,
+    0x0001f174U, 0x0001f96dU, 0x80000000U, 0x80000000U, 0x00020135U,
+    0x00020335U, 0x00020555U, 0x80000c01U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x00020935U, 0x00020b35U, 0x00020d55U,
+    0x80000d01U, 0x0002116cU, 0x00021936U, 0x00021b6cU, 0x00022336U,
+    0x80000000U, 0x00022536U, 0x80000000U, 0x80000000U, 0x0002276cU,
+    0x00022f36U, 0x0002316cU, 0x00023936U, 0x80000000U, 0x00023b36U,
+    0x80000000U, 0x80000000U, 0x00023d7dU, 0x0002457dU, 0x00024d7dU,
+    0x0002557dU, 0x00025d7dU, 0x0002657dU, 0x00026d7dU, 0x0002757dU,
+    0x00027d7dU, 0x0002857dU, 0x00028d7dU, 0x0002957dU, 0x00029d7dU,
+    0x0002a57dU, 0x0002ad7dU, 0x0002b57dU, 0x0002bd6aU, 0x0002c56aU,
+    0x0002cd6aU, 0x0002d56aU, 0x0002dd6aU, 0x0002e56aU, 0x0002ed6aU,
+    0x0002f56aU, 0x0002fd4aU, 0x0003014aU, 0x0003054aU, 0x0003094aU,
+    0x00030d4aU, 0x0003114aU, 0x0003154aU, 0x0003197dU, 0x0003216aU,
+    0x0003296aU, 0x0003316aU, 0x0003396aU, 0x0003416aU, 0x0003496aU,
+    0x0003516aU, 0x0003596aU, 0x0003616aU, 0x0003696aU, 0x0003716aU,
+    0x0003796aU, 0x0003816aU, 0x0003896aU, 0x0003916aU, 0x80000e01U,
+    0x80000f01U, 0x80000f01U, 0x80001001U, 0x80001001U, 0x80001101U,
+    0x80001201U, 0x80001301U, 0x80001401U, 0x80000f01U, 0x80000f01U,
+    0x80001501U, 0x80001501U, 0x80001601U, 0x80000000U, 0x80001701U,
+    0x80000000U, 0x80000f01U, 0x80000f01U, 0x80001801U, 0x80001801U,
+    0x80001901U, 0x80001a01U, 0x80001b01U, 0x80000000U, 0x80000f01U,
+    0x80000f01U, 0x80001c01U, 0x80001c01U, 0x80001d01U, 0x80001e01U,
+    0x80000000U, 0x80000000U, 0x80001f01U, 0x80001f01U, 0x80002001U,
+    0x80002001U, 0x80002101U, 0x80002201U, 0x80002301U, 0x80002401U,
+    0x80001f01U, 0x80001f01U, 0x80002501U, 0x80002501U, 0x80002601U,
+    0x80000000U, 0x80002701U, 0x80000000U, 0x80001f01U, 0x80001f01U,
+    0x80002801U, 0x80002801U, 0x80002901U, 0x80002a01U, 0x80002b01U,
+    0x80000000U, 0x80001f01U, 0x80001f01U, 0x80002c01U, 0x80002c01U,
+    0x80002d01U, 0x80002e01U, 0x80000000U, 0x80000000U, 0x80002f01U,
+    0x80003001U, 0x80003101U, 0x80003201U, 0x80003301U, 0x80003401U,
+    0x80003101U, 0x80003201U, 0x00039960U, 0x0003a139U, 0x0003a360U,
+    0x80000000U, 0x0003ab73U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80003501U, 0x80003501U, 0x80000000U, 0x80000000U, 0x80003601U,
+    0x0003b36aU, 0x0003bb2fU, 0x80000000U, 0x0003bd6aU, 0x0003c56aU,
+    0x0003cd6aU, 0x0003d56aU, 0x80003701U, 0x80003801U, 0x80003901U,
+    0x80003a01U, 0x80003b01U, 0x80003b01U, 0x80000000U, 0x80000000U,
+    0x80003c01U, 0x0003dd6aU, 0x80000000U, 0x80000000U, 0x0003e56aU,
+    0x0003ed6aU, 0x0003f56aU, 0x0003fd6aU, 0x80003d01U, 0x80003e01U,
+    0x80003f01U, 0x80004001U, 0x80004101U, 0x80004101U, 0x80000000U,
+    0x80000000U, 0x80004201U, 0x0004056aU, 0x00040d55U, 0x00041155U,
+    0x0004156aU, 0x00041d6aU, 0x0004256aU, 0x00042d6cU, 0x80004301U,
+    0x80004401U, 0x80004501U, 0x80000000U, 0x80004601U, 0x80004601U,
+    0x80000000U, 0x80000000U, 0x80004701U, 0x0004356aU, 0x80000000U,
+    0x80000000U, 0x00043d6aU, 0x0004456aU, 0x00044d6aU, 0x0004556cU,
+    0x80004801U, 0x80004901U, 0x80004a01U, 0x80000000U, 0x80004b01U,
+    0x80004b01U, 0x80000000U, 0x80000000U, 0x00045d74U, 0x00046574U,
+    0x00046d55U, 0x00047155U, 0x0004754aU, 0x0004794aU, 0x00047d4aU,
+    0x0004814aU, 0x80004c01U, 0x80004d01U, 0x80004e01U, 0x80004f01U,
+    0x00048577U, 0x00048d77U, 0x00049577U, 0x00049d77U, 0x0004a577U,
+    0x0004ad77U, 0x0004b577U, 0x0004bd77U, 0x0004c54aU, 0x80000000U,
+    0x0004c936U, 0x80000000U, 0x0004cb6cU, 0x0004d36cU, 0x0004db6cU,
+    0x0004e36cU, 0x80005001U, 0x80005001U, 0x80000000U, 0x80000000U,
+    0x0004eb70U, 0x0004f370U, 0x80000000U, 0x80000000U, 0x0004fb4aU,
+    0x0004ff4aU, 0x80000000U, 0x80000000U, 0x80005101U, 0x80005201U,
+    0x80000000U, 0x80000000U, 0x0005034aU, 0x0005074aU, 0x80000000U,
+    0x80000000U, 0x80005301U, 0x80005401U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x00050b74U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x00051374U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x00051b74U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x00052374U, 0x80005501U, 0x80005601U, 0x80005501U, 0x80005601U,
+    0x80000301U, 0x80005701U, 0x80000301U, 0x80000000U, 0x80005801U,
+    0x80005901U, 0x80005a01U, 0x80005b01U, 0x80005c01U, 0x80005d01U,
+    0x80005e01U, 0x80005f01U, 0x80006001U, 0x80006101U, 0x80006001U,
+    0x80006101U, 0x80000401U, 0x80006201U, 0x80000401U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x00052b74U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x00053374U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x00053b74U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x00054374U, 0x80006301U, 0x80006401U, 0x80006301U, 0x80006401U,
+    0x80000501U, 0x80006501U, 0x80000501U, 0x80000000U, 0x80006601U,
+    0x80006701U, 0x80006601U, 0x80006701U, 0x80000901U, 0x80006801U,
+    0x80000901U, 0x80000000U, 0x00054b6dU, 0x0005536dU, 0x00055b2fU,
+    0x00055d2fU, 0x80000000U, 0x00055f6dU, 0x80000000U, 0x0005676fU,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x00056f74U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x00057774U, 0x80006901U, 0x80006a01U,
+    0x80006901U, 0x80006a01U, 0x80000a01U, 0x80006b01U, 0x80000a01U,
+    0x80000000U, 0x80006c01U, 0x80006d01U, 0x80006e01U, 0x80006f01U,
+    0x80007001U, 0x80007101U, 0x80007201U, 0x80007301U, 0x80007401U,
+    0x80007501U, 0x80007401U, 0x80007501U, 0x80000b01U, 0x80007601U,
+    0x80000b01U, 0x80000000U, 0x00057f6dU, 0x0005876dU, 0x00058f2fU,
+    0x0005912fU, 0x80000000U, 0x0005936dU, 0x80000000U, 0x00059b6fU,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x0005a374U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x0005ab74U, 0x80007701U, 0x80007801U,
+    0x80007701U, 0x80007801U, 0x80000c01U, 0x80007901U, 0x80000c01U,
+    0x80000000U, 0x80007a01U, 0x80007b01U, 0x80007a01U, 0x80007b01U,
+    0x80000d01U, 0x80007c01U, 0x80000d01U, 0x80000000U, 0x0005b36fU,
+    0x80000000U, 0x0005bb6fU, 0x80000000U, 0x0005c374U, 0x80000000U,
+    0x0005cb74U, 0x0005d374U, 0x80007d01U, 0x80007e01U, 0x0005db6fU,
+    0x80000000U, 0x0005e36fU, 0x80000000U, 0x0005eb74U, 0x80000000U,
+    0x0005f374U, 0x0005fb74U, 0x80007f01U, 0x80008001U, 0x80008101U,
+    0x80008201U, 0x00060374U, 0x80000000U, 0x00060b74U, 0x80000000U,
+    0x00061374U, 0x80000000U, 0x00061b74U, 0x00062374U, 0x80008301U,
+    0x80008401U, 0x00062b74U, 0x80000000U, 0x00063374U, 0x80000000U,
+    0x00063b74U, 0x80000000U, 0x00064374U, 0x00064b74U, 0x80008501U,
+    0x80008601U, 0x80008701U, 0x80008801U, 0x0006536dU, 0x80008901U,
+    0x00065b6dU, 0x80008a01U, 0x80000000U, 0x80008b01U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80008901U, 0x80000000U, 0x80008a01U,
+    0x80000000U, 0x80008b01U, 0x80000000U, 0x80000000U, 0x0006636dU,
+    0x80008901U, 0x00066b6dU, 0x80008a01U, 0x80000000U, 0x80008b01U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80008901U, 0x80000000U,
+    0x80008a01U, 0x80000000U, 0x80008b01U, 0x80000000U, 0x80000000U,
+    0x0006736dU, 0x80008c01U, 0x00067b6dU, 0x80008d01U, 0x80000000U,
+    0x80008e01U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80008c01U,
+    0x80000000U, 0x80008d01U, 0x80000000U, 0x80008e01U, 0x80000000U,
+    0x80000000U, 0x0006836dU, 0x80008c01U, 0x00068b6dU, 0x80008d01U,
+    0x80000000U, 0x80008e01U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80008c01U, 0x80000000U, 0x80008d01U, 0x80000000U, 0x80008e01U,
+    0x80000000U, 0x80000000U, 0x00069374U, 0x00069b36U, 0x00069d74U,
+    0x0006a536U, 0x80000000U, 0x0006a736U, 0x80000000U, 0x80000000U,
+    0x0006a974U, 0x0006b136U, 0x0006b374U, 0x0006bb36U, 0x80000000U,
+    0x0006bd36U, 0x80000000U, 0x80000000U, 0x0006bf74U, 0x0006c736U,
+    0x0006c974U, 0x0006d136U, 0x80000000U, 0x0006d336U, 0x80000000U,
+    0x80000000U, 0x0006d574U, 0x0006dd36U, 0x0006df74U, 0x0006e736U,
+    0x80000000U, 0x0006e936U, 0x80000000U, 0x80000000U, 0x0006eb74U,
+    0x0006f336U, 0x0006f574U, 0x0006fd36U, 0x80000000U, 0x0006ff36U,
+    0x80000000U, 0x80000000U, 0x00070174U, 0x00070936U, 0x00070b74U,
+    0x00071336U, 0x80000000U, 0x00071536U, 0x80000000U, 0x80000000U,
+    0x00071774U, 0x00071f36U, 0x00072174U, 0x00072936U, 0x80000000U,
+    0x00072b36U, 0x80000000U, 0x80000000U, 0x00072d74U, 0x00073536U,
+    0x00073774U, 0x00073f36U, 0x80000000U, 0x00074136U, 0x80000000U,
+    0x80000000U, 0x0007437dU, 0x00074b7dU, 0x00075373U, 0x00075b7dU,
+    0x0007637dU, 0x00076b7dU, 0x0007737dU, 0x00077b7dU, 0x0007837dU,
+    0x00078b7dU, 0x0007937dU, 0x00079b7dU, 0x0007a37dU, 0x0007ab7dU,
+    0x0007b373U, 0x0007bb7dU, 0x0007c37dU, 0x0007cb7dU, 0x0007d373U,
+    0x0007db7dU, 0x0007e37dU, 0x0007eb7dU, 0x0007f374U, 0x0007fb7dU,
+    0x0008037dU, 0x00080b7dU, 0x00081373U, 0x00081b7dU, 0x0008237dU,
+    0x00082b7dU, 0x0008337dU, 0x00083b7dU, 0x0008437dU, 0x00084b7dU,
+    0x00085370U, 0x00085b7dU, 0x80008f01U, 0x0008637dU, 0x00086b70U,
+    0x0008737dU, 0x00087b7dU, 0x0008837dU, 0x00088b72U, 0x0008937dU,
+    0x80009001U, 0x00089b7dU, 0x0008a372U, 0x80009101U, 0x0008ab7dU,
+    0x0008b37dU, 0x0008bb72U, 0x80009201U, 0x80009301U, 0x0008c37dU,
+    0x0008cb71U, 0x0008d37dU, 0x80009401U, 0x0008db7dU, 0x80000000U,
+    0x80009501U, 0x80000000U, 0x0008e37dU, 0x0008eb7dU, 0x0008f37dU,
+    0x0008fb7dU, 0x0009037dU, 0x00090b6fU, 0x0009137dU, 0x00091b7dU,
+    0x0009237dU, 0x00092b6fU, 0x0009337dU, 0x00093b7dU, 0x0009437dU,
+    0x00094b6fU, 0x0009537dU, 0x00095b7dU, 0x0009637dU, 0x00096b6fU,
+    0x0009737dU, 0x00097b7dU, 0x0009837dU, 0x00098b6fU, 0x0009937dU,
+    0x00099b7dU, 0x0009a37dU, 0x0009ab6fU, 0x0009b37dU, 0x0009bb7dU,
+    0x0009c37dU, 0x0009cb6fU, 0x0009d37dU, 0x0009db4aU, 0x0009df4aU,
+    0x0009e34aU, 0x0009e74aU, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80009601U, 0x0009eb7dU, 0x80009601U, 0x80000000U,
+    0x80009701U, 0x0009f37dU, 0x80009701U, 0x80000000U, 0x0009fb7dU,
+    0x000a037dU, 0x000a0b7dU, 0x80000000U, 0x80009801U, 0x000a137dU,
+    0x80009801U, 0x80000000U, 0x80009901U, 0x000a1b7dU, 0x80009901U,
+    0x80000000U, 0x80009a01U, 0x000a237dU, 0x80009a01U, 0x80000000U,
+    0x000a2b7dU, 0x000a337dU, 0x000a3b7dU, 0x80000000U, 0x80009b01U,
+    0x000a437dU, 0x80009b01U, 0x80000000U, 0x80009c01U, 0x000a4b7dU,
+    0x80009c01U, 0x000a537dU, 0x000a5b7dU, 0x000a637dU, 0x000a6b7dU,
+    0x000a737dU, 0x000a7b7dU, 0x000a837dU, 0x000a8b7dU, 0x80000000U,
+    0x80009d01U, 0x000a937dU, 0x80009d01U, 0x80000000U, 0x80009e01U,
+    0x000a9b7dU, 0x80009e01U, 0x80000000U, 0x000aa37dU, 0x000aab7dU,
+    0x000ab37dU, 0x80000000U, 0x80000000U, 0x000abb7dU, 0x80000000U,
+    0x80000000U, 0x80000e01U, 0x000ac37dU, 0x80000e01U, 0x000acb7dU,
+    0x80009601U, 0x80000000U, 0x80009601U, 0x80000000U, 0x80009f01U,
+    0x80000000U, 0x80009f01U, 0x80000000U, 0x000ad37dU, 0x80000000U,
+    0x000adb7dU, 0x80000000U, 0x80009801U, 0x80000000U, 0x80009801U,
+    0x80000000U, 0x80009901U, 0x80000000U, 0x80009901U, 0x80000000U,
+    0x8000a001U, 0x80000000U, 0x8000a001U, 0x80000000U, 0x000ae37dU,
+    0x80000000U, 0x000aeb7dU, 0x80000000U, 0x80009b01U, 0x80000000U,
+    0x80009b01U, 0x80000000U, 0x80009c01U, 0x80000000U, 0x80009c01U,
+    0x80000000U, 0x000af37dU, 0x80000000U, 0x000afb7dU, 0x80000000U,
+    0x000b037dU, 0x80000000U, 0x000b0b7dU, 0x80000000U, 0x80009d01U,
+    0x80000000U, 0x80009d01U, 0x80000000U, 0x80009e01U, 0x80000000U,
+    0x80009e01U, 0x80000000U, 0x000b137dU, 0x80000000U, 0x000b1b7dU,
+    0x80000000U, 0x000b2373U, 0x8000a101U, 0x8000a201U, 0x8000a301U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x8000a401U,
+    0x8000a501U, 0x000b2b73U, 0x8000a601U, 0x8000a701U, 0x8000a801U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x000b336cU,
+    0x8000a901U, 0x8000aa01U, 0x8000aa01U, 0x80000000U, 0x8000ab01U,
+    0x8000ac01U, 0x8000ac01U, 0x000b3b55U, 0x000b3f55U, 0x000b436dU,
+    0x000b4b6dU, 0x000b5355U, 0x000b5755U, 0x8000ad01U, 0x80000000U,
+    0x8000ae01U, 0x8000af01U, 0x000b5b6dU, 0x8000b001U, 0x000b6335U,
+    0x8000b101U, 0x000b656dU, 0x8000b001U, 0x000b6d35U, 0x8000b101U,
+    0x000b6f6dU, 0x8000b201U, 0x000b7735U, 0x8000b301U, 0x000b796dU,
+    0x8000b201U, 0x000b8135U, 0x8000b301U, 0x000b836dU, 0x8000b401U,
+    0x000b8b35U, 0x8000b501U, 0x000b8d6dU, 0x8000b401U, 0x000b9535U,
+    0x8000b501U, 0x000b976dU, 0x8000b601U, 0x000b9f35U, 0x8000b701U,
+    0x000ba16dU, 0x8000b601U, 0x000ba935U, 0x8000b701U, 0x000bab74U,
+    0x000bb374U, 0x8000b801U, 0x80000000U, 0x000bbb74U, 0x000bc374U,
+    0x80000000U, 0x80000000U, 0x000bcb6dU, 0x8000b901U, 0x000bd335U,
+    0x8000ba01U, 0x000bd56dU, 0x8000b901U, 0x000bdd35U, 0x8000ba01U,
+    0x000bdf6dU, 0x8000bb01U, 0x000be735U, 0x8000bc01U, 0x000be96dU,
+    0x8000bb01U, 0x000bf135U, 0x8000bc01U, 0x000bf36dU, 0x8000bd01U,
+    0x000bfb35U, 0x8000be01U, 0x000bfd6dU, 0x8000bd01U, 0x000c0535U,
+    0x8000be01U, 0x000c076dU, 0x8000bf01U, 0x000c0f35U, 0x8000c001U,
+    0x000c116dU, 0x8000bf01U, 0x000c1935U, 0x8000c001U, 0x000c1b55U,
+    0x000c1f55U, 0x000c236dU, 0x000c2b6dU, 0x8000c101U, 0x8000c201U,
+    0x80000000U, 0x8000c301U, 0x000c332fU, 0x000c352fU, 0x8000c401U,
+    0x80000000U, 0x80000000U, 0x000c372fU, 0x8000c501U, 0x80000000U,
+    0x000c396dU, 0x8000c601U, 0x000c4135U, 0x8000c701U, 0x000c436dU,
+    0x8000c601U, 0x000c4b35U, 0x8000c701U, 0x000c4d6dU, 0x8000c801U,
+    0x000c5535U, 0x8000c901U, 0x000c576dU, 0x8000c801U, 0x000c5f35U,
+    0x8000c901U, 0x000c616dU, 0x8000ca01U, 0x000c6935U, 0x8000cb01U,
+    0x000c6b6dU, 0x8000ca01U, 0x000c7335U, 0x8000cb01U, 0x000c752fU,
+    0x8000cc01U, 0x8000cd01U, 0x8000ce01U, 0x8000cf01U, 0x8000d001U,
+    0x8000d101U, 0x8000d201U, 0x000c7774U, 0x000c7f74U, 0x8000d301U,
+    0x8000d401U, 0x000c8774U, 0x000c8f74U, 0x80000000U, 0x80000000U,
+    0x000c976dU, 0x8000d501U, 0x000c9f35U, 0x8000d601U, 0x000ca16dU,
+    0x8000d501U, 0x000ca935U, 0x8000d601U, 0x000cab6dU, 0x8000d701U,
+    0x000cb335U, 0x8000d801U, 0x000cb56dU, 0x8000d701U, 0x000cbd35U,
+    0x8000d801U, 0x000cbf6dU, 0x80000000U, 0x8000d901U, 0x80000000U,
+    0x000cc76dU, 0x80000000U, 0x8000d901U, 0x80000000U, 0x000ccf2fU,
+    0x8000da01U, 0x8000db01U, 0x8000dc01U, 0x8000dd01U, 0x8000de01U,
+    0x8000df01U, 0x8000e001U, 0x000cd170U, 0x000cd970U, 0x000ce16aU,
+    0x000ce96aU, 0x000cf170U, 0x000cf970U, 0x000d016aU, 0x000d096aU,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x000d1170U,
+    0x000d1970U, 0x000d216aU, 0x000d296aU, 0x000d312fU, 0x000d332fU,
+    0x000d352fU, 0x000d372fU, 0x80000000U, 0x80000000U, 0x000d392fU,
+    0x000d3b2fU, 0x8000e101U, 0x8000e201U, 0x8000e302U, 0x8000e501U,
+    0x8000e601U, 0x8000e701U, 0x8000e802U, 0x8000ea01U, 0x8000eb01U,
+    0x8000ec01U, 0x8000ed01U, 0x8000ee01U, 0x8000ef01U, 0x8000f001U,
+    0x8000f101U, 0x8000f201U, 0x8000f301U, 0x8000f301U, 0x80000000U,
+    0x80000000U, 0x000d3d4aU, 0x000d414aU, 0x8000f401U, 0x80000000U,
+    0x8000f301U, 0x8000f301U, 0x80000000U, 0x80000000U, 0x000d454aU,
+    0x000d494aU, 0x000d4d4aU, 0x000d512fU, 0x8000f301U, 0x8000f301U,
+    0x80000000U, 0x80000000U, 0x000d534aU, 0x000d576fU, 0x8000f501U,
+    0x80000000U, 0x8000f301U, 0x8000f301U, 0x80000000U, 0x80000000U,
+    0x000d5f4aU, 0x000d634aU, 0x000d674aU, 0x000d6b2fU, 0x8000f301U,
+    0x8000f301U, 0x80000000U, 0x80000000U, 0x000d6d4aU, 0x000d716fU,
+    0x8000f601U, 0x8000f601U, 0x8000f301U, 0x8000f301U, 0x80000000U,
+    0x80000000U, 0x000d794aU, 0x000d7d4aU, 0x000d814aU, 0x000d852fU,
+    0x8000f301U, 0x8000f301U, 0x80000000U, 0x80000000U, 0x000d874aU,
+    0x000d8b71U, 0x8000f701U, 0x80000000U, 0x8000f301U, 0x8000f301U,
+    0x80000000U, 0x80000000U, 0x000d934aU, 0x000d976fU, 0x000d9f4aU,
+    0x8000f801U, 0x000da355U, 0x000da755U, 0x000dab55U, 0x000daf55U,
+    0x8000f901U, 0x8000fa01U, 0x000db34aU, 0x8000fb01U, 0x000db74aU,
+    0x000dbb4aU, 0x000dbf6fU, 0x000dc74aU, 0x000dcb4aU, 0x000dcf6fU,
+    0x000dd74aU, 0x000ddb4aU, 0x000ddf4aU, 0x000de34aU, 0x000de76fU,
+    0x000def4aU, 0x000df34aU, 0x000df76fU, 0x000dff4aU, 0x000e034aU,
+    0x8000fc01U, 0x8000fd01U, 0x8000fe01U, 0x000e074aU, 0x000e0b2fU,
+    0x000e0d4aU, 0x80000000U, 0x8000ff01U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80010001U, 0x80000000U, 0x80010101U, 0x000e1173U,
+    0x000e1973U, 0x000e2174U, 0x000e2974U, 0x000e3174U, 0x000e3974U,
+    0x80010201U, 0x80010301U, 0x000e4173U, 0x000e4973U, 0x000e5173U,
+    0x000e5973U, 0x80010401U, 0x80010501U, 0x000e6173U, 0x000e6973U,
+    0x80010601U, 0x80010701U, 0x80010801U, 0x80010901U, 0x80010a01U,
+    0x80010b01U, 0x80010c01U, 0x80010d01U, 0x80010e01U, 0x80010f01U,
+    0x80011001U, 0x80011101U, 0x80011201U, 0x80011301U, 0x80011401U,
+    0x80011501U, 0x80011601U, 0x80011601U, 0x80011701U, 0x80011701U,
+    0x80000000U, 0x80011801U, 0x80011901U, 0x80011901U, 0x80011a01U,
+    0x80011a01U, 0x80011b01U, 0x80011b01U, 0x80000000U, 0x80011c01U,
+    0x80011d01U, 0x80011d01U, 0x80000000U, 0x80011e01U, 0x80011f01U,
+    0x80011f01U, 0x80000000U, 0x80012001U, 0x80012101U, 0x80012101U,
+    0x80000000U, 0x80012201U, 0x80012301U, 0x80012301U, 0x80000000U,
+    0x80012401U, 0x80012501U, 0x80012501U, 0x80012601U, 0x80012601U,
+    0x80012701U, 0x80012701U, 0x80000000U, 0x80012801U, 0x80012901U,
+    0x80012901U, 0x80012a01U, 0x80012a01U, 0x80012b01U, 0x80012b01U,
+    0x80000000U, 0x80012c01U, 0x80012d01U, 0x80012d01U, 0x80000000U,
+    0x80012e01U, 0x80012f01U, 0x80012f01U, 0x80000000U, 0x80013001U,
+    0x80013101U, 0x80013101U, 0x80000000U, 0x80013201U, 0x80013301U,
+    0x80013301U, 0x80000000U, 0x80013401U, 0x80013501U, 0x80013501U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80013601U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80013701U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80013601U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80013701U, 0x80013801U, 0x80013901U, 0x80013801U, 0x80013901U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80013a01U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80013b01U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80013c01U,
+    0x80013d01U, 0x80000000U, 0x80013e01U, 0x80013f01U, 0x80013f01U,
+    0x80000000U, 0x80014001U, 0x80014101U, 0x80014101U, 0x80000000U,
+    0x80014201U, 0x80014301U, 0x80014301U, 0x80000000U, 0x80014401U,
+    0x80014501U, 0x80014501U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80014601U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80014701U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80014601U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80014701U, 0x80014801U, 0x80014901U,
+    0x80014801U, 0x80014901U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80014a01U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80014b01U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80014c01U, 0x80014d01U, 0x80000000U, 0x80014e01U,
+    0x80014f01U, 0x80014f01U, 0x80000000U, 0x80015001U, 0x80015101U,
+    0x80015101U, 0x80000000U, 0x80015201U, 0x80015301U, 0x80015301U,
+    0x80000000U, 0x80015401U, 0x80015501U, 0x80015501U, 0x000e7174U,
+    0x000e7974U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x000e8174U, 0x000e8974U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80015601U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80015701U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80015801U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80015901U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80015a01U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80015b01U, 0x80000000U, 0x80000000U, 0x80000000U, 0x000e9174U,
+    0x000e9974U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x000ea174U, 0x000ea974U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80015601U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80015701U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80015801U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80015901U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80015a01U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80015b01U, 0x80000000U, 0x80000000U, 0x80000000U, 0x000eb12fU,
+    0x000eb36fU, 0x80000000U, 0x80000000U, 0x000ebb2fU, 0x000ebd6fU,
+    0x80000000U, 0x80000000U, 0x000ec52fU, 0x000ec76fU, 0x80000000U,
+    0x80000000U, 0x000ecf2fU, 0x000ed16fU, 0x80000000U, 0x80000000U,
+    0x80015c01U, 0x80015d02U, 0x80000000U, 0x80000000U, 0x80015f01U,
+    0x80016002U, 0x80000000U, 0x80000000U, 0x80016201U, 0x80016302U,
+    0x80000000U, 0x80000000U, 0x80016501U, 0x80016602U, 0x80000000U,
+    0x80000000U, 0x80016801U, 0x80016902U, 0x80000000U, 0x80000000U,
+    0x80016b01U, 0x80016c02U, 0x80000000U, 0x80000000U, 0x000ed92fU,
+    0x000edb6fU, 0x80000000U, 0x80000000U, 0x000ee32fU, 0x000ee56fU,
+    0x80000000U, 0x80000000U, 0x000eed2fU, 0x000eef6fU, 0x80000000U,
+    0x80000000U, 0x000ef72fU, 0x000ef96fU, 0x80000000U, 0x80000000U,
+    0x80015c01U, 0x80015d02U, 0x80000000U, 0x80000000U, 0x80015f01U,
+    0x80016002U, 0x80000000U, 0x80000000U, 0x80016201U, 0x80016302U,
+    0x80000000U, 0x80000000U, 0x80016501U, 0x80016602U, 0x80000000U,
+    0x80000000U, 0x80016801U, 0x80016902U, 0x80000000U, 0x80000000U,
+    0x80016b01U, 0x80016c02U, 0x80000000U, 0x80000000U, 0x80016e01U,
+    0x80016f01U, 0x80017001U, 0x80017101U, 0x000f016aU, 0x000f096aU,
+    0x80000000U, 0x80000000U, 0x80016e01U, 0x80016f01U, 0x80017001U,
+    0x80017101U, 0x000f116aU, 0x000f196aU, 0x80000000U, 0x80000000U,
+    0x80017201U, 0x80017301U, 0x80017401U, 0x80017501U, 0x000f216aU,
+    0x000f296aU, 0x80000000U, 0x80000000U, 0x80017201U, 0x80017301U,
+    0x80017401U, 0x80017501U, 0x000f316aU, 0x000f396aU, 0x80000000U,
+    0x80000000U, 0x80017601U, 0x80017701U, 0x80017801U, 0x80017901U,
+    0x000f416aU, 0x000f496aU, 0x80017a01U, 0x80017b01U, 0x80017601U,
+    0x80017701U, 0x80017801U, 0x80017901U, 0x000f516aU, 0x000f596aU,
+    0x80017a01U, 0x80017b01U, 0x80017c01U, 0x80017d01U, 0x80017e01U,
+    0x80017f01U, 0x000f616aU, 0x000f696aU, 0x80018001U, 0x80018101U,
+    0x80017c01U, 0x80017d01U, 0x80017e01U, 0x80017f01U, 0x000f716aU,
+    0x000f796aU, 0x80018001U, 0x80018101U, 0x80018201U, 0x80018302U,
+    0x80018501U, 0x80018602U, 0x80018801U, 0x80018902U, 0x80018b01U,
+    0x80018c02U, 0x80018e01U, 0x80018f01U, 0x80018201U, 0x80018302U,
+    0x80018501U, 0x80018602U, 0x80018801U, 0x80018902U, 0x80018b01U,
+    0x80018c02U, 0x80019001U, 0x80019101U, 0x80019201U, 0x80019301U,
+    0x80019401U, 0x80019502U, 0x80019701U, 0x80019802U, 0x80019a01U,
+    0x80019b02U, 0x80019d01U, 0x80019e02U, 0x80018e01U, 0x80018f01U,
+    0x80019401U, 0x80019502U, 0x80019701U, 0x80019802U, 0x80019a01U,
+    0x80019b02U, 0x80019d01U, 0x80019e02U, 0x80019001U, 0x80019101U,
+    0x80019201U, 0x80019301U, 0x8001a001U, 0x8001a102U, 0x8001a301U,
+    0x8001a402U, 0x8001a601U, 0x8001a702U, 0x8001a901U, 0x8001aa02U,
+    0x80018e01U, 0x80018f01U, 0x8001a001U, 0x8001a102U, 0x8001a301U,
+    0x8001a402U, 0x8001a601U, 0x8001a702U, 0x8001a901U, 0x8001aa02U,
+    0x80019001U, 0x80019101U, 0x80019201U, 0x80019301U, 0x8001ac01U,
+    0x8001ad02U, 0x8001af01U, 0x8001b002U, 0x8001b201U, 0x8001b302U,
+    0x8001b501U, 0x8001b602U, 0x80018e01U, 0x80018f01U, 0x8001ac01U,
+    0x8001ad02U, 0x8001af01U, 0x8001b002U, 0x8001b201U, 0x8001b302U,
+    0x8001b501U, 0x8001b602U, 0x80019001U, 0x80019101U, 0x80019201U,
+    0x80019301U, 0x000f816aU, 0x000f896aU, 0x000f916aU, 0x000f996aU,
+    0x000fa16aU, 0x000fa96aU, 0x000fb16aU, 0x000fb96aU, 0x80018e01U,
+    0x80018f01U, 0x000fc16aU, 0x000fc96aU, 0x000fd16aU, 0x000fd96aU,
+    0x000fe16aU, 0x000fe96aU, 0x000ff16aU, 0x000ff96aU, 0x80019001U,
+    0x80019101U, 0x80019201U, 0x80019301U, 0x0010016aU, 0x0010096aU,
+    0x0010116aU, 0x0010196aU, 0x0010216aU, 0x0010296aU, 0x0010316aU,
+    0x0010396aU, 0x80018e01U, 0x80018f01U, 0x0010416aU, 0x0010496aU,
+    0x0010516aU, 0x0010596aU, 0x0010616aU, 0x0010696aU, 0x0010716aU,
+    0x0010796aU, 0x80019001U, 0x80019101U, 0x80019201U, 0x80019301U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x8001b801U,
+    0x8001b902U, 0x8001bb01U, 0x8001bc02U, 0x80018e01U, 0x80018f01U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x8001b801U,
+    0x8001b902U, 0x8001bb01U, 0x8001bc02U, 0x80019001U, 0x80019101U,
+    0x80019201U, 0x80019301U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x8001be01U, 0x8001bf02U, 0x8001c101U, 0x8001c202U,
+    0x80018e01U, 0x80018f01U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x8001be01U, 0x8001bf02U, 0x8001c101U, 0x8001c202U,
+    0x80019001U, 0x80019101U, 0x80019201U, 0x80019301U, 0x00108155U,
+    0x00108555U, 0x00108955U, 0x00108d55U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x00109155U, 0x00109555U, 0x00109955U,
+    0x00109d55U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x8001c401U, 0x8001c401U, 0x8001c401U, 0x8001c401U, 0x0010a17dU,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x0010a955U, 0x8001c501U,
+    0x0010ad55U, 0x0010b155U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x0010b555U, 0x0010b955U, 0x0010bd55U, 0x0010c155U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x0010c555U,
+    0x0010c955U, 0x0010cd55U, 0x0010d155U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x0010d573U, 0x8001c401U, 0x0010dd73U,
+    0x8001c401U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x0010e555U, 0x0010e955U, 0x0010ed55U, 0x0010f155U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x0010f555U, 0x0010f955U,
+    0x0010fd55U, 0x00110155U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x00110555U, 0x00110955U, 0x00110d55U, 0x00111155U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x00111573U,
+    0x00111d73U, 0x00112573U, 0x00112d73U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x00113555U, 0x00113955U, 0x00113d55U,
+    0x00114155U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x00114555U, 0x00114955U, 0x00114d55U, 0x00115155U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x00115555U, 0x00115955U,
+    0x00115d55U, 0x00116155U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x0011657dU, 0x00116d7dU, 0x0011757dU, 0x00117d7dU,
+    0x00118570U, 0x80000000U, 0x00118d7dU, 0x80000000U, 0x00119555U,
+    0x00119955U, 0x00119d55U, 0x0011a155U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x0011a555U, 0x0011a955U, 0x0011ad55U,
+    0x0011b155U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x8001c601U, 0x8001c701U, 0x8001c601U, 0x0011b555U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x8001c401U, 0x8001c401U,
+    0x8001c401U, 0x8001c401U, 0x0011b970U, 0x8001c801U, 0x80000000U,
+    0x80000000U, 0x8001c901U, 0x8001ca01U, 0x8001c901U, 0x0011c155U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x0011c555U,
+    0x0011c955U, 0x0011cd55U, 0x0011d155U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x8001cb01U, 0x8001cc01U, 0x8001cb01U,
+    0x0011d555U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x0011d97dU, 0x0011e17dU, 0x0011e971U, 0x80000000U, 0x8001cd01U,
+    0x8001cd01U, 0x0011f17dU, 0x80000000U, 0x8001ce01U, 0x8001cf01U,
+    0x8001ce01U, 0x0011f955U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x0011fd55U, 0x00120155U, 0x00120555U, 0x00120955U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x8001d001U,
+    0x8001d101U, 0x8001d001U, 0x00120d55U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x0012117dU, 0x0012197dU, 0x0012217dU,
+    0x0012297dU, 0x00123170U, 0x8001d201U, 0x80000000U, 0x80000000U,
+    0x8001d301U, 0x8001d401U, 0x8001d301U, 0x00123955U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x00123d55U, 0x00124155U,
+    0x00124555U, 0x00124955U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x8001d501U, 0x8001d601U, 0x8001d501U, 0x00124d55U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x00125173U,
+    0x00125974U, 0x00126173U, 0x00126974U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x8001d701U, 0x8001d801U, 0x8001d701U,
+    0x00127155U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x8001d901U, 0x8001da01U, 0x8001d901U, 0x8001da01U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x8001db01U, 0x00127535U,
+    0x8001db01U, 0x00127735U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x0012797dU, 0x00128173U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x8001dc01U,
+    0x00128935U, 0x8001dc01U, 0x00128b35U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x8001dd01U, 0x8001de01U, 0x8001dd01U,
+    0x8001de01U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x00128d7dU, 0x00129573U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x8001df01U, 0x8001e001U,
+    0x8001df01U, 0x8001e001U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x8001e101U, 0x8001e201U, 0x8001e101U, 0x8001e201U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x8001e301U,
+    0x8001e401U, 0x8001e301U, 0x8001e401U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x00129d50U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x0012a150U, 0x80000000U, 0x0012a57dU, 0x80000000U,
+    0x8001e501U, 0x8001e601U, 0x8001e501U, 0x8001e601U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x8001e701U, 0x8001e801U,
+    0x8001e701U, 0x8001e801U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x0012ad50U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x8001e901U, 0x80000000U, 0x0012b17dU, 0x80000000U, 0x8001ea01U,
+    0x8001eb01U, 0x8001ea01U, 0x8001eb01U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x8001ec01U, 0x8001ed01U, 0x8001ec01U,
+    0x8001ed01U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x0012b97dU, 0x80000000U, 0x80000000U, 0x80000000U, 0x0012c17dU,
+    0x80000000U, 0x0012c97dU, 0x80000000U, 0x8001ee01U, 0x8001ef01U,
+    0x8001ee01U, 0x8001ef01U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x0012d17dU, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x0012d97dU, 0x80000000U, 0x80000000U, 0x80000000U, 0x8001f001U,
+    0x8001f101U, 0x8001f001U, 0x8001f101U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x8001f201U, 0x8001f301U, 0x8001f201U,
+    0x8001f301U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x8001f401U, 0x8001f501U, 0x8001f401U, 0x8001f501U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x8001f601U, 0x8001f701U,
+    0x8001f601U, 0x8001f701U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x8001f801U, 0x8001f901U, 0x8001f801U, 0x8001f901U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x0012e12fU,
+    0x0012e32fU, 0x0012e52fU, 0x0012e72fU, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x0012e955U, 0x0012ed55U, 0x0012f155U,
+    0x0012f555U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x0012f97dU, 0x0013017dU, 0x80000000U, 0x00130972U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x00131155U, 0x0013152fU,
+    0x00131755U, 0x00131b2fU, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x00131d2fU, 0x8001fa01U, 0x00131f2fU, 0x8001fa01U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x00132155U,
+    0x00132555U, 0x00132955U, 0x00132d55U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x00133173U, 0x0013397dU, 0x8001fb01U,
+    0x00134172U, 0x8001fb01U, 0x80000000U, 0x8001fb01U, 0x80000000U,
+    0x00134955U, 0x00134d55U, 0x00135155U, 0x00135555U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x0013592fU, 0x00135b2fU,
+    0x00135d2fU, 0x00135f2fU, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x0013612fU, 0x00136355U, 0x0013672fU, 0x00136955U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x00136d73U,
+    0x00137572U, 0x00137d73U, 0x00138572U, 0x8001fc01U, 0x80000000U,
+    0x8001fc01U, 0x80000000U, 0x00138d2fU, 0x00138f55U, 0x0013932fU,
+    0x00139555U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x0013992fU, 0x8001fd01U, 0x00139b2fU, 0x8001fd01U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x00139d55U, 0x0013a155U,
+    0x0013a555U, 0x0013a955U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x0013ad73U, 0x0013b57dU, 0x0013bd7dU, 0x0013c572U,
+    0x8001fe01U, 0x80000000U, 0x8001fe01U, 0x80000000U, 0x0013cd55U,
+    0x8001ff01U, 0x0013d155U, 0x8001ff01U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x0013d52fU, 0x0013d72fU, 0x0013d92fU,
+    0x0013db2fU, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x0013dd2fU, 0x0013df2fU, 0x0013e12fU, 0x0013e32fU, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x0013e57dU, 0x0013ed72U,
+    0x0013f57dU, 0x0013fd7dU, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x0014052fU, 0x8001ca01U, 0x0014072fU, 0x8001ca01U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x0014092fU,
+    0x80020001U, 0x00140b2fU, 0x80020001U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x00140d2fU, 0x00140f2fU, 0x0014112fU,
+    0x0014132fU, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x00141573U, 0x00141d72U, 0x8001cd01U, 0x00142572U, 0x8001cd01U,
+    0x80000000U, 0x8001cd01U, 0x80000000U, 0x8001ce01U, 0x8001cf01U,
+    0x8001ce01U, 0x8001cf01U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x00142d2fU, 0x80020101U, 0x00142f2fU, 0x80020101U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x8001d001U,
+    0x0014312fU, 0x8001d001U, 0x0014332fU, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x00143573U, 0x00143d72U, 0x80020201U,
+    0x80000000U, 0x80020201U, 0x80000000U, 0x80020201U, 0x80000000U,
+    0x8001d301U, 0x0014452fU, 0x8001d301U, 0x0014472fU, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80020301U, 0x0014492fU,
+    0x00144b73U, 0x0014532fU, 0x80020401U, 0x0014552fU, 0x0014576fU,
+    0x8001d801U, 0x80020301U, 0x00145f2fU, 0x00146173U, 0x0014692fU,
+    0x80020401U, 0x00146b2fU, 0x00146d6fU, 0x8001d801U, 0x80020502U,
+    0x80020702U, 0x80020502U, 0x80020702U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80020902U, 0x80020b02U, 0x80020902U,
+    0x80020b02U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80020d01U, 0x80020e01U, 0x80020d01U, 0x80020e01U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80020f02U, 0x80021102U,
+    0x80020f02U, 0x80021102U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80020d01U, 0x80020e01U, 0x80020d01U, 0x80020e01U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80021302U,
+    0x80021502U, 0x80021302U, 0x80021502U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80021701U, 0x80021802U, 0x80021701U,
+    0x80021802U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80021a02U, 0x80021c02U, 0x80021a02U, 0x80021c02U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80021e01U, 0x80021f01U,
+    0x80021e01U, 0x80021f01U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80021701U, 0x80022002U, 0x80021701U, 0x80022002U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80021e01U,
+    0x80021f01U, 0x80021e01U, 0x80021f01U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80022202U, 0x80022402U, 0x80022202U,
+    0x80022402U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80022602U, 0x80022802U, 0x80022602U, 0x80022802U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80022a01U, 0x80022b01U,
+    0x80022a01U, 0x80022b01U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80022c01U, 0x80022d01U, 0x80022c01U, 0x80022d01U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80022e02U,
+    0x80023002U, 0x80022e02U, 0x80023002U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80022c01U, 0x80022d01U, 0x80022c01U,
+    0x80022d01U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80023201U, 0x80023301U, 0x80023201U, 0x80023301U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80023401U, 0x80023501U,
+    0x80023401U, 0x80023501U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80023602U, 0x80023802U, 0x80023602U, 0x80023802U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80023401U,
+    0x80023501U, 0x80023401U, 0x80023501U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80023a01U, 0x80023b01U, 0x80023a01U,
+    0x80023b01U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80023c01U, 0x80023d01U, 0x80023c01U, 0x80023d01U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80023e01U, 0x80023f01U,
+    0x80023e01U, 0x80023f01U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80023c01U, 0x80023d01U, 0x80023c01U, 0x80023d01U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80023e01U,
+    0x80023f01U, 0x80023e01U, 0x80023f01U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80024002U, 0x80024202U, 0x80024002U,
+    0x80024402U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80024601U, 0x80000000U, 0x80024601U, 0x80024701U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80024802U, 0x80024a01U,
+    0x80024802U, 0x80024a01U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80020d01U, 0x80020e01U, 0x80020d01U, 0x80020e01U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80020d01U,
+    0x80020e01U, 0x80020d01U, 0x80020e01U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80021e01U, 0x80021f01U, 0x80021e01U,
+    0x80021f01U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80021e01U, 0x80021f01U, 0x80021e01U, 0x80021f01U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80024b01U, 0x80024c01U,
+    0x80024b01U, 0x80024c01U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80024b01U, 0x80024c01U, 0x80024b01U, 0x80024c01U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80023401U,
+    0x80023501U, 0x80023401U, 0x80023501U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80023401U, 0x80023501U, 0x80023401U,
+    0x80023501U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80023e01U, 0x80023f01U, 0x80023e01U, 0x80023f01U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80023e01U, 0x80023f01U,
+    0x80023e01U, 0x80023f01U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80024d01U,
+    0x80024e01U, 0x80024e01U, 0x80024e01U, 0x00147539U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80024f01U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80025001U, 0x80000000U, 0x80000000U, 0x00147763U,
+    0x00147f65U, 0x80025101U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80025201U, 0x80000000U, 0x0014876dU, 0x80000000U, 0x80025301U,
+    0x80000000U, 0x00148f6dU, 0x80000000U, 0x80025401U, 0x80025501U,
+    0x80025601U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80025701U, 0x80025801U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80025201U,
+    0x80000000U, 0x80025901U, 0x80000000U, 0x80025301U, 0x80000000U,
+    0x80025a01U, 0x80000000U, 0x00149735U, 0x00149935U, 0x00149b35U,
+    0x00149d35U, 0x00149f35U, 0x80025b01U, 0x80025b01U, 0x80025b01U,
+    0x80025c01U, 0x80025d02U, 0x0014a135U, 0x0014a335U, 0x0014a535U,
+    0x0014a735U, 0x80025b01U, 0x80025b01U, 0x80025b01U, 0x80025b01U,
+    0x80025c01U, 0x80025d02U, 0x0014a935U, 0x0014ab35U, 0x0014ad35U,
+    0x0014af35U, 0x0014b135U, 0x0014b339U, 0x0014b539U, 0x0014b739U,
+    0x0014b939U, 0x80025f02U, 0x0014bb35U, 0x0014bd35U, 0x0014bf35U,
+    0x0014c135U, 0x0014c339U, 0x0014c539U, 0x0014c739U, 0x0014c939U,
+    0x0014cb39U, 0x80025f02U, 0x0014cd35U, 0x0014cf35U, 0x0014d135U,
+    0x0014d335U, 0x0014d535U, 0x80026101U, 0x80026101U, 0x80026101U,
+    0x80026201U, 0x80026302U, 0x0014d735U, 0x0014d935U, 0x0014db35U,
+    0x0014dd35U, 0x80026101U, 0x80026101U, 0x80026101U, 0x80026101U,
+    0x80026201U, 0x80026302U, 0x0014df35U, 0x0014e135U, 0x0014e335U,
+    0x0014e535U, 0x0014e735U, 0x80026501U, 0x80026501U, 0x80026501U,
+    0x80026601U, 0x80026702U, 0x0014e935U, 0x0014eb35U, 0x0014ed35U,
+    0x0014ef35U, 0x80026501U, 0x80026501U, 0x80026501U, 0x80026501U,
+    0x80026601U, 0x80026702U, 0x80026901U, 0x80026901U, 0x80000000U,
+    0x80000000U, 0x80026a01U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80026b01U, 0x80026b01U, 0x80000000U, 0x80000000U, 0x80026c01U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80026901U, 0x80026901U,
+    0x80000000U, 0x80000000U, 0x80026d01U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80026b01U, 0x80026b01U, 0x80000000U, 0x80000000U,
+    0x80026e01U, 0x80000000U, 0x80000000U, 0x80000000U, 0x0014f135U,
+    0x0014f335U, 0x0014f535U, 0x0014f735U, 0x0014f935U, 0x80026f01U,
+    0x80026f01U, 0x80026f01U, 0x80027001U, 0x80027101U, 0x0014fb35U,
+    0x0014fd35U, 0x0014ff35U, 0x00150135U, 0x80026f01U, 0x80026f01U,
+    0x80026f01U, 0x80026f01U, 0x80027001U, 0x80027101U, 0x00150335U,
+    0x00150535U, 0x00150735U, 0x00150935U, 0x00150b35U, 0x00150d39U,
+    0x00150f39U, 0x00151139U, 0x00151339U, 0x80027201U, 0x00151535U,
+    0x00151735U, 0x00151935U, 0x00151b35U, 0x00151d39U, 0x00151f39U,
+    0x00152139U, 0x00152339U, 0x00152539U, 0x80027201U, 0x00152735U,
+    0x00152935U, 0x00152b35U, 0x00152d35U, 0x00152f35U, 0x80027301U,
+    0x80027301U, 0x80027301U, 0x80027401U, 0x80027501U, 0x00153135U,
+    0x00153335U, 0x00153535U, 0x00153735U, 0x80027301U, 0x80027301U,
+    0x80027301U, 0x80027301U, 0x80027401U, 0x80027501U, 0x00153935U,
+    0x00153b35U, 0x00153d35U, 0x00153f35U, 0x00154135U, 0x80027601U,
+    0x80027601U, 0x80027601U, 0x80027701U, 0x80027801U, 0x00154335U,
+    0x00154535U, 0x00154735U, 0x00154935U, 0x80027601U, 0x80027601U,
+    0x80027601U, 0x80027601U, 0x80027701U, 0x80027801U, 0x8000c101U,
+    0x80000000U, 0x80027901U, 0x80000000U, 0x8000c201U, 0x80000000U,
+    0x80027a01U, 0x80000000U, 0x80027b01U, 0x80027c01U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80027d01U, 0x80027e01U, 0x80027f01U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80028001U, 0x80028101U,
+    0x80028201U, 0x80028301U, 0x80028401U, 0x80028501U, 0x00154b35U,
+    0x00154d35U, 0x00154f35U, 0x00155135U, 0x00155335U, 0x80028601U,
+    0x80028601U, 0x80028601U, 0x80028701U, 0x80028801U, 0x00155535U,
+    0x00155735U, 0x00155935U, 0x00155b35U, 0x80028601U, 0x80028601U,
+    0x80028601U, 0x80028601U, 0x80028701U, 0x80028801U, 0x00155d35U,
+    0x00155f35U, 0x00156135U, 0x00156335U, 0x00156535U, 0x00156739U,
+    0x00156939U, 0x00156b39U, 0x00156d39U, 0x80028901U, 0x00156f35U,
+    0x00157135U, 0x00157335U, 0x00157535U, 0x00157739U, 0x00157939U,
+    0x00157b39U, 0x00157d39U, 0x00157f39U, 0x80028901U, 0x00158135U,
+    0x00158335U, 0x00158535U, 0x00158735U, 0x00158935U, 0x80028a01U,
+    0x80028a01U, 0x80028a01U, 0x80028b01U, 0x80028c01U, 0x00158b35U,
+    0x00158d35U, 0x00158f35U, 0x00159135U, 0x80028a01U, 0x80028a01U,
+    0x80028a01U, 0x80028a01U, 0x80028b01U, 0x80028c01U, 0x80028d01U,
+    0x80028e01U, 0x80028f01U, 0x80028f01U, 0x80000000U, 0x80000000U,
+    0x80029001U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80029101U,
+    0x80029101U, 0x80000000U, 0x80000000U, 0x80029201U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80028f01U, 0x80028f01U, 0x80000000U,
+    0x80000000U, 0x80029301U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80029101U, 0x80029101U, 0x80000000U, 0x80000000U, 0x80029401U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x00159335U, 0x00159535U,
+    0x00159735U, 0x00159935U, 0x00159b35U, 0x80029501U, 0x80029501U,
+    0x80029501U, 0x80029601U, 0x80029701U, 0x00159d35U, 0x00159f35U,
+    0x0015a135U, 0x0015a335U, 0x80029501U, 0x80029501U, 0x80029501U,
+    0x80029501U, 0x80029601U, 0x80029701U, 0x0015a535U, 0x0015a735U,
+    0x0015a935U, 0x0015ab35U, 0x0015ad35U, 0x0015af39U, 0x0015b139U,
+    0x0015b339U, 0x0015b539U, 0x80029801U, 0x0015b735U, 0x0015b935U,
+    0x0015bb35U, 0x0015bd35U, 0x0015bf39U, 0x0015c139U, 0x0015c339U,
+    0x0015c539U, 0x0015c739U, 0x80029801U, 0x0015c935U, 0x0015cb35U,
+    0x0015cd35U, 0x0015cf35U, 0x0015d135U, 0x80029901U, 0x80029901U,
+    0x80029901U, 0x0015d335U, 0x0015d535U, 0x0015d735U, 0x0015d935U,
+    0x80029901U, 0x80029901U, 0x80029901U, 0x80029901U, 0x80029a01U,
+    0x80029b01U, 0x80000000U, 0x80000000U, 0x80029c01U, 0x80029d01U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80029e01U,
+    0x80029f01U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x0015db6dU, 0x0015e324U, 0x0015e56dU,
+    0x8002a001U, 0x8002a101U, 0x0015ed24U, 0x0015ef6dU, 0x8002a001U,
+    0x0015f76dU, 0x0015ff24U, 0x0016016dU, 0x8002a001U, 0x8002a101U,
+    0x00160924U, 0x00160b6dU, 0x8002a001U, 0x80000000U, 0x80000000U,
+    0x8002a201U, 0x8002a301U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x8002a401U, 0x8002a501U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x0016136dU,
+    0x00161b24U, 0x00161d6dU, 0x8002a601U, 0x8002a701U, 0x00162524U,
+    0x0016276dU, 0x8002a601U, 0x00162f6dU, 0x00163724U, 0x0016396dU,
+    0x8002a601U, 0x8002a701U, 0x00164124U, 0x0016436dU, 0x8002a601U,
+    0x80000000U, 0x80000000U, 0x8002a801U, 0x8002a901U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x8002aa01U, 0x8002ab01U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x00164b6dU, 0x00165324U, 0x0016556dU, 0x8002ac01U,
+    0x8002ad01U, 0x00165d24U, 0x00165f6dU, 0x8002ac01U, 0x0016676dU,
+    0x00166f24U, 0x0016716dU, 0x8002ac01U, 0x8002ad01U, 0x00167924U,
+    0x00167b6dU, 0x8002ac01U, 0x8002ae01U, 0x8002af01U, 0x8002b001U,
+    0x8002b101U, 0x8002b201U, 0x8002b301U, 0x8002b401U, 0x8002b501U,
+    0x8002b601U, 0x8002b701U, 0x8002b801U, 0x8002b901U, 0x8002ba01U,
+    0x00168355U, 0x0016876fU, 0x00168f2fU, 0x80000000U, 0x8002bb01U,
+    0x8002bc01U, 0x0016912fU, 0x00169355U, 0x80000000U, 0x0016976fU,
+    0x8002bd01U, 0x8002be01U, 0x80000000U, 0x8002bf01U, 0x80000000U,
+    0x00169f2fU, 0x0016a12fU, 0x0016a32fU, 0x8002c001U, 0x8002c101U,
+    0x8002c201U, 0x8002c301U, 0x8002c401U, 0x0016a56fU, 0x8002c501U,
+    0x8002c501U, 0x8002c601U, 0x8002c501U, 0x0016ad72U, 0x8002c501U,
+    0x80000000U, 0x8002c501U, 0x80000000U, 0x0016b555U, 0x0016b92fU,
+    0x0016bb6fU, 0x0016c355U, 0x8002c701U, 0x0016c72fU, 0x0016c96fU,
+    0x0016d155U, 0x0016d52fU, 0x8002c801U, 0x0016d72fU, 0x80000000U,
+    0x8002c901U, 0x8002ca01U, 0x8002cb01U, 0x8002cc01U, 0x0016d96fU,
+    0x8002cd01U, 0x0016e14aU, 0x0016e572U, 0x0016ed4aU, 0x80000000U,
+    0x0016f14aU, 0x80000000U, 0x0016f54aU, 0x80000000U, 0x0016f955U,
+    0x8002ce01U, 0x0016fd72U, 0x0017052fU, 0x8002cf01U, 0x8002ce01U,
+    0x0017076fU, 0x8002d001U, 0x00170f2fU, 0x8002d101U, 0x0017112fU,
+    0x80000000U, 0x8002d201U, 0x8002d301U, 0x8002d401U, 0x8002d501U,
+    0x80000000U, 0x80000000U, 0x8002d601U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x8002d701U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x0017136fU, 0x8002d801U, 0x8002d901U,
+    0x00171b4aU, 0x80000000U, 0x00171f4aU, 0x80000000U, 0x8002da01U,
+    0x80000000U, 0x8002da01U, 0x8000f801U, 0x8002db01U, 0x8000f801U,
+    0x8002dc01U, 0x8002dd01U, 0x80000000U, 0x8002de01U, 0x80000000U,
+    0x8002df01U, 0x80000000U, 0x8002e001U, 0x80000000U, 0x80000000U,
+    0x8002e101U, 0x80000000U, 0x8002e201U, 0x8002e301U, 0x80000000U,
+    0x8002e401U, 0x80000000U, 0x80000000U, 0x00172335U, 0x8002e501U,
+    0x0017252fU, 0x80000000U, 0x8002e601U, 0x0017276fU, 0x00172f55U,
+    0x80000000U, 0x0017332fU, 0x0017356fU, 0x8002e701U, 0x00173d4aU,
+    0x8002e801U, 0x0017414aU, 0x00174572U, 0x00174d4aU, 0x80000000U,
+    0x0017514aU, 0x80000000U, 0x80000000U, 0x8002e901U, 0x00175572U,
+    0x8002ea01U, 0x80000000U, 0x8002eb01U, 0x8002ec01U, 0x8002ed01U,
+    0x8002ee01U, 0x8002ef01U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x00175d35U,
+    0x8002e501U, 0x00175f2fU, 0x80000000U, 0x8002f001U, 0x8000fb01U,
+    0x80000000U, 0x80000000U, 0x8002f101U, 0x0017616fU, 0x00176955U,
+    0x80000000U, 0x00176d2fU, 0x00176f6fU, 0x8002e701U, 0x0017774aU,
+    0x00177b72U, 0x0017834aU, 0x80000000U, 0x0017874aU, 0x80000000U,
+    0x00178b4aU, 0x80000000U, 0x80000000U, 0x00178f2fU, 0x0017916fU,
+    0x8002ea01U, 0x80000000U, 0x8002f201U, 0x80000000U, 0x8002f301U,
+    0x8002ee01U, 0x8002f401U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x0017992fU,
+    0x80000000U, 0x8002f501U, 0x8002f601U, 0x00179b2fU, 0x8002f601U,
+    0x8002f701U, 0x80010001U, 0x8002f801U, 0x80010001U, 0x80000000U,
+    0x8002f901U, 0x8002fa01U, 0x80010101U, 0x8002fb01U, 0x80010101U,
+    0x8002fc01U, 0x80000000U, 0x80000000U, 0x80000000U, 0x00179d36U,
+    0x00179f36U, 0x0017a136U, 0x0017a336U, 0x0017a536U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x0017a736U, 0x0017a936U, 0x0017ab36U,
+    0x0017ad36U, 0x0017af36U, 0x8002fd01U, 0x80000000U, 0x8002fe01U,
+    0x80000000U, 0x8002ff01U, 0x80000000U, 0x80030001U, 0x80000000U,
+    0x80030101U, 0x80000000U, 0x80030201U, 0x80000000U, 0x80030301U,
+    0x80000000U, 0x80030401U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80030501U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80030601U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80030701U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80030801U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80030901U, 0x80030a01U, 0x80030b01U,
+    0x80030c01U, 0x80030d01U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80030e01U, 0x80030f01U, 0x80031001U, 0x80031101U, 0x80031201U,
+    0x80031301U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80031401U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80031501U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80031601U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80031701U, 0x80031801U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80031901U, 0x80031a01U,
+    0x80000000U, 0x80000000U, 0x80031b01U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80031c01U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80031d01U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80031e01U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80031f01U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80032001U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80032101U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80032201U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80031b01U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80031c01U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80031d01U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80031e01U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80031f01U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80032001U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80032101U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80032201U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80032301U, 0x80032401U, 0x80032301U, 0x80032401U,
+    0x80032301U, 0x80032401U, 0x80032301U, 0x80032401U, 0x80032502U,
+    0x80032702U, 0x80032901U, 0x80032a01U, 0x80032901U, 0x80032a01U,
+    0x80032901U, 0x80032a01U, 0x80032901U, 0x80032a01U, 0x80032b02U,
+    0x80032d02U, 0x80032f01U, 0x80033001U, 0x80032f01U, 0x80033001U,
+    0x80032f01U, 0x80033001U, 0x80032f01U, 0x80033001U, 0x80033102U,
+    0x80033302U, 0x80033501U, 0x80033601U, 0x80033501U, 0x80033601U,
+    0x80033501U, 0x80033601U, 0x80033501U, 0x80033601U, 0x80033702U,
+    0x80033902U, 0x80032301U, 0x80032401U, 0x80032301U, 0x80032401U,
+    0x80032301U, 0x80032401U, 0x80032301U, 0x80032401U, 0x80032502U,
+    0x80032702U, 0x80032901U, 0x80032a01U, 0x80032901U, 0x80032a01U,
+    0x80032901U, 0x80032a01U, 0x80032901U, 0x80032a01U, 0x80032b02U,
+    0x80032d02U, 0x80032f01U, 0x80033001U, 0x80032f01U, 0x80033001U,
+    0x80032f01U, 0x80033001U, 0x80032f01U, 0x80033001U, 0x80033102U,
+    0x80033302U, 0x80033501U, 0x80033601U, 0x80033501U, 0x80033601U,
+    0x80033501U, 0x80033601U, 0x80033501U, 0x80033601U, 0x80033702U,
+    0x80033902U, 0x80033b01U, 0x80033c01U, 0x80000000U, 0x80000000U,
+    0x80033b01U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80033d01U,
+    0x80033e01U, 0x80000000U, 0x80000000U, 0x80033d01U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80033b01U, 0x80033c01U, 0x80000000U,
+    0x80000000U, 0x80033b01U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80033d01U, 0x80033e01U, 0x80000000U, 0x80000000U, 0x80033d01U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80033f01U, 0x80034001U,
+    0x80000000U, 0x80000000U, 0x80033f01U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80034101U, 0x80034201U, 0x80000000U, 0x80000000U,
+    0x80034101U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80033f01U,
+    0x80034001U, 0x80000000U, 0x80000000U, 0x80033f01U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80034101U, 0x80034201U, 0x80000000U,
+    0x80000000U, 0x80034101U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80034301U, 0x80034401U, 0x80000000U, 0x80000000U, 0x80034301U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80034501U, 0x80034601U,
+    0x80000000U, 0x80000000U, 0x80034501U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80034301U, 0x80034401U, 0x80000000U, 0x80000000U,
+    0x80034301U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80034501U,
+    0x80034601U, 0x80000000U, 0x80000000U, 0x80034501U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80034701U, 0x80034801U, 0x80000000U,
+    0x80000000U, 0x80034701U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80034901U, 0x80034a01U, 0x80000000U, 0x80000000U, 0x80034901U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80034701U, 0x80034801U,
+    0x80000000U, 0x80000000U, 0x80034701U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80034901U, 0x80034a01U, 0x80000000U, 0x80000000U,
+    0x80034901U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80034b01U,
+    0x80034c01U, 0x80000000U, 0x80000000U, 0x80034b01U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80034d02U, 0x80034f02U, 0x80000000U,
+    0x80000000U, 0x80034d02U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80035101U, 0x80035201U, 0x80000000U, 0x80000000U, 0x80035101U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80035302U, 0x80035502U,
+    0x80000000U, 0x80000000U, 0x80035302U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80035701U, 0x80035801U, 0x80000000U, 0x80000000U,
+    0x80035701U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80035902U,
+    0x80035b02U, 0x80000000U, 0x80000000U, 0x80035902U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80035d01U, 0x80035e01U, 0x80000000U,
+    0x80000000U, 0x80035d01U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80035f02U, 0x80036102U, 0x80000000U, 0x80000000U, 0x80035f02U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80034b01U, 0x80034c01U,
+    0x80000000U, 0x80000000U, 0x80034b01U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80034d02U, 0x80034f02U, 0x80000000U, 0x80000000U,
+    0x80034d02U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80035101U,
+    0x80035201U, 0x80000000U, 0x80000000U, 0x80035101U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80035302U, 0x80035502U, 0x80000000U,
+    0x80000000U, 0x80035302U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80035701U, 0x80035801U, 0x80000000U, 0x80000000U, 0x80035701U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80035902U, 0x80035b02U,
+    0x80000000U, 0x80000000U, 0x80035902U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80035d01U, 0x80035e01U, 0x80000000U, 0x80000000U,
+    0x80035d01U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80035f02U,
+    0x80036102U, 0x80000000U, 0x80000000U, 0x80035f02U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80036301U, 0x80036401U, 0x80000000U,
+    0x80000000U, 0x80036301U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80036502U, 0x80036702U, 0x80000000U, 0x80000000U, 0x80036502U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80036901U, 0x80036a01U,
+    0x80000000U, 0x80000000U, 0x80036901U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80036b02U, 0x80036d02U, 0x80000000U, 0x80000000U,
+    0x80036b02U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80036f01U,
+    0x80037001U, 0x80000000U, 0x80000000U, 0x80036f01U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80037102U, 0x80037302U, 0x80000000U,
+    0x80000000U, 0x80037102U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80037501U, 0x80037601U, 0x80000000U, 0x80000000U, 0x80037501U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80037702U, 0x80037902U,
+    0x80000000U, 0x80000000U, 0x80037702U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80036301U, 0x80036401U, 0x80000000U, 0x80000000U,
+    0x80036301U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80036502U,
+    0x80036702U, 0x80000000U, 0x80000000U, 0x80036502U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80036901U, 0x80036a01U, 0x80000000U,
+    0x80000000U, 0x80036901U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80036b02U, 0x80036d02U, 0x80000000U, 0x80000000U, 0x80036b02U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80036f01U, 0x80037001U,
+    0x80000000U, 0x80000000U, 0x80036f01U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80037102U, 0x80037302U, 0x80000000U, 0x80000000U,
+    0x80037102U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80037501U,
+    0x80037601U, 0x80000000U, 0x80000000U, 0x80037501U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80037702U, 0x80037902U, 0x80000000U,
+    0x80000000U, 0x80037702U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80037b01U, 0x80037c01U, 0x80000000U, 0x80037c01U, 0x8001c401U,
+    0x80037d01U, 0x80000000U, 0x80037d01U, 0x80037b01U, 0x80037c01U,
+    0x80000000U, 0x80037c01U, 0x8001c401U, 0x80037d01U, 0x80000000U,
+    0x80037d01U, 0x80037e01U, 0x80037f01U, 0x80038001U, 0x80037f01U,
+    0x80000000U, 0x80038101U, 0x80038201U, 0x80038101U, 0x80037e01U,
+    0x80037f01U, 0x80038001U, 0x80037f01U, 0x80038301U, 0x80038101U,
+    0x80038201U, 0x80038101U, 0x80038401U, 0x80038501U, 0x80038401U,
+    0x80038501U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80038601U, 0x80038701U, 0x80038801U, 0x80038701U, 0x80038601U,
+    0x80038701U, 0x80038801U, 0x80038701U, 0x80038301U, 0x8001c501U,
+    0x80000000U, 0x8001c501U, 0x80038901U, 0x80038a01U, 0x80000000U,
+    0x80038a01U, 0x8001c401U, 0x8001fa01U, 0x80000000U, 0x8001fa01U,
+    0x80038901U, 0x80038a01U, 0x80000000U, 0x80038a01U, 0x8001c401U,
+    0x8001fa01U, 0x80000000U, 0x8001fa01U, 0x80000000U, 0x80038b01U,
+    0x80038c01U, 0x80038b01U, 0x80000000U, 0x80038d01U, 0x80038e01U,
+    0x80038d01U, 0x80000000U, 0x80038b01U, 0x80038c01U, 0x80038b01U,
+    0x80038301U, 0x80038d01U, 0x80038e01U, 0x80038d01U, 0x8001fb01U,
+    0x8001fb01U, 0x8001fb01U, 0x8001fb01U, 0x80038f01U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x8001fb01U, 0x8001fb01U, 0x8001fb01U,
+    0x8001fb01U, 0x80038f01U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80039001U, 0x80039101U, 0x80039201U, 0x80000000U,
+    0x80039301U, 0x80039401U, 0x80039501U, 0x80039601U, 0x80039001U,
+    0x80039101U, 0x80039201U, 0x80038301U, 0x80039301U, 0x80039401U,
+    0x80039501U, 0x80039701U, 0x80039801U, 0x80000000U, 0x80039801U,
+    0x8001c401U, 0x80039901U, 0x80000000U, 0x80039901U, 0x80039701U,
+    0x80039801U, 0x80000000U, 0x80039801U, 0x8001c401U, 0x80039901U,
+    0x80000000U, 0x80039901U, 0x80000000U, 0x80039a01U, 0x80039b01U,
+    0x80039a01U, 0x80000000U, 0x80039c01U, 0x80039d01U, 0x80039c01U,
+    0x80000000U, 0x80039a01U, 0x80039b01U, 0x80039a01U, 0x80038301U,
+    0x80039c01U, 0x80039d01U, 0x80039c01U, 0x8001fc01U, 0x8001fc01U,
+    0x8001fc01U, 0x8001fc01U, 0x0017b170U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x8001c401U, 0x8001c401U, 0x8001c401U, 0x8001c401U,
+    0x0017b970U, 0x80000000U, 0x80000000U, 0x80000000U, 0x8001fc01U,
+    0x8001fc01U, 0x8001fc01U, 0x8001fc01U, 0x0017c170U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x8001c401U, 0x8001c401U, 0x8001c401U,
+    0x8001c401U, 0x0017c970U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80039e01U, 0x80039f01U, 0x80000000U, 0x80039f01U, 0x80000000U,
+    0x8003a001U, 0x8003a101U, 0x8003a001U, 0x8003a201U, 0x80039f01U,
+    0x80000000U, 0x80039f01U, 0x80038301U, 0x8003a001U, 0x8003a101U,
+    0x8003a001U, 0x8003a301U, 0x8003a401U, 0x80000000U, 0x8003a401U,
+    0x8001c401U, 0x8001fd01U, 0x80000000U, 0x8001fd01U, 0x8003a301U,
+    0x8003a401U, 0x80000000U, 0x8003a401U, 0x8001c401U, 0x8001fd01U,
+    0x80000000U, 0x8001fd01U, 0x80000000U, 0x8003a501U, 0x8003a601U,
+    0x8003a501U, 0x80000000U, 0x8003a701U, 0x8003a801U, 0x8003a701U,
+    0x80000000U, 0x8003a501U, 0x8003a601U, 0x8003a501U, 0x80038301U,
+    0x8003a701U, 0x8003a801U, 0x8003a701U, 0x8001fe01U, 0x8001c401U,
+    0x8001fe01U, 0x8001c401U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x8001fe01U, 0x8001c401U, 0x8001fe01U, 0x8001c401U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x8001fe01U,
+    0x8001c401U, 0x8001fe01U, 0x8001c401U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x8001fe01U, 0x8001c401U, 0x8001fe01U,
+    0x8001c401U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x0017d17dU, 0x8003a901U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x8003aa01U, 0x8003ab01U,
+    0x8003aa01U, 0x8003ab01U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x8003ac01U, 0x8003ad01U, 0x8003ae01U, 0x8003ad01U,
+    0x80000000U, 0x8001ff01U, 0x8003af01U, 0x8001ff01U, 0x8003b001U,
+    0x8003ad01U, 0x8003ae01U, 0x8003ad01U, 0x80038301U, 0x8001ff01U,
+    0x8003af01U, 0x8001ff01U, 0x8003b101U, 0x8003b201U, 0x80000000U,
+    0x8003b201U, 0x8001c401U, 0x8003b301U, 0x80000000U, 0x8003b301U,
+    0x8003b101U, 0x8003b201U, 0x80000000U, 0x8003b201U, 0x8001c401U,
+    0x8003b301U, 0x80000000U, 0x8003b301U, 0x80038301U, 0x8001c701U,
+    0x80000000U, 0x8001c701U, 0x0017d97dU, 0x0017e17dU, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80038301U, 0x8001ca01U, 0x80000000U, 0x8001ca01U, 0x8003b401U,
+    0x8003b501U, 0x80000000U, 0x8003b501U, 0x8001c401U, 0x80020001U,
+    0x80000000U, 0x80020001U, 0x8003b401U, 0x8003b501U, 0x80000000U,
+    0x8003b501U, 0x8001c401U, 0x80020001U, 0x80000000U, 0x80020001U,
+    0x80038301U, 0x8001cc01U, 0x80000000U, 0x8001cc01U, 0x8001cd01U,
+    0x8001c401U, 0x8001cd01U, 0x8001c401U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x8001cd01U, 0x8001c401U, 0x8001cd01U,
+    0x8001c401U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x0017e97dU, 0x80000000U, 0x80000000U, 0x80000000U, 0x8003b601U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x8003b701U, 0x8003b801U,
+    0x8003b701U, 0x8003b801U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80038301U, 0x8001cf01U, 0x80000000U, 0x8001cf01U,
+    0x8003b901U, 0x8003ba01U, 0x80000000U, 0x8003ba01U, 0x8001c401U,
+    0x80020101U, 0x80000000U, 0x80020101U, 0x8003b901U, 0x8003ba01U,
+    0x80000000U, 0x8003ba01U, 0x8001c401U, 0x80020101U, 0x80000000U,
+    0x80020101U, 0x80038301U, 0x8001d101U, 0x80000000U, 0x8001d101U,
+    0x80020201U, 0x8001c401U, 0x80020201U, 0x8001c401U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80020201U, 0x8001c401U,
+    0x80020201U, 0x8001c401U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80020201U, 0x8001c401U, 0x80020201U, 0x8001c401U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80020201U,
+    0x8001c401U, 0x80020201U, 0x8001c401U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x0017f17dU, 0x0017f97dU, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80038301U, 0x8001d401U, 0x80000000U, 0x8001d401U, 0x8003bb01U,
+    0x80020301U, 0x80000000U, 0x80020301U, 0x8001c401U, 0x80020401U,
+    0x80000000U, 0x80020401U, 0x8003bb01U, 0x80020301U, 0x80000000U,
+    0x80020301U, 0x8001c401U, 0x80020401U, 0x80000000U, 0x80020401U,
+    0x80038301U, 0x8001d601U, 0x80000000U, 0x8001d601U, 0x8003bc01U,
+    0x8003bc01U, 0x8003bc01U, 0x8003bc01U, 0x00180170U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x8001c401U, 0x8001c401U, 0x8003bd01U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x8003bd01U, 0x80000000U,
+    0x8003bc01U, 0x8003bc01U, 0x8003bc01U, 0x8003bc01U, 0x00180970U,
+    0x8003be01U, 0x80000000U, 0x80000000U, 0x8001c401U, 0x8001c401U,
+    0x8003bd01U, 0x80000000U, 0x80000000U, 0x80000000U, 0x8003bd01U,
+    0x80000000U, 0x80038301U, 0x8001d801U, 0x80000000U, 0x8001d801U,
+    0x8003bf01U, 0x8003c001U, 0x8003bf01U, 0x8003c001U, 0x8003c101U,
+    0x8003c201U, 0x8003c101U, 0x8003c201U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x0018117dU, 0x80000000U, 0x80000000U, 0x0018197dU,
+    0x8003c301U, 0x8003c401U, 0x8003c301U, 0x8003c401U, 0x8003c501U,
+    0x8003c601U, 0x8003c501U, 0x8003c601U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x0018217dU, 0x80000000U, 0x80000000U, 0x0018297dU,
+    0x8003c701U, 0x0018317dU, 0x80000000U, 0x80000000U, 0x0018397dU,
+    0x0018417dU, 0x80000000U, 0x80000000U, 0x8003c801U, 0x8003c901U,
+    0x8003c801U, 0x8003c901U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x0018497dU, 0x0018517dU, 0x80000000U, 0x80000000U,
+    0x8003ca01U, 0x8003cb01U, 0x8003ca01U, 0x8003cb01U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x8003cc01U, 0x8003cd01U,
+    0x8003cc01U, 0x8003cd01U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x8003ce01U, 0x8003cf01U, 0x8003ce01U, 0x8003cf01U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x8003d001U,
+    0x8003d101U, 0x8003d001U, 0x8003d101U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x8003d201U, 0x8003d301U, 0x8003d201U,
+    0x8003d301U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x8003d401U, 0x8003d501U, 0x8003d401U, 0x8003d501U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80037c01U, 0x8001d901U,
+    0x80037d01U, 0x8001da01U, 0x80037c01U, 0x8001d901U, 0x80037d01U,
+    0x8001da01U, 0x80000000U, 0x0018592fU, 0x8003d601U, 0x00185b2fU,
+    0x8003bf01U, 0x00185d2fU, 0x00185f2fU, 0x0018612fU, 0x80000000U,
+    0x0018632fU, 0x8003d601U, 0x0018652fU, 0x8003bf01U, 0x0018672fU,
+    0x0018692fU, 0x00186b2fU, 0x80038401U, 0x80038501U, 0x80038401U,
+    0x80038501U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x8003c101U, 0x8003c201U, 0x8003c101U, 0x8003c201U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x8003d701U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x8003d801U,
+    0x80000000U, 0x80000000U, 0x00186d2fU, 0x8003d901U, 0x00186f2fU,
+    0x8001c501U, 0x00187135U, 0x80000000U, 0x0018732fU, 0x8003d901U,
+    0x0018752fU, 0x8001c501U, 0x00187735U, 0x80038a01U, 0x80008f01U,
+    0x80038a01U, 0x80008f01U, 0x80000000U, 0x0018792fU, 0x8003da01U,
+    0x00187b2fU, 0x80000000U, 0x00187d2fU, 0x8003db01U, 0x00187f2fU,
+    0x80000000U, 0x0018812fU, 0x8003da01U, 0x0018832fU, 0x80000000U,
+    0x0018852fU, 0x8003db01U, 0x0018872fU, 0x8001fb01U, 0x8001fb01U,
+    0x8001fb01U, 0x8001fb01U, 0x80038f01U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x8003c501U, 0x8003c601U, 0x8003c501U, 0x8003c601U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x0018897dU,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x0018917dU, 0x80000000U, 0x80000000U, 0x0018992fU, 0x80000000U,
+    0x00189b2fU, 0x80000000U, 0x00189d2fU, 0x80000000U, 0x00189f2fU,
+    0x80000000U, 0x0018a12fU, 0x80000000U, 0x0018a32fU, 0x80000000U,
+    0x0018a52fU, 0x80000000U, 0x0018a72fU, 0x80039801U, 0x8001e101U,
+    0x80039901U, 0x8001e201U, 0x80039801U, 0x8001e101U, 0x80039901U,
+    0x8001e201U, 0x80039a01U, 0x8001e301U, 0x80000000U, 0x0018a92fU,
+    0x8003dc01U, 0x0018ab2fU, 0x80039a01U, 0x8001e301U, 0x80000000U,
+    0x0018ad2fU, 0x8003dc01U, 0x0018af2fU, 0x8001fc01U, 0x8001fc01U,
+    0x8001fc01U, 0x8001fc01U, 0x0018b17dU, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x8003c701U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x0018b97dU, 0x80000000U, 0x80000000U, 0x80000000U, 0x8001fc01U,
+    0x8001fc01U, 0x8001fc01U, 0x8001fc01U, 0x0018c17dU, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x0018c97dU, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x0018d17dU, 0x80000000U, 0x0018d97dU, 0x80000000U,
+    0x80039f01U, 0x8001e501U, 0x80000000U, 0x0018e12fU, 0x8003dd01U,
+    0x0018e32fU, 0x80039f01U, 0x8001e501U, 0x80000000U, 0x0018e52fU,
+    0x8003dd01U, 0x0018e72fU, 0x8003a401U, 0x80009001U, 0x8003a401U,
+    0x80009001U, 0x80000000U, 0x0018e92fU, 0x8003de01U, 0x0018eb2fU,
+    0x80000000U, 0x0018ed2fU, 0x8003df01U, 0x0018ef2fU, 0x80000000U,
+    0x0018f12fU, 0x8003de01U, 0x0018f32fU, 0x80000000U, 0x0018f52fU,
+    0x8003df01U, 0x0018f72fU, 0x8001fe01U, 0x8001fe01U, 0x8001fe01U,
+    0x8001fe01U, 0x0018f97dU, 0x80000000U, 0x0019017dU, 0x80000000U,
+    0x8003e001U, 0x8003e101U, 0x8003e001U, 0x8003e101U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x8001fe01U, 0x8003a901U,
+    0x8001fe01U, 0x8003a901U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x0019097dU, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x8001e901U, 0x80000000U, 0x0019117dU, 0x80000000U, 0x80000000U,
+    0x0019192fU, 0x8003e201U, 0x00191b2fU, 0x80000000U, 0x00191d2fU,
+    0x8003e201U, 0x00191f2fU, 0x8003b201U, 0x8001ea01U, 0x8003b301U,
+    0x8001eb01U, 0x8003b201U, 0x8001ea01U, 0x8003b301U, 0x8001eb01U,
+    0x8001c601U, 0x8003e301U, 0x8001c701U, 0x8003e401U, 0x8001c601U,
+    0x8003e301U, 0x8001c701U, 0x8003e401U, 0x8003e501U, 0x8003e601U,
+    0x8003e501U, 0x8003e601U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x0019217dU, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x0019297dU, 0x80000000U, 0x0019317dU, 0x80000000U, 0x8003e701U,
+    0x8003e801U, 0x8003e701U, 0x8003e801U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x8003e901U, 0x8003ea01U, 0x8003e901U,
+    0x8003ea01U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x8001c901U, 0x8003eb01U, 0x8001c901U, 0x8003eb01U, 0x8003b501U,
+    0x80009301U, 0x8003b501U, 0x80009301U, 0x8001cb01U, 0x8003ec01U,
+    0x8001cc01U, 0x8003ed01U, 0x8001cb01U, 0x8003ec01U, 0x8001cc01U,
+    0x8003ed01U, 0x8001cd01U, 0x8001cd01U, 0x8001cd01U, 0x8001cd01U,
+    0x8003b701U, 0x80000000U, 0x80000000U, 0x80000000U, 0x0019397dU,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x0019417dU, 0x80000000U, 0x0019497dU, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x0019517dU, 0x80000000U,
+    0x8003ba01U, 0x80009401U, 0x8003ba01U, 0x80009401U, 0x8001d101U,
+    0x8003ee01U, 0x8001d101U, 0x8003ee01U, 0x80020201U, 0x80020201U,
+    0x80020201U, 0x80020201U, 0x0019597dU, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x8003ef01U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x8003f001U, 0x80000000U, 0x8001d401U,
+    0x8003f101U, 0x8001d401U, 0x8003f101U, 0x8001d501U, 0x8003f201U,
+    0x8003bc01U, 0x8003bc01U, 0x8003bc01U, 0x8003bc01U, 0x0019616fU,
+    0x80000000U, 0x8003f301U, 0x8003f401U, 0x8001d701U, 0x8003f501U,
+    0x8001d601U, 0x8003f601U, 0x8003bd01U, 0x00196972U, 0x80000000U,
+    0x00197172U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x8001d501U, 0x8003f201U, 0x8003bc01U, 0x8003bc01U, 0x8003bc01U,
+    0x8003bc01U, 0x0019796fU, 0x80000000U, 0x8003f301U, 0x8003f401U,
+    0x8001d701U, 0x8003f501U, 0x8001d601U, 0x8003f601U, 0x8003bd01U,
+    0x00198172U, 0x80000000U, 0x00198972U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80024e01U, 0x8003f701U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x00199168U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x00199968U, 0x80000000U, 0x80000000U, 0x8003f801U,
+    0x80000000U, 0x8003f901U, 0x8003fa01U, 0x8003fb01U, 0x80000000U,
+    0x80000000U, 0x8003fc01U, 0x8003fd01U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x8003fe01U,
+    0x8003ff01U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x0019a139U, 0x80040002U, 0x80025b01U, 0x80040202U,
+    0x80025b01U, 0x80040402U, 0x80025b01U, 0x80040602U, 0x80025b01U,
+    0x80040801U, 0x80025b01U, 0x80040902U, 0x80025b01U, 0x80040b02U,
+    0x80025b01U, 0x80040d02U, 0x80025b01U, 0x80040f02U, 0x0019a339U,
+    0x80041102U, 0x0019a539U, 0x80041302U, 0x0019a739U, 0x80041502U,
+    0x0019a939U, 0x80041702U, 0x0019ab39U, 0x80041901U, 0x80041a01U,
+    0x80041b01U, 0x80041a01U, 0x80041b01U, 0x80041a01U, 0x80041b01U,
+    0x80041c01U, 0x80041d01U, 0x0019ad39U, 0x80041e02U, 0x0019af39U,
+    0x80042002U, 0x0019b139U, 0x80042202U, 0x0019b339U, 0x80042402U,
+    0x80041a01U, 0x80041b01U, 0x80041a01U, 0x80041b01U, 0x80041a01U,
+    0x80041b01U, 0x80041a01U, 0x80041b01U, 0x80041c01U, 0x80041d01U,
+    0x80026101U, 0x80042601U, 0x80026101U, 0x80042701U, 0x80026101U,
+    0x80042801U, 0x80026101U, 0x80042901U, 0x80026101U, 0x80042a01U,
+    0x80026101U, 0x80042b01U, 0x80026101U, 0x80042c01U, 0x80026101U,
+    0x80042d01U, 0x80026101U, 0x80042e01U, 0x80026501U, 0x80042f01U,
+    0x80026501U, 0x80043001U, 0x80026501U, 0x80043101U, 0x80026501U,
+    0x80043201U, 0x80026501U, 0x80043301U, 0x80026501U, 0x80043401U,
+    0x80026501U, 0x80043501U, 0x80026501U, 0x80043601U, 0x80026501U,
+    0x80043701U, 0x0019b539U, 0x80043802U, 0x80026f01U, 0x80043a02U,
+    0x80026f01U, 0x80043c02U, 0x80026f01U, 0x80043e02U, 0x80026f01U,
+    0x80044001U, 0x80026f01U, 0x80044102U, 0x80026f01U, 0x80044302U,
+    0x80026f01U, 0x80044502U, 0x80026f01U, 0x80044702U, 0x0019b739U,
+    0x80044902U, 0x0019b939U, 0x80044b02U, 0x0019bb39U, 0x80044d02U,
+    0x0019bd39U, 0x80044f02U, 0x0019bf39U, 0x80045101U, 0x80045201U,
+    0x80045301U, 0x80045201U, 0x80045301U, 0x80045201U, 0x80045301U,
+    0x80045401U, 0x80045501U, 0x0019c139U, 0x80045602U, 0x0019c339U,
+    0x80045802U, 0x0019c539U, 0x80045a02U, 0x0019c739U, 0x80045c02U,
+    0x80045201U, 0x80045301U, 0x80045201U, 0x80045301U, 0x80045201U,
+    0x80045301U, 0x80045201U, 0x80045301U, 0x80045401U, 0x80045501U,
+    0x80027301U, 0x80045e01U, 0x80027301U, 0x80045f01U, 0x80027301U,
+    0x80046001U, 0x80027301U, 0x80046101U, 0x80027301U, 0x80046201U,
+    0x80027301U, 0x80046301U, 0x80027301U, 0x80046401U, 0x80027301U,
+    0x80046501U, 0x80027301U, 0x80046601U, 0x80027601U, 0x80046701U,
+    0x80027601U, 0x80046801U, 0x80027601U, 0x80046901U, 0x80027601U,
+    0x80046a01U, 0x80027601U, 0x80046b01U, 0x80027601U, 0x80046c01U,
+    0x80027601U, 0x80046d01U, 0x80027601U, 0x80046e01U, 0x80027601U,
+    0x80046f01U, 0x0019c939U, 0x80047002U, 0x80028601U, 0x80047202U,
+    0x80028601U, 0x80047402U, 0x80028601U, 0x80047602U, 0x80028601U,
+    0x80047801U, 0x80028601U, 0x80047902U, 0x80028601U, 0x80047b02U,
+    0x80028601U, 0x80047d02U, 0x80028601U, 0x80047f02U, 0x0019cb39U,
+    0x80048102U, 0x0019cd39U, 0x80048302U, 0x0019cf39U, 0x80048502U,
+    0x0019d139U, 0x80048702U, 0x0019d339U, 0x80048901U, 0x80048a01U,
+    0x80048b01U, 0x80048a01U, 0x80048b01U, 0x80048a01U, 0x80048b01U,
+    0x80048c01U, 0x80048d01U, 0x0019d539U, 0x80048e02U, 0x0019d739U,
+    0x80049002U, 0x0019d939U, 0x80049202U, 0x0019db39U, 0x80049402U,
+    0x80048a01U, 0x80048b01U, 0x80048a01U, 0x80048b01U, 0x80048a01U,
+    0x80048b01U, 0x80048a01U, 0x80048b01U, 0x80048c01U, 0x80048d01U,
+    0x80028a01U, 0x80049601U, 0x80028a01U, 0x80049701U, 0x80028a01U,
+    0x80049801U, 0x80028a01U, 0x80049901U, 0x80028a01U, 0x80049a01U,
+    0x80028a01U, 0x80049b01U, 0x80028a01U, 0x80049c01U, 0x80028a01U,
+    0x80049d01U, 0x80028a01U, 0x80049e01U, 0x0019dd39U, 0x80049f02U,
+    0x80029501U, 0x8004a102U, 0x80029501U, 0x8004a302U, 0x80029501U,
+    0x8004a502U, 0x80029501U, 0x8004a701U, 0x80029501U, 0x8004a802U,
+    0x80029501U, 0x8004aa02U, 0x80029501U, 0x8004ac02U, 0x80029501U,
+    0x8004ae02U, 0x0019df39U, 0x8004b002U, 0x0019e139U, 0x8004b202U,
+    0x0019e339U, 0x8004b402U, 0x0019e539U, 0x8004b602U, 0x0019e739U,
+    0x8004b801U, 0x8004b901U, 0x8004ba01U, 0x8004b901U, 0x8004ba01U,
+    0x8004b901U, 0x8004ba01U, 0x8004bb01U, 0x8004bc01U, 0x0019e939U,
+    0x8004bd02U, 0x0019eb39U, 0x8004bf02U, 0x0019ed39U, 0x8004c102U,
+    0x0019ef39U, 0x8004c302U, 0x8004b901U, 0x8004ba01U, 0x8004b901U,
+    0x8004ba01U, 0x8004b901U, 0x8004ba01U, 0x8004b901U, 0x8004ba01U,
+    0x8004bb01U, 0x8004bc01U, 0x80029901U, 0x8004c501U, 0x80029901U,
+    0x8004c601U, 0x80029901U, 0x8004c701U, 0x80029901U, 0x8004c801U,
+    0x80029901U, 0x8004c901U, 0x80029901U, 0x8004ca01U, 0x80029901U,
+    0x8004cb01U, 0x80029901U, 0x8004cc01U, 0x80029901U, 0x8004cd01U,
+    0x0019f170U, 0x0019f962U, 0x001a0170U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x001a0970U, 0x80000000U, 0x8004ce01U, 0x8004cf01U,
+    0x8004d001U, 0x8004d101U, 0x8004d201U, 0x8004d301U, 0x8004d401U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x8004ce01U, 0x8004cf01U,
+    0x8004d501U, 0x8004d601U, 0x8004d701U, 0x8004d801U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x001a1170U, 0x001a1962U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x8004ce01U, 0x8004cf01U, 0x8004d001U, 0x8004d101U,
+    0x8004d201U, 0x8004d301U, 0x8004d401U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x8004ce01U, 0x8004cf01U, 0x8004d501U, 0x8004d601U,
+    0x8004d701U, 0x8004d801U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x001a2170U, 0x001a2962U, 0x001a3170U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x001a3970U, 0x80000000U, 0x8004d901U,
+    0x8004da01U, 0x8004db01U, 0x8004dc01U, 0x8004dd01U, 0x8004de01U,
+    0x8004df01U, 0x80000000U, 0x80000000U, 0x80000000U, 0x8004d901U,
+    0x8004da01U, 0x8004e001U, 0x8004e101U, 0x8004e201U, 0x8004e301U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x001a4170U,
+    0x001a4962U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x8004d901U, 0x8004da01U, 0x8004db01U,
+    0x8004dc01U, 0x8004dd01U, 0x8004de01U, 0x8004df01U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x8004d901U, 0x8004da01U, 0x8004e001U,
+    0x8004e101U, 0x8004e201U, 0x8004e301U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x001a5170U, 0x001a5962U, 0x001a6170U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x001a6970U, 0x80000000U,
+    0x8004e401U, 0x8004e501U, 0x8004e601U, 0x8004e701U, 0x8004e801U,
+    0x8004e901U, 0x8004ea01U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x8004e401U, 0x8004e501U, 0x8004eb01U, 0x8004ec01U, 0x8004ed01U,
+    0x8004ee01U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x001a7170U, 0x001a7962U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x8004e401U, 0x8004e501U,
+    0x8004e601U, 0x8004e701U, 0x8004e801U, 0x8004e901U, 0x8004ea01U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x8004e401U, 0x8004e501U,
+    0x8004eb01U, 0x8004ec01U, 0x8004ed01U, 0x8004ee01U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x8004ef01U, 0x8002bb01U,
+    0x80000000U, 0x8002bb01U, 0x8004f001U, 0x8002bc01U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x8004f101U, 0x8004f201U, 0x8004f101U, 0x8004f201U, 0x8004f301U,
+    0x8002be01U, 0x80000000U, 0x8002be01U, 0x8004f401U, 0x8002bf01U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x8004f501U, 0x8004f601U, 0x8004f701U, 0x8004f801U,
+    0x8004f501U, 0x8004f601U, 0x8004f901U, 0x8002c601U, 0x80000000U,
+    0x001a8172U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x8004fa01U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x8004fb01U, 0x80000000U, 0x8004fc01U, 0x8002c701U,
+    0x80000000U, 0x8002c701U, 0x8004fd01U, 0x8004fe01U, 0x8004ff01U,
+    0x80050001U, 0x80000000U, 0x001a8972U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80050101U, 0x80050201U,
+    0x80050101U, 0x8004fd01U, 0x8004fe01U, 0x8004ff01U, 0x80050001U,
+    0x80000000U, 0x001a9172U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80050101U, 0x80050301U, 0x80050101U,
+    0x8002c901U, 0x8002ca01U, 0x8002c901U, 0x8002ca01U, 0x80000000U,
+    0x80050401U, 0x80050501U, 0x001a9972U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x8002cc01U, 0x80000000U,
+    0x8002cd01U, 0x80050601U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80050701U, 0x80000000U, 0x80050801U, 0x80000000U, 0x80000000U,
+    0x8002cc01U, 0x80050501U, 0x8002cd01U, 0x80000000U, 0x8002cc01U,
+    0x80000000U, 0x8002cd01U, 0x80000000U, 0x8002cc01U, 0x80000000U,
+    0x8002cd01U, 0x80050901U, 0x8002cf01U, 0x80000000U, 0x8002cf01U,
+    0x80050a01U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80050b01U,
+    0x80000000U, 0x80050c01U, 0x80000000U, 0x8002d001U, 0x80050d01U,
+    0x80000000U, 0x001aa172U, 0x80000000U, 0x001aa972U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80050e01U, 0x8002d301U,
+    0x80050e01U, 0x8002d301U, 0x8002d901U, 0x80050f01U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80051001U, 0x8002da01U, 0x80000000U,
+    0x80000000U, 0x001ab172U, 0x8002da01U, 0x80051101U, 0x80051201U,
+    0x80051301U, 0x001ab935U, 0x80000000U, 0x80000000U, 0x80051401U,
+    0x001abb72U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80051501U, 0x80051601U, 0x80051501U, 0x80051701U,
+    0x80051801U, 0x80051901U, 0x80051a01U, 0x80000000U, 0x001ac372U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80051b01U, 0x80000000U, 0x80051c01U, 0x80000000U, 0x80051b01U,
+    0x80051d01U, 0x80051c01U, 0x80051e01U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80051f01U, 0x80000000U,
+    0x80000000U, 0x80051b01U, 0x80000000U, 0x80051c01U, 0x80000000U,
+    0x80051b01U, 0x80000000U, 0x80051c01U, 0x80052001U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80052101U, 0x80000000U, 0x80052201U,
+    0x80000000U, 0x80051101U, 0x80051201U, 0x80051301U, 0x001acb35U,
+    0x80000000U, 0x80000000U, 0x80051401U, 0x001acd72U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80051501U,
+    0x80052301U, 0x80051501U, 0x80051701U, 0x80051801U, 0x80051901U,
+    0x80051a01U, 0x80000000U, 0x001ad572U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80051b01U, 0x80000000U,
+    0x80051c01U, 0x80052401U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80052501U, 0x80000000U, 0x80052601U, 0x80000000U, 0x80000000U,
+    0x80051b01U, 0x80051d01U, 0x80051c01U, 0x80000000U, 0x80051b01U,
+    0x80000000U, 0x80051c01U, 0x80000000U, 0x80051b01U, 0x80000000U,
+    0x80051c01U, 0x8002e901U, 0x80052701U, 0x80000000U, 0x001add72U,
+    0x80000000U, 0x001ae572U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80052801U, 0x80052901U, 0x80052a01U, 0x80052b01U,
+    0x80052c01U, 0x80052d01U, 0x80052e01U, 0x80052f01U, 0x80053001U,
+    0x80053101U, 0x80053201U, 0x80053301U, 0x80053401U, 0x80053501U,
+    0x80053601U, 0x80053701U, 0x80053801U, 0x80053901U, 0x80053a01U,
+    0x80053b01U, 0x80053c01U, 0x80053d01U, 0x80053e01U, 0x80053f01U,
+    0x80054001U, 0x80054101U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80054201U, 0x80054301U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80054001U, 0x80054101U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80054201U,
+    0x80054301U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80054401U, 0x80054501U, 0x80054401U,
+    0x80054501U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x8003e501U, 0x8003e601U, 0x8003e501U, 0x8003e601U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x8003e701U, 0x8003e801U,
+    0x8003e701U, 0x8003e801U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x8003b701U, 0x80054601U, 0x8003b701U, 0x80054601U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80054701U,
+    0x80054801U, 0x80054701U, 0x80054801U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80054901U, 0x80054a01U, 0x80054901U,
+    0x80054a01U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80054b01U, 0x80054c01U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80054b01U, 0x80054c01U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80054d01U, 0x80054e01U, 0x80054d01U, 0x80054e01U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80054f01U,
+    0x80055001U, 0x80054f01U, 0x80055001U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80055101U, 0x80055201U, 0x80055101U,
+    0x80055201U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80055301U, 0x80055401U, 0x80055301U, 0x80055401U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80055501U, 0x80055601U,
+    0x80055501U, 0x80055601U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80055701U, 0x80055801U, 0x80055701U, 0x80055801U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80055901U,
+    0x80055a01U, 0x80055901U, 0x80055a01U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x8003e001U, 0x8003e101U, 0x8003e001U,
+    0x8003e101U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80055b01U, 0x80055c01U, 0x80055b01U, 0x80055c01U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80037f01U, 0x8001db01U,
+    0x80037f01U, 0x8001db01U, 0x80038101U, 0x8003c001U, 0x80055d01U,
+    0x8003bf01U, 0x80038101U, 0x8003c001U, 0x80037f01U, 0x8001db01U,
+    0x80037f01U, 0x8001db01U, 0x80038101U, 0x8003c001U, 0x80055d01U,
+    0x8003bf01U, 0x80038101U, 0x8003c001U, 0x80038701U, 0x8001dc01U,
+    0x80038701U, 0x8001dc01U, 0x8003c301U, 0x8003c401U, 0x80038701U,
+    0x8001dc01U, 0x80038701U, 0x8001dc01U, 0x8003c301U, 0x8003c401U,
+    0x80038b01U, 0x8001dd01U, 0x80038b01U, 0x8001dd01U, 0x80038d01U,
+    0x8001de01U, 0x80038d01U, 0x8001de01U, 0x80038b01U, 0x8001dd01U,
+    0x80038b01U, 0x8001dd01U, 0x80038d01U, 0x8001de01U, 0x80038d01U,
+    0x8001de01U, 0x80055e01U, 0x80055f01U, 0x80055e01U, 0x80055f01U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80056001U,
+    0x80056101U, 0x80056001U, 0x80056101U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80056201U, 0x8001df01U, 0x80056301U,
+    0x8001df01U, 0x80056401U, 0x8001e001U, 0x80056501U, 0x8001e001U,
+    0x80056201U, 0x8001df01U, 0x80056301U, 0x8001df01U, 0x80056401U,
+    0x8001e001U, 0x80056501U, 0x8001e001U, 0x80039c01U, 0x8001e401U,
+    0x80039c01U, 0x8001e401U, 0x80039c01U, 0x8001e401U, 0x80039c01U,
+    0x8001e401U, 0x80054001U, 0x80054201U, 0x80054001U, 0x80054201U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80055701U,
+    0x80055801U, 0x80055701U, 0x80055801U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80054101U, 0x80054301U, 0x80054101U,
+    0x80054301U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80056601U, 0x80056701U, 0x80056601U, 0x80056701U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80055901U, 0x80055a01U,
+    0x80055901U, 0x80055a01U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80056801U, 0x80056901U, 0x80056801U, 0x80056901U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x8003a001U,
+    0x8001e601U, 0x8003a001U, 0x8001e601U, 0x8003a001U, 0x8001e601U,
+    0x8003a001U, 0x8001e601U, 0x8003a501U, 0x8001e701U, 0x8003a501U,
+    0x8001e701U, 0x8003a701U, 0x8001e801U, 0x8003a701U, 0x8001e801U,
+    0x8003a501U, 0x8001e701U, 0x8003a501U, 0x8001e701U, 0x8003a701U,
+    0x8001e801U, 0x8003a701U, 0x8001e801U, 0x80054401U, 0x80054501U,
+    0x80054401U, 0x80054501U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x8003aa01U, 0x8003ab01U, 0x8003aa01U, 0x8003ab01U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80056a01U,
+    0x80056b01U, 0x80056a01U, 0x80056b01U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80056c01U, 0x80056d01U, 0x80056c01U,
+    0x80056d01U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x8003ad01U, 0x80009101U, 0x8003ad01U, 0x80009101U, 0x8003ad01U,
+    0x80009101U, 0x8003ad01U, 0x80009101U, 0x80056e01U, 0x80056f01U,
+    0x80056e01U, 0x80056f01U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80057001U, 0x80057101U, 0x80057001U, 0x80057101U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80057201U,
+    0x80057301U, 0x80057201U, 0x80057301U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80057401U, 0x80057501U, 0x80057401U,
+    0x80057501U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80057601U, 0x80057701U, 0x80057601U, 0x80057701U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80057801U, 0x80057901U,
+    0x80057801U, 0x80057901U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80057a01U, 0x80057b01U, 0x80057a01U, 0x80057b01U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80054701U,
+    0x80054801U, 0x80054701U, 0x80054801U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80054b01U, 0x80057c01U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80057d01U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80057e01U,
+    0x80000000U, 0x80057f01U, 0x80000000U, 0x80058001U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80058101U,
+    0x80000000U, 0x80054b01U, 0x80057c01U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80057d01U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80057e01U, 0x80000000U,
+    0x80057f01U, 0x80000000U, 0x80058001U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80058101U, 0x80000000U,
+    0x001aed46U, 0x80058201U, 0x80058303U, 0x80058201U, 0x80058201U,
+    0x80058201U, 0x80058201U, 0x80058201U, 0x001af146U, 0x80058201U,
+    0x80058603U, 0x80058201U, 0x80058201U, 0x80058201U, 0x80058201U,
+    0x80058201U, 0x80025b01U, 0x80058901U, 0x80041a01U, 0x80041b01U,
+    0x80041a01U, 0x80041b01U, 0x80041a01U, 0x80041b01U, 0x80041a01U,
+    0x80041b01U, 0x80041a01U, 0x80041b01U, 0x80041a01U, 0x80041b01U,
+    0x80041a01U, 0x80041b01U, 0x80041a01U, 0x80041b01U, 0x80041a01U,
+    0x80041b01U, 0x80026f01U, 0x80058a01U, 0x80045201U, 0x80045301U,
+    0x80045201U, 0x80045301U, 0x80045201U, 0x80045301U, 0x80045201U,
+    0x80045301U, 0x80045201U, 0x80045301U, 0x80045201U, 0x80045301U,
+    0x80045201U, 0x80045301U, 0x80045201U, 0x80045301U, 0x80045201U,
+    0x80045301U, 0x80028601U, 0x80058b01U, 0x80048a01U, 0x80048b01U,
+    0x80048a01U, 0x80048b01U, 0x80048a01U, 0x80048b01U, 0x80048a01U,
+    0x80048b01U, 0x80048a01U, 0x80048b01U, 0x80048a01U, 0x80048b01U,
+    0x80048a01U, 0x80048b01U, 0x80048a01U, 0x80048b01U, 0x80048a01U,
+    0x80048b01U, 0x80029501U, 0x80058c01U, 0x8004b901U, 0x8004ba01U,
+    0x8004b901U, 0x8004ba01U, 0x8004b901U, 0x8004ba01U, 0x8004b901U,
+    0x8004ba01U, 0x8004b901U, 0x8004ba01U, 0x8004b901U, 0x8004ba01U,
+    0x8004b901U, 0x8004ba01U, 0x8004b901U, 0x8004ba01U, 0x8004b901U,
+    0x8004ba01U, 0x001af533U, 0x001af733U, 0x80058d01U, 0x80058e01U,
+    0x80058f01U, 0x80059001U, 0x80059101U, 0x80059201U, 0x80059301U,
+    0x80000000U, 0x80059401U, 0x80000000U, 0x80059501U, 0x80000000U,
+    0x80059601U, 0x80000000U, 0x80059701U, 0x80059801U, 0x80000000U,
+    0x80000000U, 0x80059901U, 0x80059a01U, 0x80059b01U, 0x80059c01U,
+    0x80059d01U, 0x80059e01U, 0x80059f01U, 0x8005a001U, 0x8005a101U,
+    0x8005a201U, 0x80000000U, 0x8005a301U, 0x001af933U, 0x001afb33U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80059301U, 0x80000000U, 0x80059401U, 0x80000000U,
+    0x80059501U, 0x80000000U, 0x80059601U, 0x80000000U, 0x001afd33U,
+    0x001aff33U, 0x8005a401U, 0x8005a501U, 0x8005a601U, 0x8005a701U,
+    0x80000000U, 0x80000000U, 0x8005a801U, 0x80000000U, 0x8005a901U,
+    0x80000000U, 0x8005aa01U, 0x80000000U, 0x8005ab01U, 0x80000000U,
+    0x8005ac01U, 0x8005ad01U, 0x8005ae01U, 0x80000000U, 0x8005af01U,
+    0x8005b001U, 0x8005b101U, 0x8005b201U, 0x8005b301U, 0x8005b401U,
+    0x80000000U, 0x8005b501U, 0x8005b601U, 0x8005b701U, 0x80000000U,
+    0x8005b801U, 0x001b0133U, 0x001b0333U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x8005a801U,
+    0x80000000U, 0x8005a901U, 0x80000000U, 0x8005aa01U, 0x80000000U,
+    0x8005ab01U, 0x80000000U, 0x001b0533U, 0x001b0733U, 0x8005b901U,
+    0x8005ba01U, 0x8005bb01U, 0x8005bc01U, 0x8005bd01U, 0x8005be01U,
+    0x8005bf01U, 0x80000000U, 0x8005c001U, 0x80000000U, 0x8005c101U,
+    0x80000000U, 0x8005c201U, 0x80000000U, 0x8005c301U, 0x8005c401U,
+    0x8005c501U, 0x80000000U, 0x8005c601U, 0x8005c701U, 0x8005c801U,
+    0x8005c901U, 0x8005ca01U, 0x8005cb01U, 0x8005cc01U, 0x80000000U,
+    0x8005cd01U, 0x8005ce01U, 0x80000000U, 0x8005cf01U, 0x001b0933U,
+    0x001b0b33U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x8005bf01U, 0x80000000U, 0x8005c001U,
+    0x80000000U, 0x8005c101U, 0x80000000U, 0x8005c201U, 0x80000000U,
+    0x8005d001U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x8005d101U, 0x80000000U, 0x8005d201U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x8005d301U, 0x80000000U, 0x8005d401U,
+    0x80000000U, 0x8005d501U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x8005d301U, 0x80000000U, 0x8005d601U, 0x80000000U, 0x8005d701U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x8005d801U, 0x80000000U, 0x8005d901U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x8005da01U, 0x80000000U,
+    0x8005db01U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x8005dc01U, 0x80000000U, 0x8005dd01U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x8005de01U,
+    0x80000000U, 0x8005df01U, 0x8005e001U, 0x8005e101U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x8005e201U,
+    0x80000000U, 0x8005e301U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x8005e401U, 0x80000000U, 0x8005df01U,
+    0x8005e001U, 0x8005e501U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x8005e601U, 0x80000000U, 0x8005e701U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x8005e801U, 0x80000000U, 0x8005e901U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x80000000U, 0x80000000U, 0x8005ea01U, 0x80000000U,
+    0x8005eb01U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+    0x80000000U, 0x8005ec01U, 0x80000000U, 0x8005ed02U, 0x8005ef02U,
+    0x8005f102U, 0x8005f302U, 0x8005f502U, 0x8005f702U, 0x8005f902U,
+    0x8005f302U, 0x8005fb01U, 0x8005fc01U, 0x8005fd01U, 0x8005fe01U,
+    0x8005ff01U, 0x80060001U, 0x80060101U, 0x80060201U, 0x80060301U,
+    0x80060401U, 0x80060501U, 0x80060601U, 0x80060701U, 0x80060801U,
+    0x80060901U, 0x80060a01U, 0x80060b01U, 0x80060c01U, 0x80060d01U,
+    0x80060e01U, 0x80060f01U, 0x80061001U, 0x80061101U, 0x80061201U,
+};
+
+static constexpr uint32_t kLeafNode = 0x80000000U;
+
+// Extract the fields of the instruction in `bits` by walking the decoder
+// automaton down to the short list of encodings that `bits` may match.
+static bool TryExtractWithAutomaton(InstData &inst, uint32_t bits) {
+  auto node = kDecodeNodes[0];
+  while (!(node & kLeafNode)) {
+    const auto shift = node & 0x1fU;
+    const auto field_mask = (1U << ((node >> 5U) & 0x7U)) - 1U;
+    node = kDecodeNodes[(node >> 8U) + ((bits >> shift) & field_mask)];
+  }
+
+  const auto first = (node >> 8U) & 0x7fffffU;
+  const auto last = first + (node & 0xffU);
+  for (auto i = first; i < last; ++i) {
+    if (kExtractors[kLeafExtractors[i]](inst, bits)) {
+      return true;
+    }
+  }
+  return false;
+}
+
 }  // namespace
 
 const char *InstNameToString(InstName iclass) {
@@ -77416,7 +80457,7 @@ const char *InstFormToString(InstForm iform) {
 }
 
 
-bool TryExtract(const uint8_t *bytes, InstData &inst) {
+bool TryExtractWithTree(const uint8_t *bytes, InstData &inst) {
   uint32_t bits = 0;
   bits = (bits << 8) | static_cast<uint32_t>(bytes[3]);
   bits = (bits << 8) | static_cast<uint32_t>(bytes[2]);
@@ -77429,5 +80470,14 @@ bool TryExtract(const uint8_t *bytes, InstData &inst) {
   return kFirstLevel[index](inst, bits);
 }
 
+bool TryExtract(const uint8_t *bytes, InstData &inst) {
+  uint32_t bits = 0;
+  bits = (bits << 8) | static_cast<uint32_t>(bytes[3]);
+  bits = (bits << 8) | static_cast<uint32_t>(bytes[2]);
+  bits = (bits << 8) | static_cast<uint32_t>(bytes[1]);
+  bits = (bits << 8) | static_cast<uint32_t>(bytes[0]);
+  return TryExtractWithAutomaton(inst, bits);
+}
+
 }  // namespace aarch64
 }  // namespace remill
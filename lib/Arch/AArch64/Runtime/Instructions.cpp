@@ -76,15 +76,36 @@ State __remill_state;
 #define REG_X29 state.gpr.x29.qword
 #define REG_X30 state.gpr.x30.qword
 
-#define FLAG_Z state.sr.z  // Zero flag.
-#define FLAG_C state.sr.c  // Carry flag.
-#define FLAG_V state.sr.v  // Overflow.
-#define FLAG_N state.sr.n  // Negative.
+#if REMILL_AARCH64_LAZY_FLAGS
+
+// Flag-setting add-with-carry instructions only record their operands in
+// `state.lazy_nzcv`. The flags are computed when they're read, overwritten, or
+// at a hyper call.
+#  define FLAG_Z NZCVFlags(state).z  // Zero flag.
+#  define FLAG_C NZCVFlags(state).c  // Carry flag.
+#  define FLAG_V NZCVFlags(state).v  // Overflow.
+#  define FLAG_N NZCVFlags(state).n  // Negative.
+
+#  define HYPER_CALL (MaterializeNZCV(state), state.hyper_call)
+#  define __remill_sync_hyper_call(state, mem, call) \
+    __remill_sync_hyper_call((MaterializeNZCV(state), state), mem, call)
+#else
+#  define FLAG_Z state.sr.z  // Zero flag.
+#  define FLAG_C state.sr.c  // Carry flag.
+#  define FLAG_V state.sr.v  // Overflow.
+#  define FLAG_N state.sr.n  // Negative.
+
+#  define HYPER_CALL state.hyper_call
+#endif  // REMILL_AARCH64_LAZY_FLAGS
 
-#define HYPER_CALL state.hyper_call
 #define INTERRUPT_VECTOR state.hyper_call_vector
 #define HYPER_CALL_VECTOR state.hyper_call_vector
 
+// clang-format off
+#include "lib/Arch/AArch64/Semantics/FLAGS.cpp"
+
+// clang-format on
+
 namespace {
 
 // Takes the place of an unsupported instruction.
@@ -106,8 +127,6 @@ DEF_ISEL(UNSUPPORTED_INSTRUCTION) = HandleUnsupported;
 DEF_ISEL(INVALID_INSTRUCTION) = HandleInvalidInstruction;
 
 // clang-format off
-#include "lib/Arch/AArch64/Semantics/FLAGS.cpp"
-
 #include "lib/Arch/AArch64/Semantics/BINARY.cpp"
 #include "lib/Arch/AArch64/Semantics/BITBYTE.cpp"
 #include "lib/Arch/AArch64/Semantics/BRANCH.cpp"
@@ -47,6 +47,11 @@ namespace {
 
 template <typename T>
 T AddWithCarryNZCV(State &state, T lhs, T rhs, T actual_rhs, T carry) {
+#if REMILL_AARCH64_LAZY_FLAGS
+  (void) actual_rhs;
+  RecordAddWithCarryNZCV(state, lhs, rhs, carry);
+  return UAdd(UAdd(lhs, rhs), carry);
+#else
   auto unsigned_result = UAdd(UAdd(ZExt(lhs), ZExt(rhs)), ZExt(carry));
   auto signed_result = SAdd(SAdd(SExt(lhs), SExt(rhs)), Signed(ZExt(carry)));
   auto result = TruncTo<T>(unsigned_result);
@@ -56,6 +61,7 @@ T AddWithCarryNZCV(State &state, T lhs, T rhs, T actual_rhs, T carry) {
   FLAG_V = __remill_flag_computation_overflow(
       SCmpNeq(SExt(result), signed_result), lhs, actual_rhs, result);
   return result;
+#endif  // REMILL_AARCH64_LAZY_FLAGS
 }
 
 template <typename D, typename S1, typename S2>
@@ -287,25 +287,32 @@ DEF_ISEL(MOVZ_64_MOVEWIDE) = Load<R64W, I64>;
 namespace {
 
 template <typename D, typename S>
-DEF_SEM(LDXR, D dst, S src, R64W monitor) {
-  WriteZExt(dst, Read(src));
+DEF_SEM(LDXR, D dst, S src, R64W monitor, R64W monitor_value) {
+  auto val = Read(src);
+  WriteZExt(dst, val);
   Write(monitor, AddressOf(src));
+  WriteZExt(monitor_value, val);
   return memory;
 }
 
 template <typename D, typename S>
-DEF_SEM(LDAXR, D dst, S src, R64W monitor) {
+DEF_SEM(LDAXR, D dst, S src, R64W monitor, R64W monitor_value) {
   memory = __remill_barrier_load_store(memory);
-  WriteZExt(dst, Read(src));
+  auto val = Read(src);
+  WriteZExt(dst, val);
   Write(monitor, AddressOf(src));
+  WriteZExt(monitor_value, val);
   return memory;
 }
 
+// NOTE: The store is a compare-exchange against the value that the
+//       load-exclusive read. It misses an ABA change, but needs no atomic
+//       begin/end around the pair.
 template <typename S, typename D>
-DEF_SEM(STLXR, R32W dst1, S src1, D dst2, R64W monitor) {
+DEF_SEM(STLXR, R32W dst1, S src1, D dst2, R64W monitor, R64W monitor_value) {
   auto old_addr = Read(monitor);
-  if (old_addr == AddressOf(dst2)) {
-    WriteZExt(dst2, Read(src1));
+  auto expected = TruncTo<S>(Read(monitor_value));
+  if (old_addr == AddressOf(dst2) && UCmpXchg(dst2, expected, Read(src1))) {
     WriteZExt(dst1, 0_u32);  // Store succeeded.
   } else {
     WriteZExt(dst1, 1_u32);  // Store failed.
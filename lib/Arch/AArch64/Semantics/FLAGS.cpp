@@ -158,6 +158,79 @@ struct Carry<tag_sub> {
   }
 };
 
+#if REMILL_AARCH64_LAZY_FLAGS
+
+// Values of the `N`, `Z`, `C`, and `V` flags.
+struct NZCVValues {
+  bool n;
+  bool z;
+  bool c;
+  bool v;
+};
+
+// Computes the flags produced by adding `lhs`, `rhs`, and `carry`.
+template <typename T>
+ALWAYS_INLINE static NZCVValues AddWithCarryFlags(T lhs, T rhs, T carry) {
+  auto unsigned_result = UAdd(UAdd(ZExt(lhs), ZExt(rhs)), ZExt(carry));
+  auto signed_result = SAdd(SAdd(SExt(lhs), SExt(rhs)), Signed(ZExt(carry)));
+  auto result = TruncTo<T>(unsigned_result);
+  return {SignFlag(result, lhs, rhs), ZeroFlag(result, lhs, rhs),
+          UCmpNeq(ZExt(result), unsigned_result),
+          __remill_flag_computation_overflow(
+              SCmpNeq(SExt(result), signed_result), lhs, rhs, result)};
+}
+
+// Record the operands of a flag-setting add-with-carry. The flags themselves
+// are only computed if something reads them.
+template <typename T>
+ALWAYS_INLINE static void RecordAddWithCarryNZCV(State &state, T lhs, T rhs,
+                                                 T carry) {
+  static_assert(sizeof(T) == 4 || sizeof(T) == 8,
+                "Invalid operand size for lazy `NZCV` flags.");
+  auto &lazy = state.lazy_nzcv;
+  lazy.kind = sizeof(T) == 4 ? kLazyNZCVAddWithCarry32 : kLazyNZCVAddWithCarry64;
+  lazy.lhs = lhs;
+  lazy.rhs = rhs;
+  lazy.carry = static_cast<uint8_t>(carry);
+}
+
+// Returns the current values of the flags, without updating `state`. This is
+// used by the condition checks, which only have a read-only `State`.
+ALWAYS_INLINE static NZCVValues NZCVFlags(const State &state) {
+  const auto &lazy = state.lazy_nzcv;
+  switch (lazy.kind) {
+    case kLazyNZCVAddWithCarry32:
+      return AddWithCarryFlags<uint32_t>(static_cast<uint32_t>(lazy.lhs),
+                                         static_cast<uint32_t>(lazy.rhs),
+                                         lazy.carry);
+    case kLazyNZCVAddWithCarry64:
+      return AddWithCarryFlags<uint64_t>(lazy.lhs, lazy.rhs, lazy.carry);
+    default:
+      return {!!state.sr.n, !!state.sr.z, !!state.sr.c, !!state.sr.v};
+  }
+}
+
+// Compute any pending flags and store them into `state.sr`.
+ALWAYS_INLINE static void MaterializeNZCV(State &state) {
+  if (state.lazy_nzcv.kind != kLazyNZCVNone) {
+    const auto flags = NZCVFlags(static_cast<const State &>(state));
+    state.sr.n = flags.n;
+    state.sr.z = flags.z;
+    state.sr.c = flags.c;
+    state.sr.v = flags.v;
+    state.lazy_nzcv.kind = kLazyNZCVNone;
+  }
+}
+
+// Returns the system registers, with up-to-date flags that can be read or
+// written.
+ALWAYS_INLINE static SR &NZCVFlags(State &state) {
+  MaterializeNZCV(state);
+  return state.sr;
+}
+
+#endif  // REMILL_AARCH64_LAZY_FLAGS
+
 ALWAYS_INLINE static void SetFPSRStatusFlags(State &state, int mask) {
   state.sr.ioc |= static_cast<uint8_t>(0 != (mask & kFPUExceptionInvalid));
   state.sr.dzc |= static_cast<uint8_t>(0 != (mask & kFPUExceptionDivByZero));
@@ -31,6 +31,7 @@
 #include <remill/Arch/ArchBase.h>  // For `Arch` and `ArchBase`.
 
 #include <algorithm>
+#include <atomic>
 #include <memory>
 #include <unordered_map>
 #include <unordered_set>
@@ -93,6 +94,111 @@ bool Arch::MayHaveDelaySlot(const Instruction &) const {
   return false;
 }
 
+// Returns `true` if decoded instructions can be reused at other addresses.
+bool Arch::DecodingIsPositionIndependent(void) const {
+  return false;
+}
+
+// Returns how many bytes past a decoded instruction the decoder may look at.
+uint64_t Arch::MaxDecodeLookahead(const DecodingContext &context) const {
+  const auto max_size = MaxInstructionSize(context, true);
+  const auto min_size = MinInstructionSize(context);
+  return max_size > min_size ? max_size - min_size : 0u;
+}
+
+namespace {
+
+// Turn `inst` into the placeholder for the undecodable `bytes` at `address`.
+static void MarkUndecodable(const Arch *arch, uint64_t address,
+                            std::string_view bytes, Instruction &inst) {
+  inst.Reset();
+  inst.arch = arch;
+  inst.arch_name = arch->arch_name;
+  inst.sub_arch_name = arch->arch_name;
+  inst.branch_taken_arch_name = arch->arch_name;
+  inst.pc = address;
+  inst.next_pc = address + bytes.size();
+  inst.bytes = bytes;
+}
+
+// Make `insts` hold `num_insts` reset instructions.
+static void ResetInstructions(std::vector<Instruction> &insts,
+                              size_t num_insts) {
+  const auto num_reused = std::min(num_insts, insts.size());
+  for (size_t i = 0u; i < num_reused; ++i) {
+    insts[i].Reset();
+  }
+  insts.resize(num_insts);
+}
+
+// Look up the architectural registers named by the operands of `inst`, so
+// that the lifter can find their addresses without hashing their names.
+static void ResolveRegisters(const Arch *arch, Instruction &inst) {
+  auto resolve = [=](Operand::Register &reg) {
+    if (!reg.name.empty()) {
+      reg.resolved = arch->RegisterByName(reg.name);
+    }
+  };
+
+  for (auto &op : inst.operands) {
+    switch (op.type) {
+      case Operand::kTypeRegister: resolve(op.reg); break;
+      case Operand::kTypeShiftRegister: resolve(op.shift_reg.reg); break;
+      case Operand::kTypeAddress:
+        resolve(op.addr.segment_base_reg);
+        resolve(op.addr.base_reg);
+        resolve(op.addr.index_reg);
+        break;
+      default: break;
+    }
+  }
+}
+
+}  // namespace
+
+// Decode the instructions laid out back-to-back in `instr_bytes`, one at a
+// time.
+size_t Arch::DecodeInstructions(uint64_t address, std::string_view instr_bytes,
+                                std::vector<Instruction> &insts,
+                                const DecodingContext &context) const {
+  const auto min_size = MinInstructionSize(context);
+  const auto max_size = MaxInstructionSize(context, false);
+  const auto align = std::max<uint64_t>(MinInstructionAlign(context), 1u);
+
+  size_t num_insts = 0u;
+  size_t num_decoded = 0u;
+  for (uint64_t offset = 0u;
+       offset < instr_bytes.size() && instr_bytes.size() - offset >= min_size;
+       ++num_insts) {
+    if (num_insts < insts.size()) {
+      insts[num_insts].Reset();
+    } else {
+      insts.emplace_back();
+    }
+
+    auto &inst = insts[num_insts];
+    const auto inst_address = address + offset;
+    if (DecodeInstruction(inst_address, instr_bytes.substr(offset, max_size),
+                          inst, context) &&
+        !inst.bytes.empty()) {
+      offset += inst.bytes.size();
+      ++num_decoded;
+    } else {
+      MarkUndecodable(this, inst_address, instr_bytes.substr(offset, align),
+                      inst);
+      offset += align;
+    }
+  }
+
+  insts.resize(num_insts);
+  return num_decoded;
+}
+
+// Returns `true` if `reg` holds a single condition or status flag.
+bool Arch::IsFlagRegister(const Register *) const {
+  return false;
+}
+
 // Returns `true` if a given instruction might have a delay slot.
 bool Arch::NextInstructionIsDelayed(const Instruction &, const Instruction &,
                                     bool) const {
@@ -763,6 +869,8 @@ void Arch::InitializeEmptyLiftedFunction(llvm::Function *func) const {
   // otherwise STLXR without a preceding LDXR/LDAXR will do UB
   auto monitor = ir.CreateAlloca(addr, nullptr, "MONITOR");
   ir.CreateStore(llvm::ConstantInt::get(addr, 0), monitor);
+  auto monitor_value = ir.CreateAlloca(addr, nullptr, "MONITOR_VALUE");
+  ir.CreateStore(llvm::ConstantInt::get(addr, 0), monitor_value);
 
   // NOTE(pag): `PC` and `NEXT_PC` are handled by
   //            `FinishLiftedFunctionInitialization`.
@@ -800,6 +908,7 @@ const Register *ArchBase::AddRegister(const char *reg_name_,
   DLOG(INFO) << "Adding register " << reg_name << " with type " << val_type;
 
   auto reg_impl = new Register(reg_name, offset, val_type, parent_reg, this);
+  reg_impl->index = static_cast<unsigned>(registers.size());
 
   //reg_impl->ComputeGEPAccessors(dl, this->state_type);
 
@@ -952,22 +1061,121 @@ DefaultContextAndLifter::FillInFlowFromCategoryAndDefaultContext(
   }
 }
 
+namespace {
+
+// The lifter of the last architecture to decode on this thread. The lifter
+// is owned by that architecture, and so expires with it.
+struct ThreadLifter {
+  uint64_t arch_id{0};
+  std::weak_ptr<InstructionLifterIntf> lifter;
+};
+
+static thread_local ThreadLifter gThreadLifter;
+
+static std::atomic<uint64_t> gNextLiftersId{1};
+
+}  // namespace
+
+// A thread usually decodes for one architecture, so its lifter is kept in a
+// thread-local, and `lifters_lock` is only taken on the first decode.
+InstructionLifter::LifterPtr
+DefaultContextAndLifter::GetThreadLifter(void) const {
+  auto &cached = gThreadLifter;
+  if (cached.arch_id == lifters_id) {
+    if (auto lifter = cached.lifter.lock()) {
+      return lifter;
+    }
+  }
+
+  std::lock_guard<std::mutex> locker(lifters_lock);
+  auto &lifter = lifters[std::this_thread::get_id()];
+  if (!lifter) {
+    lifter = std::make_shared<remill::InstructionLifter>(
+        this, this->GetInstrinsicTable());
+  }
+  cached.arch_id = lifters_id;
+  cached.lifter = lifter;
+  return lifter;
+}
+
 bool DefaultContextAndLifter::DecodeInstruction(uint64_t address,
                                                 std::string_view instr_bytes,
                                                 Instruction &inst,
                                                 DecodingContext context) const {
-  inst.SetLifter(std::make_unique<remill::InstructionLifter>(
-      this, this->GetInstrinsicTable()));
+  inst.SetLifter(GetThreadLifter());
 
   auto res = this->ArchDecodeInstruction(address, instr_bytes, inst);
   if (res) {
     inst.flows = this->FillInFlowFromCategoryAndDefaultContext(inst);
+    ResolveRegisters(this, inst);
   }
 
   return res;
 }
 
 
+// Fixed-width architectures override `ArchDecodeInstructions` to pipeline a
+// whole batch.
+size_t DefaultContextAndLifter::DecodeInstructions(
+    uint64_t address, std::string_view instr_bytes,
+    std::vector<Instruction> &insts, const DecodingContext &context) const {
+  const auto inst_size = MinInstructionSize(context);
+  if (!inst_size || inst_size != MaxInstructionSize(context, false) ||
+      inst_size != MinInstructionAlign(context) || (address % inst_size)) {
+    return this->Arch::DecodeInstructions(address, instr_bytes, insts, context);
+  }
+
+  const auto num_insts = instr_bytes.size() / inst_size;
+  ResetInstructions(insts, num_insts);
+  if (!num_insts) {
+    return 0u;
+  }
+
+  this->ArchDecodeInstructions(address,
+                               instr_bytes.substr(0u, num_insts * inst_size),
+                               insts.data(), num_insts);
+
+  // The whole batch is decoded on this thread, so it shares one lifter.
+  const auto lifter = GetThreadLifter();
+
+  size_t num_decoded = 0u;
+  for (size_t i = 0u; i < num_insts; ++i) {
+    auto &inst = insts[i];
+    if (inst.category == Instruction::kCategoryInvalid) {
+      MarkUndecodable(this, address + i * inst_size,
+                      instr_bytes.substr(i * inst_size, inst_size), inst);
+    } else {
+      inst.SetLifter(lifter);
+      inst.flows = this->FillInFlowFromCategoryAndDefaultContext(inst);
+      ResolveRegisters(this, inst);
+      ++num_decoded;
+    }
+  }
+
+  return num_decoded;
+}
+
+// Decode the fixed-width instructions in `instr_bytes` one at a time.
+void DefaultContextAndLifter::ArchDecodeInstructions(
+    uint64_t address, std::string_view instr_bytes, Instruction *insts,
+    size_t num_insts) const {
+  const auto inst_size = instr_bytes.size() / num_insts;
+  for (size_t i = 0u; i < num_insts; ++i) {
+    if (!this->ArchDecodeInstruction(address + i * inst_size,
+                                     instr_bytes.substr(i * inst_size,
+                                                        inst_size),
+                                     insts[i])) {
+      insts[i].category = Instruction::kCategoryInvalid;
+    }
+  }
+}
+
+// The hand-written decoders express PC-relative operands via `PC` and
+// `NEXT_PC`, and only use the address to compute `pc`, `next_pc`, etc.
+bool DefaultContextAndLifter::DecodingIsPositionIndependent(void) const {
+  return true;
+}
+
 OperandLifter::OpLifterPtr DefaultContextAndLifter::DefaultLifter(
     const remill::IntrinsicTable &intrinsics) const {
   return std::make_shared<InstructionLifter>(this, intrinsics);
@@ -977,7 +1185,8 @@ OperandLifter::OpLifterPtr DefaultContextAndLifter::DefaultLifter(
 DefaultContextAndLifter::DefaultContextAndLifter(llvm::LLVMContext *context_,
                                                  OSName os_name_,
                                                  ArchName arch_name_)
-    : ArchBase(context_, os_name_, arch_name_) {}
+    : ArchBase(context_, os_name_, arch_name_),
+      lifters_id(gNextLiftersId.fetch_add(1u)) {}
 
 
 }  // namespace remill
@@ -1,57 +1,164 @@
-
 #include <glog/logging.h>
 #include <remill/Arch/Context.h>
 
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
 namespace remill {
+namespace {
+
+// Process-wide table of interned context register names.
+struct ContextRegTable {
+  std::mutex lock;
+  std::map<std::string, ContextRegId, std::less<>> ids;
+  std::vector<const std::string *> names;
+};
+
+static ContextRegTable &GetContextRegTable(void) {
+  static ContextRegTable table;
+  return table;
+}
+
+}  // namespace
+
+// Returns the ID of the context register named `creg`.
+ContextRegId InternContextReg(std::string_view creg) {
+  auto &table = GetContextRegTable();
+  std::lock_guard<std::mutex> locker(table.lock);
+  if (auto it = table.ids.find(creg); it != table.ids.end()) {
+    return it->second;
+  }
+
+  CHECK_LT(table.names.size(), 0xFFFFu)
+      << "Too many context registers; can't intern " << creg;
+
+  const auto id = static_cast<ContextRegId>(table.names.size());
+  auto [it, added] = table.ids.emplace(std::string(creg), id);
+  table.names.push_back(&(it->first));
+  return id;
+}
 
+// Returns the name of the context register with ID `id`.
+std::string_view ContextRegName(ContextRegId id) {
+  auto &table = GetContextRegTable();
+  std::lock_guard<std::mutex> locker(table.lock);
+  CHECK_LT(id, table.names.size()) << "Invalid context register ID " << id;
+  return *(table.names[id]);
+}
 
 bool DecodingContext::operator==(remill::DecodingContext const &rhs) const {
-  return this->context_value == rhs.context_value;
+  return num_regs == rhs.num_regs &&
+         std::equal(reg_ids, reg_ids + num_regs, rhs.reg_ids) &&
+         std::equal(reg_values, reg_values + num_regs, rhs.reg_values);
 }
 
-DecodingContext::DecodingContext(ContextValues context_value)
-    : context_value(std::move(context_value)) {}
+DecodingContext::DecodingContext(const ContextValues &context_value) {
+  for (const auto &[creg, value] : context_value) {
+    UpdateContextReg(InternContextReg(creg), value);
+  }
+}
 
+unsigned DecodingContext::Find(ContextRegId creg) const {
+  return static_cast<unsigned>(
+      std::lower_bound(reg_ids, reg_ids + num_regs, creg) - reg_ids);
+}
 
-uint64_t
-DecodingContext::GetContextValue(const std::string &context_reg) const {
-  if (auto res = this->context_value.find(context_reg);
-      res != this->context_value.end()) {
-    return res->second;
+uint64_t DecodingContext::GetContextValue(ContextRegId context_reg) const {
+  if (auto i = Find(context_reg); i < num_regs && reg_ids[i] == context_reg) {
+    return reg_values[i];
   }
 
-  LOG(FATAL) << "Required context reg value for: " << context_reg;
+  LOG(FATAL) << "Required context reg value for: "
+             << ContextRegName(context_reg);
+}
+
+uint64_t DecodingContext::GetContextValue(std::string_view context_reg) const {
+  return GetContextValue(InternContextReg(context_reg));
+}
+
+// NOTE: This doesn't replace an existing value of `creg`.
+DecodingContext DecodingContext::PutContextReg(ContextRegId creg,
+                                               uint64_t value) const {
+  auto new_value = *this;
+  if (!new_value.HasValueForReg(creg)) {
+    new_value.UpdateContextReg(creg, value);
+  }
+  return new_value;
 }
 
-DecodingContext DecodingContext::PutContextReg(std::string creg,
+DecodingContext DecodingContext::PutContextReg(std::string_view creg,
                                                uint64_t value) const {
-  auto new_value = context_value;
-  new_value.emplace(creg, value);
-  return DecodingContext(std::move(new_value));
+  return PutContextReg(InternContextReg(creg), value);
+}
+
+void DecodingContext::UpdateContextReg(ContextRegId creg, uint64_t value) {
+  const auto i = Find(creg);
+  if (i < num_regs && reg_ids[i] == creg) {
+    reg_values[i] = value;
+    return;
+  }
+
+  CHECK_LT(num_regs, kMaxNumContextRegs)
+      << "Too many context registers; can't add " << ContextRegName(creg);
+
+  std::copy_backward(reg_ids + i, reg_ids + num_regs,
+                     reg_ids + num_regs + 1);
+  std::copy_backward(reg_values + i, reg_values + num_regs,
+                     reg_values + num_regs + 1);
+  reg_ids[i] = creg;
+  reg_values[i] = value;
+  num_regs++;
 }
 
-void DecodingContext::UpdateContextReg(std::string creg, uint64_t value) {
-  this->context_value[creg] = value;
+void DecodingContext::UpdateContextReg(std::string_view creg, uint64_t value) {
+  UpdateContextReg(InternContextReg(creg), value);
 }
 
-void DecodingContext::DropReg(const std::string &creg) {
-  this->context_value.erase(creg);
+void DecodingContext::DropReg(ContextRegId creg) {
+  const auto i = Find(creg);
+  if (i >= num_regs || reg_ids[i] != creg) {
+    return;
+  }
+
+  std::copy(reg_ids + i + 1, reg_ids + num_regs, reg_ids + i);
+  std::copy(reg_values + i + 1, reg_values + num_regs, reg_values + i);
+  num_regs--;
+  reg_ids[num_regs] = 0;
+  reg_values[num_regs] = 0;
+}
+
+void DecodingContext::DropReg(std::string_view creg) {
+  DropReg(InternContextReg(creg));
 }
 
-bool DecodingContext::HasValueForReg(const std::string &creg) const {
-  return this->context_value.find(creg) != this->context_value.end();
+bool DecodingContext::HasValueForReg(ContextRegId creg) const {
+  const auto i = Find(creg);
+  return i < num_regs && reg_ids[i] == creg;
 }
 
+bool DecodingContext::HasValueForReg(std::string_view creg) const {
+  return HasValueForReg(InternContextReg(creg));
+}
 
 DecodingContext
-DecodingContext::ContextWithoutRegister(const std::string &creg) const {
+DecodingContext::ContextWithoutRegister(ContextRegId creg) const {
   DecodingContext cpy = *this;
   cpy.DropReg(creg);
   return cpy;
 }
 
-const ContextValues &DecodingContext::GetContextValues() const {
-  return this->context_value;
+DecodingContext
+DecodingContext::ContextWithoutRegister(std::string_view creg) const {
+  return ContextWithoutRegister(InternContextReg(creg));
+}
+
+ContextValues DecodingContext::GetContextValues() const {
+  ContextValues values;
+  ForEachContextReg([&values](ContextRegId creg, uint64_t value) {
+    values.emplace(ContextRegName(creg), value);
+  });
+  return values;
 }
 
 }  // namespace remill
@@ -0,0 +1,432 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <glog/logging.h>
+#include <remill/Arch/Arch.h>
+#include <remill/Arch/DecodeCache.h>
+#include <remill/Arch/Instruction.h>
+#include <remill/Arch/Name.h>
+
+#include <algorithm>
+#include <list>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace remill {
+namespace {
+
+// The first byte of a key. Most keys end with only the bytes that the decoder
+// looked at, and so match any bytes given to the decoder that start with
+// them. Exact keys end with all of the bytes given to the decoder, e.g. when
+// the decoder failed, or ran out of bytes to look past the instruction.
+enum : char {
+  kPrefixKey = 0,
+  kExactKey = 1,
+};
+
+// Which of the optional program counters of an instruction are set.
+enum : uint8_t {
+  kHasDelayedPC = 1u << 0,
+  kHasBranchTakenPC = 1u << 1,
+  kHasBranchNotTakenPC = 1u << 2,
+};
+
+// A decoded instruction, with all of its program counters made relative to
+// its own `pc`, i.e. as if it had been decoded at address zero.
+//
+// The public fields of an `Instruction`, without its unused table of operand
+// expressions.
+struct CachedInstruction {
+  std::string key;
+
+  // Number of instruction bytes at the end of a `kPrefixKey` `key`, or zero
+  // for a `kExactKey`.
+  size_t num_prefix_bytes{0};
+
+  bool decoded{false};
+  uint8_t has_pcs{0};
+
+  std::string function;
+  uint32_t form{Instruction::kUnknownForm};
+  std::string bytes;
+  uint64_t next_pc{0};
+  uint64_t delayed_pc{0};
+  uint64_t branch_taken_pc{0};
+  uint64_t branch_not_taken_pc{0};
+  ArchName arch_name{kArchInvalid};
+  ArchName sub_arch_name{kArchInvalid};
+  std::optional<ArchName> branch_taken_arch_name;
+  bool is_atomic_read_modify_write{false};
+  bool has_branch_taken_delay_slot{false};
+  bool has_branch_not_taken_delay_slot{false};
+  bool in_delay_slot{false};
+  const Register *segment_override{nullptr};
+  Instruction::Category category{Instruction::kCategoryInvalid};
+  Instruction::InstructionFlowCategory flows{Instruction::InvalidInsn()};
+  decltype(Instruction::operands) operands;
+  InstructionLifter::LifterPtr lifter;
+};
+
+// Returns `true` if `op` refers to one of the operand expressions of its
+// instruction. These are stored inside of the `Instruction`, and so can't be
+// copied into the cache.
+static bool IsExpressionOperand(const Operand &op) {
+  switch (op.type) {
+    case Operand::kTypeExpression:
+    case Operand::kTypeRegisterExpression:
+    case Operand::kTypeImmediateExpression:
+    case Operand::kTypeAddressExpression: return true;
+    default: return false;
+  }
+}
+
+// Apply `cb` to the targets of the direct flows in `flows`.
+template <typename CB>
+static void ForEachDirectFlow(Instruction::InstructionFlowCategory &flows,
+                              CB cb) {
+  auto visit_abnormal = [&cb](Instruction::AbnormalFlow &flow) {
+    if (auto call = std::get_if<Instruction::DirectFunctionCall>(&flow)) {
+      cb(call->taken_flow);
+    } else if (auto jump = std::get_if<Instruction::DirectJump>(&flow)) {
+      cb(jump->taken_flow);
+    }
+  };
+
+  if (auto call = std::get_if<Instruction::DirectFunctionCall>(&flows)) {
+    cb(call->taken_flow);
+  } else if (auto jump = std::get_if<Instruction::DirectJump>(&flows)) {
+    cb(jump->taken_flow);
+  } else if (auto cond =
+                 std::get_if<Instruction::ConditionalInstruction>(&flows)) {
+    visit_abnormal(cond->taken_branch);
+  }
+}
+
+}  // namespace
+
+double DecodeCacheStats::HitRate(void) const {
+  const auto total = hits + misses + uncacheable;
+  return total ? static_cast<double>(hits) / static_cast<double>(total) : 0.0;
+}
+
+DecodeCacheStats &DecodeCacheStats::operator+=(const DecodeCacheStats &that) {
+  hits += that.hits;
+  misses += that.misses;
+  uncacheable += that.uncacheable;
+  evictions += that.evictions;
+  return *this;
+}
+
+class DecodeCache::Impl {
+ public:
+  Impl(const Arch *arch_, size_t max_entries_);
+
+  bool DecodeInstruction(uint64_t address, std::string_view instr_bytes,
+                         Instruction &inst, DecodingContext context);
+
+  // Fill `key` with the cache key of a decoding, as a `kExactKey`. Returns
+  // the size of the key before `instr_bytes`.
+  size_t MakeKey(uint64_t address, std::string_view instr_bytes,
+                 const Instruction &inst, const DecodingContext &context);
+
+  // Find the entry whose key is `key`, or is the first `key_size` bytes of
+  // `key` followed by up to `max_num_bytes` of its instruction bytes. Returns
+  // `lru.end()` if there is none.
+  std::list<CachedInstruction>::iterator Find(size_t key_size,
+                                              size_t max_num_bytes);
+
+  // The number of keys of the same kind and size as that of `entry`.
+  size_t &NumKeysLike(const CachedInstruction &entry);
+
+  // Copy `entry` into `inst`, relocating it to `address`.
+  void Load(const CachedInstruction &entry, uint64_t address,
+            Instruction &inst) const;
+
+  // Copy `inst`, decoded at `address`, into `entry`.
+  void Store(const Instruction &inst, uint64_t address,
+             CachedInstruction &entry) const;
+
+  const Arch *const arch;
+  const size_t max_entries;
+  const bool is_cacheable;
+  const uint64_t addr_mask;
+
+  DecodeCacheStats stats;
+
+  // Scratch space for building keys.
+  std::string key;
+
+  // The number of `kExactKey` keys, and of `kPrefixKey` keys by their number
+  // of instruction bytes, so that lookups only probe for the sizes of keys
+  // that are in the cache.
+  size_t num_exact_keys{0};
+  std::vector<size_t> num_prefix_keys;
+
+  // Cached instructions, from most to least recently used. `entries` is keyed
+  // by views of the `key` fields of the elements of `lru`.
+  std::list<CachedInstruction> lru;
+  std::unordered_map<std::string_view, std::list<CachedInstruction>::iterator>
+      entries;
+};
+
+DecodeCache::Impl::Impl(const Arch *arch_, size_t max_entries_)
+    : arch(arch_),
+      max_entries(max_entries_),
+      is_cacheable(max_entries && arch->DecodingIsPositionIndependent()),
+      addr_mask(arch->address_size >= 64
+                    ? ~0ull
+                    : ((1ull << arch->address_size) - 1ull)) {}
+
+size_t DecodeCache::Impl::MakeKey(uint64_t address,
+                                  std::string_view instr_bytes,
+                                  const Instruction &inst,
+                                  const DecodingContext &context) {
+  auto add_u64 = [this](uint64_t val) {
+    key.append(reinterpret_cast<const char *>(&val), sizeof(val));
+  };
+
+  const auto align = arch->MinInstructionAlign(context);
+
+  key.clear();
+  key.push_back(kExactKey);
+  key.push_back(inst.in_delay_slot ? '\1' : '\0');
+  add_u64(align ? address % align : 0u);
+  add_u64(context.NumContextRegs());
+  context.ForEachContextReg([&](ContextRegId reg_id, uint64_t reg_val) {
+    add_u64(reg_id);
+    add_u64(reg_val);
+  });
+
+  const auto key_size = key.size();
+  key.append(instr_bytes);
+  return key_size;
+}
+
+std::list<CachedInstruction>::iterator
+DecodeCache::Impl::Find(size_t key_size, size_t max_num_bytes) {
+  if (num_exact_keys) {
+    key[0] = kExactKey;
+    if (auto it = entries.find(key); it != entries.end()) {
+      return it->second;
+    }
+  }
+
+  key[0] = kPrefixKey;
+  max_num_bytes = std::min(max_num_bytes + 1u, num_prefix_keys.size());
+  for (size_t i = 1u; i < max_num_bytes; ++i) {
+    if (!num_prefix_keys[i]) {
+      continue;
+    }
+    const std::string_view probe(key.data(), key_size + i);
+    if (auto it = entries.find(probe); it != entries.end()) {
+      return it->second;
+    }
+  }
+  return lru.end();
+}
+
+size_t &DecodeCache::Impl::NumKeysLike(const CachedInstruction &entry) {
+  if (!entry.num_prefix_bytes) {
+    return num_exact_keys;
+  }
+  if (entry.num_prefix_bytes >= num_prefix_keys.size()) {
+    num_prefix_keys.resize(entry.num_prefix_bytes + 1u);
+  }
+  return num_prefix_keys[entry.num_prefix_bytes];
+}
+
+void DecodeCache::Impl::Load(const CachedInstruction &entry, uint64_t address,
+                             Instruction &inst) const {
+  auto relocate = [=](uint64_t pc) { return (pc + address) & addr_mask; };
+
+  inst.Reset();
+  inst.function = entry.function;
+  inst.form = entry.form;
+  inst.bytes = entry.bytes;
+  inst.pc = address;
+  inst.next_pc = relocate(entry.next_pc);
+  if (entry.has_pcs & kHasDelayedPC) {
+    inst.delayed_pc = relocate(entry.delayed_pc);
+  }
+  if (entry.has_pcs & kHasBranchTakenPC) {
+    inst.branch_taken_pc = relocate(entry.branch_taken_pc);
+  }
+  if (entry.has_pcs & kHasBranchNotTakenPC) {
+    inst.branch_not_taken_pc = relocate(entry.branch_not_taken_pc);
+  }
+  inst.arch_name = entry.arch_name;
+  inst.sub_arch_name = entry.sub_arch_name;
+  inst.branch_taken_arch_name = entry.branch_taken_arch_name;
+  inst.arch = arch;
+  inst.is_atomic_read_modify_write = entry.is_atomic_read_modify_write;
+  inst.has_branch_taken_delay_slot = entry.has_branch_taken_delay_slot;
+  inst.has_branch_not_taken_delay_slot = entry.has_branch_not_taken_delay_slot;
+  inst.in_delay_slot = entry.in_delay_slot;
+  inst.segment_override = entry.segment_override;
+  inst.category = entry.category;
+  inst.flows = entry.flows;
+  ForEachDirectFlow(inst.flows, [=](Instruction::DirectFlow &flow) {
+    flow.known_target = relocate(flow.known_target);
+  });
+  inst.operands = entry.operands;
+  inst.SetLifter(entry.lifter);
+}
+
+void DecodeCache::Impl::Store(const Instruction &inst, uint64_t address,
+                              CachedInstruction &entry) const {
+  auto unlocate = [=](uint64_t pc) { return (pc - address) & addr_mask; };
+
+  // NOTE: A zero optional program counter is treated as unset, like most users
+  //       of `Instruction` do.
+  entry.has_pcs = 0u;
+  entry.function = inst.function;
+  entry.form = inst.form;
+  entry.bytes = inst.bytes;
+  entry.next_pc = unlocate(inst.next_pc);
+  if (inst.delayed_pc) {
+    entry.has_pcs |= kHasDelayedPC;
+    entry.delayed_pc = unlocate(inst.delayed_pc);
+  }
+  if (inst.branch_taken_pc) {
+    entry.has_pcs |= kHasBranchTakenPC;
+    entry.branch_taken_pc = unlocate(inst.branch_taken_pc);
+  }
+  if (inst.branch_not_taken_pc) {
+    entry.has_pcs |= kHasBranchNotTakenPC;
+    entry.branch_not_taken_pc = unlocate(inst.branch_not_taken_pc);
+  }
+  entry.arch_name = inst.arch_name;
+  entry.sub_arch_name = inst.sub_arch_name;
+  entry.branch_taken_arch_name = inst.branch_taken_arch_name;
+  entry.is_atomic_read_modify_write = inst.is_atomic_read_modify_write;
+  entry.has_branch_taken_delay_slot = inst.has_branch_taken_delay_slot;
+  entry.has_branch_not_taken_delay_slot = inst.has_branch_not_taken_delay_slot;
+  entry.in_delay_slot = inst.in_delay_slot;
+  entry.segment_override = inst.segment_override;
+  entry.category = inst.category;
+  entry.flows = inst.flows;
+  ForEachDirectFlow(entry.flows, [=](Instruction::DirectFlow &flow) {
+    flow.known_target = unlocate(flow.known_target);
+  });
+  entry.operands = inst.operands;
+  entry.lifter = inst.GetLifter();
+}
+
+bool DecodeCache::Impl::DecodeInstruction(uint64_t address,
+                                          std::string_view instr_bytes,
+                                          Instruction &inst,
+                                          DecodingContext context) {
+  if (!is_cacheable) {
+    stats.uncacheable++;
+    return arch->DecodeInstruction(address, instr_bytes, inst,
+                                   std::move(context));
+  }
+
+  const auto key_size = MakeKey(address, instr_bytes, inst, context);
+  if (auto it = Find(key_size, instr_bytes.size()); it != lru.end()) {
+    stats.hits++;
+    lru.splice(lru.begin(), lru, it);
+    Load(*it, address, inst);
+    return it->decoded;
+  }
+
+  const auto lookahead = arch->MaxDecodeLookahead(context);
+  const auto decoded =
+      arch->DecodeInstruction(address, instr_bytes, inst, std::move(context));
+
+  for (const auto &op : inst.operands) {
+    if (IsExpressionOperand(op)) {
+      stats.uncacheable++;
+      return decoded;
+    }
+  }
+
+  stats.misses++;
+
+  // Key the instruction on only the bytes that the decoder looked at, if it
+  // had all of them.
+  size_t num_prefix_bytes = 0u;
+  if (decoded && !inst.bytes.empty() &&
+      (inst.bytes.size() + lookahead) <= instr_bytes.size() &&
+      instr_bytes.substr(0, inst.bytes.size()) == inst.bytes) {
+    num_prefix_bytes = inst.bytes.size() + lookahead;
+    key[0] = kPrefixKey;
+    key.resize(key_size + num_prefix_bytes);
+  } else {
+    key[0] = kExactKey;
+  }
+
+  // Reuse the least recently used entry if the cache is full.
+  if (lru.size() >= max_entries) {
+    stats.evictions++;
+    entries.erase(lru.back().key);
+    NumKeysLike(lru.back())--;
+    lru.splice(lru.begin(), lru, std::prev(lru.end()));
+  } else {
+    lru.emplace_front();
+  }
+
+  auto &entry = lru.front();
+  entry.key.swap(key);
+  entry.num_prefix_bytes = num_prefix_bytes;
+  entry.decoded = decoded;
+  Store(inst, address, entry);
+  entries.emplace(entry.key, lru.begin());
+  NumKeysLike(entry)++;
+  return decoded;
+}
+
+DecodeCache::~DecodeCache(void) {}
+
+DecodeCache::DecodeCache(const Arch *arch_, size_t max_entries_)
+    : impl(new Impl(arch_, max_entries_)) {}
+
+// Decode an instruction, reusing a cached decoding if there is one.
+bool DecodeCache::DecodeInstruction(uint64_t address,
+                                    std::string_view instr_bytes,
+                                    Instruction &inst,
+                                    DecodingContext context) {
+  return impl->DecodeInstruction(address, instr_bytes, inst,
+                                 std::move(context));
+}
+
+// Decode an instruction that is within a delay slot.
+bool DecodeCache::DecodeDelayedInstruction(uint64_t address,
+                                           std::string_view instr_bytes,
+                                           Instruction &inst,
+                                           DecodingContext context) {
+  inst.in_delay_slot = true;
+  return impl->DecodeInstruction(address, instr_bytes, inst,
+                                 std::move(context));
+}
+
+const DecodeCacheStats &DecodeCache::Stats(void) const {
+  return impl->stats;
+}
+
+// Drop all cached instructions.
+void DecodeCache::Clear(void) {
+  impl->entries.clear();
+  impl->lru.clear();
+  impl->num_exact_keys = 0u;
+  impl->num_prefix_keys.clear();
+}
+
+}  // namespace remill
@@ -20,6 +20,7 @@
 #include <llvm/IR/Instruction.h>
 #include <llvm/IR/Instructions.h>
 
+#include <algorithm>
 #include <iomanip>
 #include <sstream>
 
@@ -50,7 +51,7 @@ std::string OperandExpression::Serialize(void) const {
   return ss.str();
 }
 
-Operand::Register::Register(void) : size(0) {}
+Operand::Register::Register(void) : size(0), resolved(nullptr) {}
 
 Operand::ShiftRegister::ShiftRegister(void)
     : shift_size(0),
@@ -303,7 +304,8 @@ std::string Condition::Serialize(void) const {
 
 
 Instruction::Instruction(void)
-    : pc(0),
+    : form(kUnknownForm),
+      pc(0),
       next_pc(0),
       delayed_pc(0),
       branch_taken_pc(0),
@@ -319,6 +321,68 @@ Instruction::Instruction(void)
       category(Instruction::kCategoryInvalid),
       flows(Instruction::InvalidInsn()) {}
 
+Instruction::~Instruction(void) {}
+
+Instruction::Instruction(const Instruction &that)
+    : function(that.function),
+      form(that.form),
+      bytes(that.bytes),
+      pc(that.pc),
+      next_pc(that.next_pc),
+      delayed_pc(that.delayed_pc),
+      branch_taken_pc(that.branch_taken_pc),
+      branch_not_taken_pc(that.branch_not_taken_pc),
+      arch_name(that.arch_name),
+      sub_arch_name(that.sub_arch_name),
+      branch_taken_arch_name(that.branch_taken_arch_name),
+      arch(that.arch),
+      is_atomic_read_modify_write(that.is_atomic_read_modify_write),
+      has_branch_taken_delay_slot(that.has_branch_taken_delay_slot),
+      has_branch_not_taken_delay_slot(that.has_branch_not_taken_delay_slot),
+      in_delay_slot(that.in_delay_slot),
+      segment_override(that.segment_override),
+      category(that.category),
+      flows(that.flows),
+      operands(that.operands),
+      lifter(that.lifter),
+      next_expr_index(that.next_expr_index) {
+
+  if (!that.exprs) {
+    return;
+  }
+
+  exprs.reset(new OperandExpression[kMaxNumExpr]);
+  std::copy(&(that.exprs[0]), &(that.exprs[next_expr_index]), &(exprs[0]));
+
+  // Redirect any pointers to the expressions of `that` to our expressions.
+  const auto begin = &(that.exprs[0]);
+  const auto end = &(that.exprs[kMaxNumExpr]);
+  auto rebase = [=](OperandExpression *&expr) {
+    if (begin <= expr && expr < end) {
+      expr = &(exprs[expr - begin]);
+    }
+  };
+
+  for (auto &op : operands) {
+    rebase(op.expr);
+  }
+
+  for (auto i = 0u; i < next_expr_index; ++i) {
+    if (auto llvm_op = std::get_if<LLVMOpExpr>(&(exprs[i]))) {
+      rebase(llvm_op->op1);
+      rebase(llvm_op->op2);
+    }
+  }
+}
+
+Instruction &Instruction::operator=(const Instruction &that) {
+  if (this != &that) {
+    Instruction copy(that);
+    *this = std::move(copy);
+  }
+  return *this;
+}
+
 void Instruction::Reset(void) {
   pc = 0;
   next_pc = 0;
@@ -332,16 +396,22 @@ void Instruction::Reset(void) {
   has_branch_taken_delay_slot = false;
   has_branch_not_taken_delay_slot = false;
   in_delay_slot = false;
+  segment_override = nullptr;
   category = Instruction::kCategoryInvalid;
+  flows = Instruction::InvalidInsn();
   arch = nullptr;
   operands.clear();
   function.clear();
+  form = kUnknownForm;
   bytes.clear();
   next_expr_index = 0;
 }
 
 OperandExpression *Instruction::AllocateExpression(void) {
   CHECK_LT(next_expr_index, kMaxNumExpr);
+  if (!exprs) {
+    exprs.reset(new OperandExpression[kMaxNumExpr]);
+  }
   return &(exprs[next_expr_index++]);
 }
 
@@ -65,6 +65,17 @@ extern "C" [[gnu::used]] void __remill_intrinsics(void) {
   USED(__remill_write_memory_f80);
   USED(__remill_write_memory_f128);
 
+  USED(__remill_read_memory_v128);
+  USED(__remill_read_memory_v256);
+  USED(__remill_read_memory_v512);
+
+  USED(__remill_write_memory_v128);
+  USED(__remill_write_memory_v256);
+  USED(__remill_write_memory_v512);
+
+  USED(__remill_memcpy);
+  USED(__remill_memset);
+
   USED(__remill_barrier_load_load);
   USED(__remill_barrier_load_store);
   USED(__remill_barrier_store_load);
@@ -77,7 +77,7 @@ bool AArch32Arch::DecodeInstruction(uint64_t address,
   inst.operands.clear();
   inst.flows = Instruction::InvalidInsn();
 
-  if (!context.HasValueForReg(std::string(kThumbModeRegName))) {
+  if (!context.HasValueForReg(kThumbModeRegId)) {
     return false;
   }
 
@@ -86,7 +86,7 @@ bool AArch32Arch::DecodeInstruction(uint64_t address,
 }
 
 DecodingContext AArch32Arch::CreateInitialContext(void) const {
-  return DecodingContext().PutContextReg(std::string(kThumbModeRegName), 0);
+  return DecodingContext().PutContextReg(kThumbModeRegId, 0);
 }
 
 
@@ -120,7 +120,7 @@ bool AArch32Arch::DecodeSleigh(uint64_t address, std::string_view instr_bytes,
 }
 
 bool AArch32Arch::IsThumb(const DecodingContext &context) {
-  return context.GetContextValue(std::string(kThumbModeRegName));
+  return context.GetContextValue(kThumbModeRegId);
 }
 
 }  // namespace remill
@@ -30,7 +30,7 @@ SleighAArch64Decoder::SleighAArch64Decoder(const remill::Arch &arch)
 
 void SleighAArch64Decoder::InitializeSleighContext(
     uint64_t addr, remill::sleigh::SingleInstructionSleighContext &ctxt,
-    const ContextValues &values) const {}
+    const DecodingContext &context) const {}
 
 llvm::Value *SleighAArch64Decoder::LiftPcFromCurrPc(
     llvm::IRBuilder<> &bldr, llvm::Value *curr_pc, size_t curr_insn_size,
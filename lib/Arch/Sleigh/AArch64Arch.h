@@ -16,7 +16,7 @@ class SleighAArch64Decoder final : public remill::sleigh::SleighDecoder {
   void
   InitializeSleighContext(uint64_t addr,
                           remill::sleigh::SingleInstructionSleighContext &ctxt,
-                          const ContextValues &context_values) const final;
+                          const DecodingContext &context) const final;
 };
 
 class AArch64Arch final : public AArch64ArchBase {
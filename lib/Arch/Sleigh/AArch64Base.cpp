@@ -4,6 +4,8 @@
 #include <remill/BC/ABI.h>
 #include <remill/BC/Util.h>
 
+#include <algorithm>
+
 namespace remill {
 // Returns the name of the stack pointer register.
 std::string_view AArch64ArchBase::StackPointerRegisterName(void) const {
@@ -15,6 +17,18 @@ std::string_view AArch64ArchBase::ProgramCounterRegisterName(void) const {
   return "PC";
 }
 
+static const std::string_view kFlagNames[] = {
+    "N", "Z", "C", "V",
+
+    // Flags used by the SLEIGH-based lifter.
+    "NG", "ZR", "CY", "OV", "SHIFT_CARRY", "TMPCY", "TMPOV", "TMPZR", "TMPNG"};
+
+// Returns `true` if `reg` is one of the condition flags.
+bool AArch64ArchBase::IsFlagRegister(const Register *reg) const {
+  return std::find(std::begin(kFlagNames), std::end(kFlagNames), reg->name) !=
+         std::end(kFlagNames);
+}
+
 uint64_t AArch64ArchBase::MinInstructionAlign(const DecodingContext &) const {
   return 4;
 }
@@ -396,6 +410,11 @@ void AArch64ArchBase::PopulateRegisterTable(void) const {
   SUB_REG(state, Q30, simd.v[30].dqwords.elems[0], v128u128, V30);
   SUB_REG(state, Q31, simd.v[31].dqwords.elems[0], v128u128, V31);
 
+  REG(state, N, sr.n, u8);
+  REG(state, Z, sr.z, u8);
+  REG(state, C, sr.c, u8);
+  REG(state, V, sr.v, u8);
+
   REG(state, TPIDR_EL0, sr.tpidr_el0.qword, u64);
   REG(state, TPIDRRO_EL0, sr.tpidrro_el0.qword, u64);
 }
@@ -21,6 +21,9 @@
 #include <remill/Arch/Name.h>
 #include <remill/BC/SleighLifter.h>
 
+#include <map>
+#include <utility>
+
 namespace remill::sleigh {
 
 namespace {
@@ -83,12 +86,23 @@ std::vector<std::string> SingleInstructionSleighContext::getUserOpNames() {
   return res;
 }
 
-SingleInstructionSleighContext::SingleInstructionSleighContext(
-    std::string sla_name, std::string pspec_name)
-    : engine(&image, &ctx) {
+// Parse the `.sla` and `.pspec` files named `sla_name` and `pspec_name`, or
+// return the already parsed files.
+std::shared_ptr<const SleighSpecification>
+SleighSpecification::Get(const std::string &sla_name,
+                         const std::string &pspec_name) {
+  static std::map<std::pair<std::string, std::string>,
+                  std::shared_ptr<const SleighSpecification>>
+      gSpecs;
 
+  // SLEIGH's XML parser uses global state.
   auto guard = Arch::Lock(ArchName::kArchX86_SLEIGH);
 
+  auto &spec = gSpecs[{sla_name, pspec_name}];
+  if (spec) {
+    return spec;
+  }
+
   const std::optional<std::filesystem::path> sla_path =
       ::sleigh::FindSpecFile(sla_name.c_str());
   if (!sla_path) {
@@ -107,14 +121,29 @@ SingleInstructionSleighContext::SingleInstructionSleighContext(
   }
   LOG(INFO) << "Using pspec at: " << pspec_path->string();
 
+  auto new_spec = std::make_shared<SleighSpecification>();
+  auto &storage = new_spec->storage;
   Element *root = storage.openDocument(sla_path->string())->getRoot();
   storage.registerTag(root);
 
   auto pspec = storage.openDocument(pspec_path->string());
   storage.registerTag(pspec->getRoot());
+
+  spec = std::move(new_spec);
+  return spec;
+}
+
+SingleInstructionSleighContext::SingleInstructionSleighContext(
+    std::string sla_name, std::string pspec_name)
+    : engine(&image, &ctx),
+      spec(SleighSpecification::Get(sla_name, pspec_name)) {
   this->restoreEngineFromStorage();
 }
+
 void SingleInstructionSleighContext::restoreEngineFromStorage() {
+
+  // Engines only read the parsed specification, so they can share it.
+  auto &storage = const_cast<DocumentStorage &>(spec->storage);
   this->ctx = ContextInternal();
   engine.initialize(storage);
   const Element *el = storage.getTag("processor_spec");
@@ -176,11 +205,43 @@ std::string CustomLoadImage::getArchType(void) const {
 
 void CustomLoadImage::adjustVma(long) {}
 
+SleighContextPool::SleighContextPool(std::string sla_name_,
+                                     std::string pspec_name_)
+    : sla_name(std::move(sla_name_)),
+      pspec_name(std::move(pspec_name_)) {}
+
+SleighContextPool::Borrowed::Borrowed(
+    SleighContextPool &pool_,
+    std::unique_ptr<SingleInstructionSleighContext> ctx_)
+    : pool(pool_),
+      ctx(std::move(ctx_)) {}
+
+SleighContextPool::Borrowed::~Borrowed(void) {
+  std::lock_guard<std::mutex> locker(pool.lock);
+  pool.free_contexts.push_back(std::move(ctx));
+}
+
+// Borrow an engine, creating a new one if all of them are in use.
+SleighContextPool::Borrowed SleighContextPool::Acquire(void) {
+  {
+    std::lock_guard<std::mutex> locker(lock);
+    if (!free_contexts.empty()) {
+      auto ctx = std::move(free_contexts.back());
+      free_contexts.pop_back();
+      return Borrowed(*this, std::move(ctx));
+    }
+  }
+
+  return Borrowed(*this, std::make_unique<SingleInstructionSleighContext>(
+                             sla_name, pspec_name));
+}
+
 std::shared_ptr<remill::OperandLifter> SleighDecoder::GetOpLifter() const {
   return this->GetLifter();
 }
 
 std::shared_ptr<remill::SleighLifter> SleighDecoder::GetLifter() const {
+  std::lock_guard<std::mutex> locker(this->lifter_lock);
   if (this->lifter) {
     return this->lifter;
   }
@@ -204,9 +265,11 @@ bool SleighDecoder::DecodeInstruction(uint64_t address,
                                       DecodingContext context) const {
 
 
-  auto context_values = context.GetContextValues();
-  auto res_cat = const_cast<SleighDecoder *>(this)->DecodeInstructionImpl(
-      address, instr_bytes, inst, std::move(context));
+  const auto decoding_context = context;
+  auto sleigh_ctx = sleigh_contexts.Acquire();
+  std::vector<RemillPcodeOp> ops;
+  auto res_cat = this->DecodeInstructionImpl(
+      address, instr_bytes, inst, std::move(context), *sleigh_ctx, ops);
 
   if (res_cat.has_value()) {
     if (!res_cat->second &&
@@ -217,7 +280,8 @@ bool SleighDecoder::DecodeInstruction(uint64_t address,
     }
 
     inst.SetLifter(std::make_shared<SleighLifterWithState>(
-        res_cat->second, std::move(context_values), this->GetLifter()));
+        res_cat->second, decoding_context, std::move(ops),
+        sleigh_ctx->GetEngine(), this->GetLifter()));
     CHECK(inst.GetLifter() != nullptr);
     return true;
   } else {
@@ -230,9 +294,9 @@ SleighDecoder::SleighDecoder(
     const remill::Arch &arch_, std::string sla_name, std::string pspec_name,
     ContextRegMappings context_reg_map_,
     std::unordered_map<std::string, std::string> state_reg_map_)
-    : sleigh_ctx(sla_name, pspec_name),
-      sla_name(std::move(sla_name)),
-      pspec_name(std::move(pspec_name)),
+    : sla_name(sla_name),
+      pspec_name(pspec_name),
+      sleigh_contexts(std::move(sla_name), std::move(pspec_name)),
       lifter(nullptr),
       arch(arch_),
       context_reg_mapping(std::move(context_reg_map_)),
@@ -252,16 +316,17 @@ ControlFlowStructureAnalysis::SleighDecodingResult
 SleighDecoder::DecodeInstructionImpl(uint64_t address,
                                      std::string_view instr_bytes,
                                      Instruction &inst,
-                                     DecodingContext curr_context) {
+                                     DecodingContext curr_context,
+                                     SingleInstructionSleighContext &sleigh_ctx,
+                                     std::vector<RemillPcodeOp> &ops) const {
 
   // The SLEIGH engine will query this image when we try to decode an instruction. Append the bytes so SLEIGH has data to read.
 
 
   // Now decode the instruction.
-  this->sleigh_ctx.resetContext();
-  this->InitializeSleighContext(address, this->sleigh_ctx,
-                                curr_context.GetContextValues());
-  PcodeDecoder pcode_handler(this->sleigh_ctx.GetEngine());
+  sleigh_ctx.resetContext();
+  this->InitializeSleighContext(address, sleigh_ctx, curr_context);
+  PcodeDecoder pcode_handler(sleigh_ctx.GetEngine());
 
 
   inst.arch = &this->arch;
@@ -273,7 +338,7 @@ SleighDecoder::DecodeInstructionImpl(uint64_t address,
   inst.category = Instruction::kCategoryInvalid;
 
   auto instr_len =
-      this->sleigh_ctx.oneInstruction(address, pcode_handler, inst.bytes);
+      sleigh_ctx.oneInstruction(address, pcode_handler, inst.bytes);
 
   if (!instr_len || instr_len > instr_bytes.size()) {
     return std::nullopt;
@@ -282,15 +347,17 @@ SleighDecoder::DecodeInstructionImpl(uint64_t address,
   inst.bytes = instr_bytes.substr(0, *instr_len);
   assert(inst.bytes.size() == instr_len);
 
+  // Nothing was reset since emitting the p-code, so SLEIGH's disassembly cache
+  // returns the already parsed instruction.
   InstructionFunctionSetter setter(inst);
 
-  this->sleigh_ctx.oneInstruction(address, setter, inst.bytes);
+  sleigh_ctx.oneInstruction(address, setter, inst.bytes);
   uint64_t fallthrough = address + *instr_len;
   inst.next_pc = fallthrough;
 
   ControlFlowStructureAnalysis analysis(
       this->context_reg_mapping.GetInternalRegMapping(),
-      this->sleigh_ctx.GetEngine());
+      sleigh_ctx.GetEngine());
 
 
   auto cat =
@@ -302,12 +369,14 @@ SleighDecoder::DecodeInstructionImpl(uint64_t address,
     // Do not mark the instruction category as "invalid". Even if we can't determine a control flow
     // category, we still want to attempt to lift this instruction.
     inst.category = Instruction::Category::kCategoryNormal;
+    ops = std::move(pcode_handler.ops);
     return std::make_pair(inst.flows, std::nullopt);
   }
 
   inst.flows = cat->first;
 
   this->ApplyFlowToInstruction(inst);
+  ops = std::move(pcode_handler.ops);
 
   DLOG(INFO) << "Fallthrough: " << fallthrough;
   DLOG(INFO) << "Decoded as " << inst.Serialize();
@@ -316,6 +385,10 @@ SleighDecoder::DecodeInstructionImpl(uint64_t address,
 }
 
 
+std::vector<std::string> SleighDecoder::GetUserOpNames(void) const {
+  return sleigh_contexts.Acquire()->getUserOpNames();
+}
+
 const std::string &SleighDecoder::GetSLAName() const {
   return this->sla_name;
 }
@@ -404,6 +477,16 @@ Overload(Ts...) -> Overload<Ts...>;
 }  // namespace
 
 
+ContextRegMappings::ContextRegMappings(
+    std::unordered_map<std::string, std::string> context_reg_mapping_,
+    std::unordered_map<std::string, size_t> vnode_size_mapping_)
+    : context_reg_mapping(std::move(context_reg_mapping_)),
+      vnode_size_mapping(std::move(vnode_size_mapping_)) {
+  for (const auto &[sleigh_reg, remill_reg] : context_reg_mapping) {
+    context_reg_id_mapping.emplace(sleigh_reg, InternContextReg(remill_reg));
+  }
+}
+
 const std::unordered_map<std::string, size_t> &
 ContextRegMappings::GetSizeMapping() const {
   return this->vnode_size_mapping;
@@ -414,6 +497,11 @@ ContextRegMappings::GetInternalRegMapping() const {
   return this->context_reg_mapping;
 }
 
+const std::unordered_map<std::string, ContextRegId> &
+ContextRegMappings::GetInternalRegIdMapping() const {
+  return this->context_reg_id_mapping;
+}
+
 void SleighDecoder::ApplyFlowToInstruction(remill::Instruction &inst) const {
 
 
@@ -501,26 +589,41 @@ void SleighDecoder::ApplyFlowToInstruction(remill::Instruction &inst) const {
   std::visit(applyer, inst.flows);
 }
 
-uint64_t GetContextRegisterValue(const char *remill_reg_name,
+uint64_t GetContextRegisterValue(ContextRegId remill_reg_id,
                                  uint64_t default_value,
-                                 const ContextValues &context_values) {
-  const auto iter = context_values.find(remill_reg_name);
-  if (iter != context_values.end()) {
-    return iter->second;
+                                 const DecodingContext &context) {
+  if (context.HasValueForReg(remill_reg_id)) {
+    return context.GetContextValue(remill_reg_id);
   }
   return default_value;
 }
 
+uint64_t GetContextRegisterValue(std::string_view remill_reg_name,
+                                 uint64_t default_value,
+                                 const DecodingContext &context) {
+  return GetContextRegisterValue(InternContextReg(remill_reg_name),
+                                 default_value, context);
+}
+
 
 void SetContextRegisterValueInSleigh(
-    uint64_t addr, const char *remill_reg_name, const char *sleigh_reg_name,
+    uint64_t addr, ContextRegId remill_reg_id, const char *sleigh_reg_name,
     uint64_t default_value, sleigh::SingleInstructionSleighContext &ctxt,
-    const ContextValues &context_values) {
-  auto value =
-      GetContextRegisterValue(remill_reg_name, default_value, context_values);
+    const DecodingContext &context) {
+  auto value = GetContextRegisterValue(remill_reg_id, default_value, context);
   ctxt.GetContext().setVariable(sleigh_reg_name,
                                 ctxt.GetAddressFromOffset(addr), value);
 }
 
+void SetContextRegisterValueInSleigh(
+    uint64_t addr, std::string_view remill_reg_name,
+    const char *sleigh_reg_name, uint64_t default_value,
+    sleigh::SingleInstructionSleighContext &ctxt,
+    const DecodingContext &context) {
+  SetContextRegisterValueInSleigh(addr, InternContextReg(remill_reg_name),
+                                  sleigh_reg_name, default_value, ctxt,
+                                  context);
+}
+
 
 }  // namespace remill::sleigh
@@ -19,8 +19,11 @@
 #include <remill/Arch/ArchBase.h>
 #include <remill/BC/SleighLifter.h>
 
+#include <memory>
+#include <mutex>
 #include <sleigh/libsleigh.hh>
 #include <unordered_set>
+#include <vector>
 
 // Unifies shared functionality between sleigh architectures
 
@@ -58,6 +61,17 @@ class CustomLoadImage final : public LoadImage {
   uint64_t current_offset{0};
 };
 
+// The parsed `.sla` and `.pspec` files of an architecture. These are parsed
+// once per process, and then shared, read-only, by all of the engines that
+// use them.
+class SleighSpecification {
+ public:
+  static std::shared_ptr<const SleighSpecification>
+  Get(const std::string &sla_name, const std::string &pspec_name);
+
+  DocumentStorage storage;
+};
+
 // Holds onto contextual sleigh information in order to provide an interface with which you can decode single instructions
 // Give me bytes and i give you pcode (maybe)
 class SingleInstructionSleighContext {
@@ -65,7 +79,7 @@ class SingleInstructionSleighContext {
   CustomLoadImage image;
   ContextInternal ctx;
   ::Sleigh engine;
-  DocumentStorage storage;
+  std::shared_ptr<const SleighSpecification> spec;
 
   std::optional<int32_t>
   oneInstruction(uint64_t address,
@@ -95,6 +109,46 @@ class SingleInstructionSleighContext {
   std::vector<std::string> getUserOpNames();
 };
 
+// A pool of engines for one architecture. SLEIGH engines are not thread-safe,
+// so each concurrent decode borrows its own engine from the pool.
+//
+// Engines outlive the pool, because their p-code refers to their address
+// spaces.
+class SleighContextPool {
+ public:
+  SleighContextPool(std::string sla_name_, std::string pspec_name_);
+
+  // Returns an engine to the pool when destroyed.
+  class Borrowed {
+   public:
+    Borrowed(SleighContextPool &pool_,
+             std::unique_ptr<SingleInstructionSleighContext> ctx_);
+    ~Borrowed(void);
+
+    SingleInstructionSleighContext &operator*(void) const {
+      return *ctx;
+    }
+
+    SingleInstructionSleighContext *operator->(void) const {
+      return ctx.get();
+    }
+
+   private:
+    SleighContextPool &pool;
+    std::unique_ptr<SingleInstructionSleighContext> ctx;
+  };
+
+  // Borrow an engine, creating a new one if all of them are in use.
+  Borrowed Acquire(void);
+
+ private:
+  const std::string sla_name;
+  const std::string pspec_name;
+
+  std::mutex lock;
+  std::vector<std::unique_ptr<SingleInstructionSleighContext>> free_contexts;
+};
+
 struct ContextRegMappings {
 
  private:
@@ -103,18 +157,23 @@ struct ContextRegMappings {
   // We need to allocate space for an instruction to manipulate a
   // Context reg as needed. This space is also populated with the incoming value.
   std::unordered_map<std::string, size_t> vnode_size_mapping;
+  // The interned IDs of the remill context registers in `context_reg_mapping`,
+  // keyed by the same pcode context register names. These are interned once
+  // here, rather than on each lift, as interning takes a global lock.
+  std::unordered_map<std::string, ContextRegId> context_reg_id_mapping;
 
  public:
   ContextRegMappings(
       std::unordered_map<std::string, std::string> context_reg_mapping,
-      std::unordered_map<std::string, size_t> vnode_size_mapping)
-      : context_reg_mapping(std::move(context_reg_mapping)),
-        vnode_size_mapping(std::move(vnode_size_mapping)) {}
+      std::unordered_map<std::string, size_t> vnode_size_mapping);
 
   const std::unordered_map<std::string, size_t> &GetSizeMapping() const;
 
   const std::unordered_map<std::string, std::string> &
   GetInternalRegMapping() const;
+
+  const std::unordered_map<std::string, ContextRegId> &
+  GetInternalRegIdMapping() const;
 };
 
 class SleighDecoder {
@@ -130,7 +189,7 @@ class SleighDecoder {
   // Decoder specific prep
   virtual void InitializeSleighContext(uint64_t address,
                                        SingleInstructionSleighContext &,
-                                       const ContextValues &) const = 0;
+                                       const DecodingContext &) const = 0;
 
 
   virtual llvm::Value *
@@ -138,6 +197,7 @@ class SleighDecoder {
                    size_t curr_insn_size, const DecodingContext &) const = 0;
 
 
+  // Decode the instruction at `address`. This is thread-safe.
   bool DecodeInstruction(uint64_t address, std::string_view instr_bytes,
                          Instruction &inst, DecodingContext context) const;
 
@@ -150,15 +210,22 @@ class SleighDecoder {
 
   std::shared_ptr<remill::OperandLifter> GetOpLifter() const;
 
+  // Names of the user-defined p-code ops of the engines.
+  std::vector<std::string> GetUserOpNames(void) const;
+
  protected:
+  // Decode the instruction at `address` using `sleigh_ctx`, saving its p-code
+  // into `ops`.
   ControlFlowStructureAnalysis::SleighDecodingResult
   DecodeInstructionImpl(uint64_t address, std::string_view instr_bytes,
-                        Instruction &inst, DecodingContext context);
+                        Instruction &inst, DecodingContext context,
+                        SingleInstructionSleighContext &sleigh_ctx,
+                        std::vector<RemillPcodeOp> &ops) const;
 
 
-  SingleInstructionSleighContext sleigh_ctx;
   std::string sla_name;
   std::string pspec_name;
+  mutable SleighContextPool sleigh_contexts;
 
  private:
   std::shared_ptr<remill::SleighLifter> GetLifter() const;
@@ -166,19 +233,32 @@ class SleighDecoder {
   void ApplyFlowToInstruction(remill::Instruction &) const;
 
 
+  mutable std::mutex lifter_lock;
   mutable std::shared_ptr<remill::SleighLifter> lifter;
   const remill::Arch &arch;
   ContextRegMappings context_reg_mapping;
   std::unordered_map<std::string, std::string> state_reg_remappings;
 };
 
-uint64_t GetContextRegisterValue(const char *remill_reg_name,
+// These run for every decoded instruction, so they take interned IDs rather
+// than names.
+uint64_t GetContextRegisterValue(ContextRegId remill_reg_id,
+                                 uint64_t default_value,
+                                 const DecodingContext &context);
+
+uint64_t GetContextRegisterValue(std::string_view remill_reg_name,
                                  uint64_t default_value,
-                                 const ContextValues &context_values);
+                                 const DecodingContext &context);
 
 void SetContextRegisterValueInSleigh(
-    uint64_t addr, const char *remill_reg_name, const char *sleigh_reg_name,
+    uint64_t addr, ContextRegId remill_reg_id, const char *sleigh_reg_name,
     uint64_t default_value, sleigh::SingleInstructionSleighContext &ctxt,
-    const ContextValues &context_values);
+    const DecodingContext &context);
+
+void SetContextRegisterValueInSleigh(
+    uint64_t addr, std::string_view remill_reg_name,
+    const char *sleigh_reg_name, uint64_t default_value,
+    sleigh::SingleInstructionSleighContext &ctxt,
+    const DecodingContext &context);
 
 }  // namespace remill::sleigh
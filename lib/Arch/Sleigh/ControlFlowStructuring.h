@@ -13,12 +13,6 @@ namespace remill::sleigh {
 bool isVarnodeInConstantSpace(VarnodeData vnode);
 
 
-struct RemillPcodeOp {
-  OpCode op;
-  std::optional<VarnodeData> outvar;
-  std::vector<VarnodeData> vars;
-};
-
 /// A context updates a context if the target PcodeOp updates the context. if it is non constant it drops the context
 class ContextUpdater {
  private:
@@ -36,7 +36,7 @@ class SleighPPCDecoder final : public remill::sleigh::SleighDecoder {
 
   void InitializeSleighContext(uint64_t addr,
                                remill::sleigh::SingleInstructionSleighContext &,
-                               const ContextValues &) const override;
+                               const DecodingContext &) const override;
 };
 
 }  // namespace remill::sleighppc
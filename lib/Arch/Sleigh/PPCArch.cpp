@@ -25,6 +25,7 @@ namespace remill {
 namespace sleighppc {
 
 static constexpr auto kPPCVLERegName = "VLEReg";
+static const ContextRegId kPPCVLERegId = InternContextReg(kPPCVLERegName);
 
 SleighPPCDecoder::SleighPPCDecoder(const remill::Arch &arch)
     : SleighDecoder(
@@ -43,13 +44,13 @@ llvm::Value *SleighPPCDecoder::LiftPcFromCurrPc(llvm::IRBuilder<> &bldr,
 
 void SleighPPCDecoder::InitializeSleighContext(
     uint64_t addr, remill::sleigh::SingleInstructionSleighContext &ctxt,
-    const ContextValues &context_values) const {
+    const DecodingContext &context) const {
   // If the context value mappings specify a value for the VLE register, let's pass that into
   // Sleigh.
   //
   // Otherwise, default to VLE off.
-  sleigh::SetContextRegisterValueInSleigh(addr, kPPCVLERegName, "vle", 0, ctxt,
-                                          context_values);
+  sleigh::SetContextRegisterValueInSleigh(addr, kPPCVLERegId, "vle", 0, ctxt,
+                                          context);
 }
 
 class SleighPPCArch : public ArchBase {
@@ -61,7 +62,7 @@ class SleighPPCArch : public ArchBase {
   virtual ~SleighPPCArch() = default;
 
   DecodingContext CreateInitialContext(void) const override {
-    return DecodingContext().PutContextReg(kPPCVLERegName, 0);
+    return DecodingContext().PutContextReg(kPPCVLERegId, 0);
   }
 
   std::string_view StackPointerRegisterName(void) const override {
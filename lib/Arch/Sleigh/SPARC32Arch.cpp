@@ -29,7 +29,7 @@ SleighSPARC32Decoder::SleighSPARC32Decoder(const remill::Arch &arch)
 
 void SleighSPARC32Decoder::InitializeSleighContext(
     uint64_t addr, remill::sleigh::SingleInstructionSleighContext &ctxt,
-    const ContextValues &values) const {}
+    const DecodingContext &context) const {}
 
 llvm::Value *SleighSPARC32Decoder::LiftPcFromCurrPc(
     llvm::IRBuilder<> &bldr, llvm::Value *curr_pc, size_t curr_insn_size,
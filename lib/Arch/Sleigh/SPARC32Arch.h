@@ -16,7 +16,7 @@ class SleighSPARC32Decoder final : public remill::sleigh::SleighDecoder {
   void
   InitializeSleighContext(uint64_t addr,
                           remill::sleigh::SingleInstructionSleighContext &ctxt,
-                          const ContextValues &context_values) const final;
+                          const DecodingContext &context) const final;
 };
 
 class SPARC32Arch final : public SPARC32ArchBase {
@@ -26,7 +26,7 @@ class SleighAArch32ThumbDecoder final : public remill::sleigh::SleighDecoder {
   void
   InitializeSleighContext(uint64_t addr,
                           remill::sleigh::SingleInstructionSleighContext &ctxt,
-                          const ContextValues &context_values) const final;
+                          const DecodingContext &context) const final;
 };
 }  // namespace sleighthumb2
 }  // namespace remill
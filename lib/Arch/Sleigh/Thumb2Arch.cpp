@@ -43,9 +43,9 @@ SleighAArch32ThumbDecoder::SleighAArch32ThumbDecoder(const remill::Arch &arch)
 
 void SleighAArch32ThumbDecoder::InitializeSleighContext(
     uint64_t addr, remill::sleigh::SingleInstructionSleighContext &ctxt,
-    const ContextValues &values) const {
-  sleigh::SetContextRegisterValueInSleigh(
-      addr, std::string(kThumbModeRegName).c_str(), "TMode", 1, ctxt, values);
+    const DecodingContext &context) const {
+  sleigh::SetContextRegisterValueInSleigh(addr, kThumbModeRegId, "TMode", 1,
+                                          ctxt, context);
 }
 
 llvm::Value *SleighAArch32ThumbDecoder::LiftPcFromCurrPc(
@@ -70,7 +70,7 @@ class SleighThumbArch : public AArch32ArchBase {
         decoder(*this) {}
 
   virtual DecodingContext CreateInitialContext(void) const override {
-    return DecodingContext().PutContextReg(std::string(kThumbModeRegName), 1);
+    return DecodingContext().PutContextReg(kThumbModeRegId, 1);
   }
 
   virtual OperandLifter::OpLifterPtr
@@ -82,7 +82,7 @@ class SleighThumbArch : public AArch32ArchBase {
                                  Instruction &inst,
                                  DecodingContext context) const override {
     //for thumb only support in thumb mode
-    context.UpdateContextReg(std::string(kThumbModeRegName), 1);
+    context.UpdateContextReg(kThumbModeRegId, 1);
     return decoder.DecodeInstruction(address, instr_bytes, inst, context);
   }
 
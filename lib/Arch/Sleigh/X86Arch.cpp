@@ -45,7 +45,7 @@ class SleighX86Decoder final : public SleighDecoder {
   void
   InitializeSleighContext(uint64_t addr,
                           remill::sleigh::SingleInstructionSleighContext &ctxt,
-                          const ContextValues &) const override {}
+                          const DecodingContext &) const override {}
 
   llvm::Value *LiftPcFromCurrPc(llvm::IRBuilder<> &bldr, llvm::Value *curr_pc,
                                 size_t curr_insn_size,
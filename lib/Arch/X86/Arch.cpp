@@ -24,8 +24,9 @@
 #include <remill/Arch/X86/X86Base.h>
 
 #include <iomanip>
-#include <map>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <sstream>
 #include <string>
 
@@ -245,86 +246,33 @@ static Instruction::Category CreateCategory(const xed_decoded_inst_t *xedd) {
   }
 }
 
-std::map<xed_iform_enum_t, xed_iform_enum_t> kUnlockedIform = {
-    {XED_IFORM_ADC_LOCK_MEMb_IMMb_80r2, XED_IFORM_ADC_MEMb_IMMb_80r2},
-    {XED_IFORM_ADC_LOCK_MEMv_IMMz, XED_IFORM_ADC_MEMv_IMMz},
-    {XED_IFORM_ADC_LOCK_MEMb_IMMb_82r2, XED_IFORM_ADC_MEMb_IMMb_82r2},
-    {XED_IFORM_ADC_LOCK_MEMv_IMMb, XED_IFORM_ADC_MEMv_IMMb},
-    {XED_IFORM_ADC_LOCK_MEMb_GPR8, XED_IFORM_ADC_MEMb_GPR8},
-    {XED_IFORM_ADC_LOCK_MEMv_GPRv, XED_IFORM_ADC_MEMv_GPRv},
-    {XED_IFORM_DEC_LOCK_MEMb, XED_IFORM_DEC_MEMb},
-    {XED_IFORM_DEC_LOCK_MEMv, XED_IFORM_DEC_MEMv},
-    {XED_IFORM_NOT_LOCK_MEMb, XED_IFORM_NOT_MEMb},
-    {XED_IFORM_NOT_LOCK_MEMv, XED_IFORM_NOT_MEMv},
-    {XED_IFORM_SUB_LOCK_MEMb_IMMb_80r5, XED_IFORM_SUB_MEMb_IMMb_80r5},
-    {XED_IFORM_SUB_LOCK_MEMv_IMMz, XED_IFORM_SUB_MEMv_IMMz},
-    {XED_IFORM_SUB_LOCK_MEMb_IMMb_82r5, XED_IFORM_SUB_MEMb_IMMb_82r5},
-    {XED_IFORM_SUB_LOCK_MEMv_IMMb, XED_IFORM_SUB_MEMv_IMMb},
-    {XED_IFORM_SUB_LOCK_MEMb_GPR8, XED_IFORM_SUB_MEMb_GPR8},
-    {XED_IFORM_SUB_LOCK_MEMv_GPRv, XED_IFORM_SUB_MEMv_GPRv},
-    {XED_IFORM_BTC_LOCK_MEMv_IMMb, XED_IFORM_BTC_MEMv_IMMb},
-    {XED_IFORM_BTC_LOCK_MEMv_GPRv, XED_IFORM_BTC_MEMv_GPRv},
-    {XED_IFORM_AND_LOCK_MEMb_IMMb_80r4, XED_IFORM_AND_MEMb_IMMb_80r4},
-    {XED_IFORM_AND_LOCK_MEMv_IMMz, XED_IFORM_AND_MEMv_IMMz},
-    {XED_IFORM_AND_LOCK_MEMb_IMMb_82r4, XED_IFORM_AND_MEMb_IMMb_82r4},
-    {XED_IFORM_AND_LOCK_MEMv_IMMb, XED_IFORM_AND_MEMv_IMMb},
-    {XED_IFORM_AND_LOCK_MEMb_GPR8, XED_IFORM_AND_MEMb_GPR8},
-    {XED_IFORM_AND_LOCK_MEMv_GPRv, XED_IFORM_AND_MEMv_GPRv},
-    {XED_IFORM_CMPXCHG_LOCK_MEMb_GPR8, XED_IFORM_CMPXCHG_MEMb_GPR8},
-    {XED_IFORM_CMPXCHG_LOCK_MEMv_GPRv, XED_IFORM_CMPXCHG_MEMv_GPRv},
-    {XED_IFORM_INC_LOCK_MEMb, XED_IFORM_INC_MEMb},
-    {XED_IFORM_INC_LOCK_MEMv, XED_IFORM_INC_MEMv},
-    {XED_IFORM_OR_LOCK_MEMb_IMMb_80r1, XED_IFORM_OR_MEMb_IMMb_80r1},
-    {XED_IFORM_OR_LOCK_MEMv_IMMz, XED_IFORM_OR_MEMv_IMMz},
-    {XED_IFORM_OR_LOCK_MEMb_IMMb_82r1, XED_IFORM_OR_MEMb_IMMb_82r1},
-    {XED_IFORM_OR_LOCK_MEMv_IMMb, XED_IFORM_OR_MEMv_IMMb},
-    {XED_IFORM_OR_LOCK_MEMb_GPR8, XED_IFORM_OR_MEMb_GPR8},
-    {XED_IFORM_OR_LOCK_MEMv_GPRv, XED_IFORM_OR_MEMv_GPRv},
-    {XED_IFORM_XADD_LOCK_MEMb_GPR8, XED_IFORM_XADD_MEMb_GPR8},
-    {XED_IFORM_XADD_LOCK_MEMv_GPRv, XED_IFORM_XADD_MEMv_GPRv},
-    {XED_IFORM_ADD_LOCK_MEMb_IMMb_80r0, XED_IFORM_ADD_MEMb_IMMb_80r0},
-    {XED_IFORM_ADD_LOCK_MEMv_IMMz, XED_IFORM_ADD_MEMv_IMMz},
-    {XED_IFORM_ADD_LOCK_MEMb_IMMb_82r0, XED_IFORM_ADD_MEMb_IMMb_82r0},
-    {XED_IFORM_ADD_LOCK_MEMv_IMMb, XED_IFORM_ADD_MEMv_IMMb},
-    {XED_IFORM_ADD_LOCK_MEMb_GPR8, XED_IFORM_ADD_MEMb_GPR8},
-    {XED_IFORM_ADD_LOCK_MEMv_GPRv, XED_IFORM_ADD_MEMv_GPRv},
-    {XED_IFORM_SBB_LOCK_MEMb_IMMb_80r3, XED_IFORM_SBB_MEMb_IMMb_80r3},
-    {XED_IFORM_SBB_LOCK_MEMv_IMMz, XED_IFORM_SBB_MEMv_IMMz},
-    {XED_IFORM_SBB_LOCK_MEMb_IMMb_82r3, XED_IFORM_SBB_MEMb_IMMb_82r3},
-    {XED_IFORM_SBB_LOCK_MEMv_IMMb, XED_IFORM_SBB_MEMv_IMMb},
-    {XED_IFORM_SBB_LOCK_MEMb_GPR8, XED_IFORM_SBB_MEMb_GPR8},
-    {XED_IFORM_SBB_LOCK_MEMv_GPRv, XED_IFORM_SBB_MEMv_GPRv},
-    {XED_IFORM_BTS_LOCK_MEMv_IMMb, XED_IFORM_BTS_MEMv_IMMb},
-    {XED_IFORM_BTS_LOCK_MEMv_GPRv, XED_IFORM_BTS_MEMv_GPRv},
-    {XED_IFORM_XOR_LOCK_MEMb_IMMb_80r6, XED_IFORM_XOR_MEMb_IMMb_80r6},
-    {XED_IFORM_XOR_LOCK_MEMv_IMMz, XED_IFORM_XOR_MEMv_IMMz},
-    {XED_IFORM_XOR_LOCK_MEMb_IMMb_82r6, XED_IFORM_XOR_MEMb_IMMb_82r6},
-    {XED_IFORM_XOR_LOCK_MEMv_IMMb, XED_IFORM_XOR_MEMv_IMMb},
-    {XED_IFORM_XOR_LOCK_MEMb_GPR8, XED_IFORM_XOR_MEMb_GPR8},
-    {XED_IFORM_XOR_LOCK_MEMv_GPRv, XED_IFORM_XOR_MEMv_GPRv},
-    {XED_IFORM_BTR_LOCK_MEMv_IMMb, XED_IFORM_BTR_MEMv_IMMb},
-    {XED_IFORM_BTR_LOCK_MEMv_GPRv, XED_IFORM_BTR_MEMv_GPRv},
-    {XED_IFORM_CMPXCHG8B_LOCK_MEMq, XED_IFORM_CMPXCHG8B_MEMq},
-    {XED_IFORM_CMPXCHG8B_LOCK_MEMq, XED_IFORM_CMPXCHG8B_MEMq},
-    {XED_IFORM_CMPXCHG16B_LOCK_MEMdq, XED_IFORM_CMPXCHG16B_MEMdq},
-    {XED_IFORM_NEG_LOCK_MEMb, XED_IFORM_NEG_MEMb},
-    {XED_IFORM_NEG_LOCK_MEMv, XED_IFORM_NEG_MEMv},
-    {XED_IFORM_XCHG_MEMv_GPRv, XED_IFORM_XCHG_MEMv_GPRv},
-    {XED_IFORM_XCHG_MEMb_GPR8, XED_IFORM_XCHG_MEMb_GPR8},
+// Iforms without a `LOCK` prefix whose semantics nonetheless perform their
+// memory accesses with a single atomic memory intrinsic, e.g.
+// `__remill_compare_exchange_memory_32`. An `XCHG` with a memory operand is
+// always atomic, even without a `LOCK` prefix.
+static const std::set<xed_iform_enum_t> kAtomicIforms = {
+    XED_IFORM_CMPXCHG_MEMb_GPR8, XED_IFORM_CMPXCHG_MEMv_GPRv,
+    XED_IFORM_CMPXCHG8B_MEMq,    XED_IFORM_CMPXCHG16B_MEMdq,
+    XED_IFORM_XCHG_MEMb_GPR8,    XED_IFORM_XCHG_MEMv_GPRv,
 };
 
+// Returns `true` if the semantics of this instruction are atomic on their own,
+// i.e. they don't need to be surrounded by the atomic begin/end intrinsics.
+//
+// NOTE: Each `LOCK`-prefixed iform has its own semantics that use the
+//       `__remill_fetch_and_*` or `__remill_compare_exchange_memory_*`
+//       intrinsics, which runtimes can implement with one host atomic instead
+//       of a global lock.
+static bool HasAtomicSemantics(const xed_decoded_inst_t *xedd) {
+  return xed_operand_values_has_lock_prefix(xedd) ||
+         kAtomicIforms.count(xed_decoded_inst_get_iform_enum(xedd));
+}
+
 // Name of this instruction function.
 static std::string InstructionFunctionName(const xed_decoded_inst_t *xedd) {
 
-  // If this instuction is marked as atomic via the `LOCK` prefix then we want
-  // to remove it because we will already be surrounding the call to the
-  // semantics function with the atomic begin/end intrinsics.
+  // Keep the `_LOCK_` iform names so that these get their atomic semantics.
   auto iform = xed_decoded_inst_get_iform_enum(xedd);
-  if (xed_operand_values_has_lock_prefix(xedd)) {
-    CHECK(kUnlockedIform.count(iform))
-        << xed_iform_enum_t2str(iform) << " has no unlocked iform mapping.";
-    iform = kUnlockedIform[iform];
-  }
 
   std::stringstream ss;
   std::string iform_name = xed_iform_enum_t2str(iform);
@@ -802,6 +750,11 @@ class X86Arch final : public X86ArchBase, public DefaultContextAndLifter {
   bool ArchDecodeInstruction(uint64_t address, std::string_view inst_bytes,
                              Instruction &inst) const final;
 
+  // XED only looks at the bytes of the instruction itself. Fusing a
+  // `call $0` with a following `pop r` looks at up to two more bytes.
+  uint64_t MaxDecodeLookahead(const DecodingContext &) const final {
+    return 2u;
+  }
 
  private:
   X86Arch(void) = delete;
@@ -813,12 +766,13 @@ X86Arch::X86Arch(llvm::LLVMContext *context_, OSName os_name_,
       X86ArchBase(context_, os_name_, arch_name_),
       DefaultContextAndLifter(context_, os_name_, arch_name_) {
 
-  static bool xed_is_initialized = false;
-  if (!xed_is_initialized) {
+  // `X86Arch`s may be built concurrently, e.g. by `ParallelTraceLifter`
+  // workers.
+  static std::once_flag xed_is_initialized;
+  std::call_once(xed_is_initialized, [] {
     DLOG(INFO) << "Initializing XED tables";
     xed_tables_init();
-    xed_is_initialized = true;
-  }
+  });
 }
 
 X86Arch::~X86Arch(void) {}
@@ -1101,10 +1055,12 @@ bool X86Arch::ArchDecodeInstruction(uint64_t address,
   }
 
   // Wrap an instruction in atomic begin/end if it accesses memory with RMW
-  // semantics or with a LOCK prefix.
-  if (xed_operand_values_get_atomic(xedd) ||
-      xed_operand_values_has_lock_prefix(xedd) ||
-      XED_CATEGORY_SEMAPHORE == xed_decoded_inst_get_category(xedd)) {
+  // semantics or with a LOCK prefix, unless its semantics already perform
+  // those accesses with atomic memory intrinsics.
+  if ((xed_operand_values_get_atomic(xedd) ||
+       xed_operand_values_has_lock_prefix(xedd) ||
+       XED_CATEGORY_SEMAPHORE == xed_decoded_inst_get_category(xedd)) &&
+      !HasAtomicSemantics(xedd)) {
     inst.is_atomic_read_modify_write = true;
   }
 
@@ -1124,6 +1080,7 @@ bool X86Arch::ArchDecodeInstruction(uint64_t address,
 
   } else {
     inst.function = InstructionFunctionName(xedd);
+    inst.form = static_cast<uint32_t>(xed_decoded_inst_get_iform_enum(xedd));
     for (auto i = 0U; i < num_operands; ++i) {
       auto xedo = xed_inst_operand(xedi, i);
       if (XED_OPVIS_SUPPRESSED != xed_operand_operand_visibility(xedo)) {
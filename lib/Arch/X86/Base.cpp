@@ -5,11 +5,15 @@
 #include <remill/BC/Util.h>
 #include <remill/OS/OS.h>
 
+#include <algorithm>
+
 namespace remill {
 
 
 static const std::string_view kSPNames[] = {"RSP", "ESP"};
 static const std::string_view kPCNames[] = {"RIP", "EIP"};
+static const std::string_view kFlagNames[] = {"AF", "CF", "DF", "OF",
+                                              "PF", "SF", "ZF"};
 
 // Returns the name of the stack pointer register.
 std::string_view X86ArchBase::StackPointerRegisterName(void) const {
@@ -21,6 +25,12 @@ std::string_view X86ArchBase::ProgramCounterRegisterName(void) const {
   return kPCNames[IsX86()];
 }
 
+// Returns `true` if `reg` is one of the arithmetic or direction flags.
+bool X86ArchBase::IsFlagRegister(const Register *reg) const {
+  return std::find(std::begin(kFlagNames), std::end(kFlagNames), reg->name) !=
+         std::end(kFlagNames);
+}
+
 
 uint64_t X86ArchBase::MinInstructionAlign(const DecodingContext &) const {
   return 1;
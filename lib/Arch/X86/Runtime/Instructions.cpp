@@ -101,12 +101,26 @@ State __remill_state;
 #  define REG_XBX REG_EBX
 #endif  // 64 == ADDRESS_SIZE_BITS
 
-#define FLAG_CF state.aflag.cf
-#define FLAG_PF state.aflag.pf
-#define FLAG_AF state.aflag.af
-#define FLAG_ZF state.aflag.zf
-#define FLAG_SF state.aflag.sf
-#define FLAG_OF state.aflag.of
+#if REMILL_X86_LAZY_FLAGS
+
+// `add`- and `sub`-like instructions only record their operands and result in
+// `state.lazy_aflag`. The flags are computed when they're read, overwritten, or
+// at a hyper call.
+#  define FLAG_CF AFlags(state).cf
+#  define FLAG_PF AFlags(state).pf
+#  define FLAG_AF AFlags(state).af
+#  define FLAG_ZF AFlags(state).zf
+#  define FLAG_SF AFlags(state).sf
+#  define FLAG_OF AFlags(state).of
+#else
+#  define FLAG_CF state.aflag.cf
+#  define FLAG_PF state.aflag.pf
+#  define FLAG_AF state.aflag.af
+#  define FLAG_ZF state.aflag.zf
+#  define FLAG_SF state.aflag.sf
+#  define FLAG_OF state.aflag.of
+#endif  // REMILL_X86_LAZY_FLAGS
+
 #define FLAG_DF state.aflag.df
 
 #define X87_ST0 state.st.elems[0].val
@@ -132,9 +146,21 @@ State __remill_state;
 #define REG_GS_BASE state.addr.gs_base.aword
 #define REG_CS_BASE IF_32BIT_ELSE(state.addr.cs_base.aword, 0)
 
-#define HYPER_CALL state.hyper_call
+#if REMILL_X86_LAZY_FLAGS
+#  define HYPER_CALL (MaterializeAFlags(state), state.hyper_call)
+#  define __remill_sync_hyper_call(state, mem, call) \
+    __remill_sync_hyper_call((MaterializeAFlags(state), state), mem, call)
+#else
+#  define HYPER_CALL state.hyper_call
+#endif  // REMILL_X86_LAZY_FLAGS
+
 #define INTERRUPT_VECTOR state.hyper_call_vector
 
+// clang-format off
+#include "lib/Arch/X86/Semantics/FLAGS.cpp"
+
+// clang-format on
+
 namespace {
 
 // Takes the place of an unsupported instruction.
@@ -201,8 +227,6 @@ DEF_HELPER(SquareRoot32, float32_t src_float)->float32_t {
 }  // namespace
 
 // clang-format off
-#include "lib/Arch/X86/Semantics/FLAGS.cpp"
-
 #include "lib/Arch/X86/Semantics/AVX.cpp"
 #include "lib/Arch/X86/Semantics/BINARY.cpp"
 #include "lib/Arch/X86/Semantics/BITBYTE.cpp"
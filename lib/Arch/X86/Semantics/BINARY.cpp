@@ -29,8 +29,12 @@ ALWAYS_INLINE static void WriteFlagsIncDec(State &state, T lhs, T rhs, T res) {
 
 template <typename Tag, typename T>
 ALWAYS_INLINE static void WriteFlagsAddSub(State &state, T lhs, T rhs, T res) {
+#if REMILL_X86_LAZY_FLAGS
+  RecordFlagsAddSub<Tag>(state, lhs, rhs, res);
+#else
   FLAG_CF = Carry<Tag>::Flag(lhs, rhs, res);
   WriteFlagsIncDec<Tag>(state, lhs, rhs, res);
+#endif  // REMILL_X86_LAZY_FLAGS
 }
 
 template <typename D, typename S1, typename S2>
@@ -96,6 +100,28 @@ DEF_ISEL_RnW_Rn_Rn(ADD_GPRv_GPRv_03, ADD);
 DEF_ISEL(ADD_AL_IMMb) = ADD<R8W, R8, I8>;
 DEF_ISEL_RnW_Rn_In(ADD_OrAX_IMMz, ADD);
 
+namespace {
+
+// `LOCK`-prefixed variants do the read-modify-write with one atomic intrinsic,
+// and compute the flags from the old value in memory.
+template <typename D, typename S1, typename S2>
+DEF_SEM(ADD_LOCK, D dst, S1 src1, S2 src2) {
+  auto rhs = Read(src2);
+  auto lhs = UFetchAdd(dst, rhs);
+  auto sum = UAdd(lhs, rhs);
+  WriteFlagsAddSub<tag_add>(state, lhs, rhs, sum);
+  return memory;
+}
+
+}  // namespace
+
+DEF_ISEL(ADD_LOCK_MEMb_IMMb_80r0) = ADD_LOCK<M8W, M8, I8>;
+DEF_ISEL_MnW_Mn_In(ADD_LOCK_MEMv_IMMz, ADD_LOCK);
+DEF_ISEL(ADD_LOCK_MEMb_IMMb_82r0) = ADD_LOCK<M8W, M8, I8>;
+DEF_ISEL_MnW_Mn_In(ADD_LOCK_MEMv_IMMb, ADD_LOCK);
+DEF_ISEL(ADD_LOCK_MEMb_GPR8) = ADD_LOCK<M8W, M8, R8>;
+DEF_ISEL_MnW_Mn_Rn(ADD_LOCK_MEMv_GPRv, ADD_LOCK);
+
 DEF_ISEL(ADDPS_XMMps_MEMps) = ADDPS<V128W, V128, MV128>;
 DEF_ISEL(ADDPS_XMMps_XMMps) = ADDPS<V128W, V128, V128>;
 IF_AVX(DEF_ISEL(VADDPS_XMMdq_XMMdq_MEMdq) = ADDPS<VV128W, VV128, MV128>;)
@@ -185,6 +211,26 @@ DEF_ISEL_RnW_Rn_Mn(SUB_GPRv_MEMv, SUB);
 DEF_ISEL(SUB_AL_IMMb) = SUB<R8W, R8, I8>;
 DEF_ISEL_RnW_Rn_In(SUB_OrAX_IMMz, SUB);
 
+namespace {
+
+template <typename D, typename S1, typename S2>
+DEF_SEM(SUB_LOCK, D dst, S1 src1, S2 src2) {
+  auto rhs = Read(src2);
+  auto lhs = UFetchSub(dst, rhs);
+  auto sum = USub(lhs, rhs);
+  WriteFlagsAddSub<tag_sub>(state, lhs, rhs, sum);
+  return memory;
+}
+
+}  // namespace
+
+DEF_ISEL(SUB_LOCK_MEMb_IMMb_80r5) = SUB_LOCK<M8W, M8, I8>;
+DEF_ISEL_MnW_Mn_In(SUB_LOCK_MEMv_IMMz, SUB_LOCK);
+DEF_ISEL(SUB_LOCK_MEMb_IMMb_82r5) = SUB_LOCK<M8W, M8, I8>;
+DEF_ISEL_MnW_Mn_In(SUB_LOCK_MEMv_IMMb, SUB_LOCK);
+DEF_ISEL(SUB_LOCK_MEMb_GPR8) = SUB_LOCK<M8W, M8, R8>;
+DEF_ISEL_MnW_Mn_Rn(SUB_LOCK_MEMv_GPRv, SUB_LOCK);
+
 DEF_ISEL(SUBPS_XMMps_MEMps) = SUBPS<V128W, V128, MV128>;
 DEF_ISEL(SUBPS_XMMps_XMMps) = SUBPS<V128W, V128, V128>;
 IF_AVX(DEF_ISEL(VSUBPS_XMMdq_XMMdq_MEMdq) = SUBPS<VV128W, VV128, MV128>;)
@@ -641,6 +687,50 @@ DEF_ISEL_RnW_Rn(NEG_GPRv, NEG);
 
 namespace {
 
+template <typename D, typename S1>
+DEF_SEM(INC_LOCK, D dst, S1 src) {
+  auto_t(S1) rhs = 1;
+  auto lhs = UFetchAdd(dst, rhs);
+  auto sum = UAdd(lhs, rhs);
+  WriteFlagsIncDec<tag_add>(state, lhs, rhs, sum);
+  return memory;
+}
+
+template <typename D, typename S1>
+DEF_SEM(DEC_LOCK, D dst, S1 src) {
+  auto_t(S1) rhs = 1;
+  auto lhs = UFetchSub(dst, rhs);
+  auto sum = USub(lhs, rhs);
+  WriteFlagsIncDec<tag_sub>(state, lhs, rhs, sum);
+  return memory;
+}
+
+// There is no atomic negation intrinsic, so retry a compare-exchange until
+// it negates the value that is in memory.
+template <typename D, typename S1>
+DEF_SEM(NEG_LOCK, D dst, S1 src) {
+  auto_t(S1) lhs = 0;
+  auto rhs = Read(src);
+  while (!UCmpXchg(dst, rhs, UNeg(rhs))) {
+    // `rhs` now holds the value that is in memory.
+  }
+  WriteFlagsAddSub<tag_sub>(state, lhs, rhs, UNeg(rhs));
+  return memory;
+}
+
+}  // namespace
+
+DEF_ISEL(INC_LOCK_MEMb) = INC_LOCK<M8W, M8>;
+DEF_ISEL_MnW_Mn(INC_LOCK_MEMv, INC_LOCK);
+
+DEF_ISEL(DEC_LOCK_MEMb) = DEC_LOCK<M8W, M8>;
+DEF_ISEL_MnW_Mn(DEC_LOCK_MEMv, DEC_LOCK);
+
+DEF_ISEL(NEG_LOCK_MEMb) = NEG_LOCK<M8W, M8>;
+DEF_ISEL_MnW_Mn(NEG_LOCK_MEMv, NEG_LOCK);
+
+namespace {
+
 template <typename TagT, typename T>
 ALWAYS_INLINE static bool CarryFlag(T a, T b, T ab, T c, T abc) {
   static_assert(std::is_unsigned<T>::value,
@@ -713,3 +803,47 @@ DEF_ISEL_RnW_Rn_Mn(ADC_GPRv_MEMv, ADC);
 DEF_ISEL_RnW_Rn_Rn(ADC_GPRv_GPRv_13, ADC);
 DEF_ISEL(ADC_AL_IMMb) = ADC<R8W, R8, I8>;
 DEF_ISEL_RnW_Rn_In(ADC_OrAX_IMMz, ADC);
+
+namespace {
+
+// Adding `src2 + CF` atomically leaves the same value in memory as adding in
+// two steps. The flags are still computed in two steps.
+template <typename D, typename S1, typename S2>
+DEF_SEM(ADC_LOCK, D dst, S1 src1, S2 src2) {
+  auto rhs = Read(src2);
+  auto carry = ZExtTo<S1>(Unsigned(Read(FLAG_CF)));
+  auto lhs = UFetchAdd(dst, UAdd(rhs, carry));
+  auto sum = UAdd(lhs, rhs);
+  auto res = UAdd(sum, carry);
+  Write(FLAG_CF, CarryFlag<tag_add>(lhs, rhs, sum, carry, res));
+  WriteFlagsIncDec<tag_add>(state, lhs, rhs, res);
+  return memory;
+}
+
+template <typename D, typename S1, typename S2>
+DEF_SEM(SBB_LOCK, D dst, S1 src1, S2 src2) {
+  auto rhs = Read(src2);
+  auto borrow = ZExtTo<S1>(Unsigned(Read(FLAG_CF)));
+  auto lhs = UFetchSub(dst, UAdd(rhs, borrow));
+  auto sum = USub(lhs, rhs);
+  auto res = USub(sum, borrow);
+  Write(FLAG_CF, CarryFlag<tag_sub>(lhs, rhs, sum, borrow, res));
+  WriteFlagsIncDec<tag_sub>(state, lhs, rhs, res);
+  return memory;
+}
+
+}  // namespace
+
+DEF_ISEL(ADC_LOCK_MEMb_IMMb_80r2) = ADC_LOCK<M8W, M8, I8>;
+DEF_ISEL_MnW_Mn_In(ADC_LOCK_MEMv_IMMz, ADC_LOCK);
+DEF_ISEL(ADC_LOCK_MEMb_IMMb_82r2) = ADC_LOCK<M8W, M8, I8>;
+DEF_ISEL_MnW_Mn_In(ADC_LOCK_MEMv_IMMb, ADC_LOCK);
+DEF_ISEL(ADC_LOCK_MEMb_GPR8) = ADC_LOCK<M8W, M8, R8>;
+DEF_ISEL_MnW_Mn_Rn(ADC_LOCK_MEMv_GPRv, ADC_LOCK);
+
+DEF_ISEL(SBB_LOCK_MEMb_IMMb_80r3) = SBB_LOCK<M8W, M8, I8>;
+DEF_ISEL_MnW_Mn_In(SBB_LOCK_MEMv_IMMz, SBB_LOCK);
+DEF_ISEL(SBB_LOCK_MEMb_IMMb_82r3) = SBB_LOCK<M8W, M8, I8>;
+DEF_ISEL_MnW_Mn_In(SBB_LOCK_MEMv_IMMb, SBB_LOCK);
+DEF_ISEL(SBB_LOCK_MEMb_GPR8) = SBB_LOCK<M8W, M8, R8>;
+DEF_ISEL_MnW_Mn_Rn(SBB_LOCK_MEMv_GPRv, SBB_LOCK);
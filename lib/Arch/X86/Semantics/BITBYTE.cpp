@@ -248,6 +248,41 @@ DEF_SEM(BTCmem, D dst, S1 src1, S2 src2) {
   return memory;
 }
 
+// `LOCK`-prefixed variants update the operand-sized element that holds the bit
+// with one atomic intrinsic.
+template <typename D, typename S1, typename S2>
+DEF_SEM(BTS_LOCK, D dst, S1 src1, S2 src2) {
+  auto bit = ZExtTo<S1>(Read(src2));
+  auto bit_mask = UShl(Literal<S1>(1), URem(bit, BitSizeOf(src1)));
+  auto index = UDiv(bit, BitSizeOf(src1));
+  auto val = UFetchOr(GetElementPtr(dst, index), bit_mask);
+  Write(FLAG_CF, UCmpNeq(UAnd(val, bit_mask), Literal<S1>(0)));
+  _BTClearUndefFlags();
+  return memory;
+}
+
+template <typename D, typename S1, typename S2>
+DEF_SEM(BTR_LOCK, D dst, S1 src1, S2 src2) {
+  auto bit = ZExtTo<S1>(Read(src2));
+  auto bit_mask = UShl(Literal<S1>(1), URem(bit, BitSizeOf(src1)));
+  auto index = UDiv(bit, BitSizeOf(src1));
+  auto val = UFetchAnd(GetElementPtr(dst, index), UNot(bit_mask));
+  Write(FLAG_CF, UCmpNeq(UAnd(val, bit_mask), Literal<S1>(0)));
+  _BTClearUndefFlags();
+  return memory;
+}
+
+template <typename D, typename S1, typename S2>
+DEF_SEM(BTC_LOCK, D dst, S1 src1, S2 src2) {
+  auto bit = ZExtTo<S1>(Read(src2));
+  auto bit_mask = UShl(Literal<S1>(1), URem(bit, BitSizeOf(src1)));
+  auto index = UDiv(bit, BitSizeOf(src1));
+  auto val = UFetchXor(GetElementPtr(dst, index), bit_mask);
+  Write(FLAG_CF, UCmpNeq(UAnd(val, bit_mask), Literal<S1>(0)));
+  _BTClearUndefFlags();
+  return memory;
+}
+
 #undef _BTClearUndefFlags
 
 }  // namespace
@@ -272,6 +307,15 @@ DEF_ISEL_RnW_Rn_In(BTC_GPRv_IMMb, BTCreg);
 DEF_ISEL_MnW_Mn_Rn(BTC_MEMv_GPRv, BTCmem);
 DEF_ISEL_RnW_Rn_Rn(BTC_GPRv_GPRv, BTCreg);
 
+DEF_ISEL_MnW_Mn_In(BTS_LOCK_MEMv_IMMb, BTS_LOCK);
+DEF_ISEL_MnW_Mn_Rn(BTS_LOCK_MEMv_GPRv, BTS_LOCK);
+
+DEF_ISEL_MnW_Mn_In(BTR_LOCK_MEMv_IMMb, BTR_LOCK);
+DEF_ISEL_MnW_Mn_Rn(BTR_LOCK_MEMv_GPRv, BTR_LOCK);
+
+DEF_ISEL_MnW_Mn_In(BTC_LOCK_MEMv_IMMb, BTC_LOCK);
+DEF_ISEL_MnW_Mn_Rn(BTC_LOCK_MEMv_GPRv, BTC_LOCK);
+
 namespace {
 DEF_SEM(BSWAP_16, R16W dst, R16 src) {
   Write(dst, static_cast<uint16_t>(0));
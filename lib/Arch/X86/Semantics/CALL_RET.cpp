@@ -90,13 +90,13 @@ DEF_SEM(IRETD, IF_32BIT_ELSE(R32W, R64W) pc_dst) {
   Write(pc_dst, new_eip);
   Write(REG_CS.flat, new_cs);
   state.rflag = f;
-  state.aflag.af = f.af;
-  state.aflag.cf = f.cf;
-  state.aflag.df = f.df;
-  state.aflag.of = f.of;
-  state.aflag.pf = f.pf;
-  state.aflag.sf = f.sf;
-  state.aflag.zf = f.zf;
+  FLAG_AF = f.af;
+  FLAG_CF = f.cf;
+  FLAG_DF = f.df;
+  FLAG_OF = f.of;
+  FLAG_PF = f.pf;
+  FLAG_SF = f.sf;
+  FLAG_ZF = f.zf;
   state.hyper_call = AsyncHyperCall::kX86IRet;
   return memory;
 }
@@ -114,13 +114,13 @@ DEF_SEM(IRETQ, IF_32BIT_ELSE(R32W, R64W) pc_dst) {
   Write(pc_dst, new_rip);
   Write(REG_CS.flat, new_cs);
   state.rflag = f;
-  state.aflag.af = f.af;
-  state.aflag.cf = f.cf;
-  state.aflag.df = f.df;
-  state.aflag.of = f.of;
-  state.aflag.pf = f.pf;
-  state.aflag.sf = f.sf;
-  state.aflag.zf = f.zf;
+  FLAG_AF = f.af;
+  FLAG_CF = f.cf;
+  FLAG_DF = f.df;
+  FLAG_OF = f.of;
+  FLAG_PF = f.pf;
+  FLAG_SF = f.sf;
+  FLAG_ZF = f.zf;
   state.hyper_call = AsyncHyperCall::kX86IRet;
 
   // TODO(tathanhdinh): Update the hidden part (segment shadow) of CS,
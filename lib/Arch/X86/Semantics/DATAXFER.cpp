@@ -33,6 +33,19 @@ DEF_SEM(XCHG, D1 dst, S1 dst_val, D2 src, S2 src_val) {
   return memory;
 }
 
+// An `XCHG` with memory is always atomic. There is no atomic swap intrinsic,
+// so retry a compare-exchange until it replaces the value that is in memory.
+template <typename D1, typename S1, typename D2, typename S2>
+DEF_SEM(XCHG_MEM, D1 dst, S1 dst_val, D2 src, S2 src_val) {
+  auto old_dst = Read(dst_val);
+  auto old_src = Read(src_val);
+  while (!UCmpXchg(dst, old_dst, old_src)) {
+    // `old_dst` now holds the value that is in memory.
+  }
+  WriteZExt(src, old_dst);
+  return memory;
+}
+
 template <typename D, typename S>
 DEF_SEM(MOVBE16, D dst, const S src) {
   WriteZExt(dst, __builtin_bswap16(Read(src)));
@@ -217,9 +230,9 @@ DEF_ISEL_RnW_In(MOV_GPRv_IMMv, MOV);
 DEF_ISEL(MOVNTI_MEMd_GPR32) = MOV<M32W, R32>;
 IF_64BIT(DEF_ISEL(MOVNTI_MEMq_GPR64) = MOV<M64W, R64>;)
 
-DEF_ISEL(XCHG_MEMb_GPR8) = XCHG<M8W, M8, R8W, R8>;
+DEF_ISEL(XCHG_MEMb_GPR8) = XCHG_MEM<M8W, M8, R8W, R8>;
 DEF_ISEL(XCHG_GPR8_GPR8) = XCHG<R8W, R8, R8W, R8>;
-DEF_ISEL_MnW_Mn_RnW_Rn(XCHG_MEMv_GPRv, XCHG);
+DEF_ISEL_MnW_Mn_RnW_Rn(XCHG_MEMv_GPRv, XCHG_MEM);
 DEF_ISEL_RnW_Rn_RnW_Rn(XCHG_GPRv_GPRv, XCHG);
 DEF_ISEL_RnW_Rn_RnW_Rn(XCHG_GPRv_OrAX, XCHG);
 
@@ -186,21 +186,106 @@ struct Carry<tag_sub> {
   }
 };
 
+#if REMILL_X86_LAZY_FLAGS
+
+// Computes the arithmetic flags of an `add`- or `sub`-like instruction.
+template <typename Tag, typename T>
+ALWAYS_INLINE static void ComputeFlagsAddSub(ArithFlags &aflag,
+                                             const LazyArithFlags &lazy) {
+  const auto lhs = static_cast<T>(lazy.lhs);
+  const auto rhs = static_cast<T>(lazy.rhs);
+  const auto res = static_cast<T>(lazy.res);
+  aflag.cf = Carry<Tag>::Flag(lhs, rhs, res);
+  aflag.pf = ParityFlag(res);
+  aflag.af = AuxCarryFlag(lhs, rhs, res);
+  aflag.zf = ZeroFlag(res, lhs, rhs);
+  aflag.sf = SignFlag(res, lhs, rhs);
+  aflag.of = Overflow<Tag>::Flag(lhs, rhs, res);
+}
+
+// Record the operands and result of an `add`- or `sub`-like instruction. The
+// flags themselves are only computed if something reads them.
+template <typename Tag, typename T>
+ALWAYS_INLINE static void RecordFlagsAddSub(State &state, T lhs, T rhs, T res) {
+  static_assert(sizeof(T) <= 8, "Invalid operand size for lazy flags.");
+  const uint8_t log2_size = sizeof(T) == 1   ? 0
+                            : sizeof(T) == 2 ? 1
+                            : sizeof(T) == 4 ? 2
+                                             : 3;
+  auto &lazy = state.lazy_aflag;
+  lazy.kind = static_cast<uint8_t>(
+      (std::is_same<Tag, tag_add>::value ? kLazyArithFlagsAdd8
+                                         : kLazyArithFlagsSub8) +
+      log2_size);
+  lazy.lhs = lhs;
+  lazy.rhs = rhs;
+  lazy.res = res;
+}
+
+// Compute any pending arithmetic flags and store them into `state.aflag`.
+ALWAYS_INLINE static void MaterializeAFlags(State &state) {
+  auto &lazy = state.lazy_aflag;
+  switch (lazy.kind) {
+    case kLazyArithFlagsNone: return;
+    case kLazyArithFlagsAdd8:
+      ComputeFlagsAddSub<tag_add, uint8_t>(state.aflag, lazy);
+      break;
+    case kLazyArithFlagsAdd16:
+      ComputeFlagsAddSub<tag_add, uint16_t>(state.aflag, lazy);
+      break;
+    case kLazyArithFlagsAdd32:
+      ComputeFlagsAddSub<tag_add, uint32_t>(state.aflag, lazy);
+      break;
+    case kLazyArithFlagsAdd64:
+      ComputeFlagsAddSub<tag_add, uint64_t>(state.aflag, lazy);
+      break;
+    case kLazyArithFlagsSub8:
+      ComputeFlagsAddSub<tag_sub, uint8_t>(state.aflag, lazy);
+      break;
+    case kLazyArithFlagsSub16:
+      ComputeFlagsAddSub<tag_sub, uint16_t>(state.aflag, lazy);
+      break;
+    case kLazyArithFlagsSub32:
+      ComputeFlagsAddSub<tag_sub, uint32_t>(state.aflag, lazy);
+      break;
+    case kLazyArithFlagsSub64:
+      ComputeFlagsAddSub<tag_sub, uint64_t>(state.aflag, lazy);
+      break;
+  }
+  lazy.kind = kLazyArithFlagsNone;
+}
+
+// Returns the arithmetic flags, up-to-date so that they can be read or
+// written.
+ALWAYS_INLINE static ArithFlags &AFlags(State &state) {
+  MaterializeAFlags(state);
+  return state.aflag;
+}
+
+#else
+
+ALWAYS_INLINE static ArithFlags &AFlags(State &state) {
+  return state.aflag;
+}
+
+#endif  // REMILL_X86_LAZY_FLAGS
+
 }  // namespace
 
 #define UndefFlag(name) \
   do { \
-    state.aflag.name = __remill_undefined_8(); \
+    AFlags(state).name = __remill_undefined_8(); \
   } while (false)
 
 #define ClearArithFlags() \
   do { \
-    state.aflag.cf = __remill_undefined_8(); \
-    state.aflag.pf = __remill_undefined_8(); \
-    state.aflag.af = __remill_undefined_8(); \
-    state.aflag.zf = __remill_undefined_8(); \
-    state.aflag.sf = __remill_undefined_8(); \
-    state.aflag.of = __remill_undefined_8(); \
+    auto &aflag = AFlags(state); \
+    aflag.cf = __remill_undefined_8(); \
+    aflag.pf = __remill_undefined_8(); \
+    aflag.af = __remill_undefined_8(); \
+    aflag.zf = __remill_undefined_8(); \
+    aflag.sf = __remill_undefined_8(); \
+    aflag.of = __remill_undefined_8(); \
   } while (false)
 
 
@@ -20,12 +20,12 @@ namespace {
 
 template <typename T>
 ALWAYS_INLINE void SetFlagsLogical(State &state, T lhs, T rhs, T res) {
-  state.aflag.cf = false;
-  state.aflag.pf = ParityFlag(res);
-  state.aflag.zf = ZeroFlag(res, lhs, rhs);
-  state.aflag.sf = SignFlag(res, lhs, rhs);
-  state.aflag.of = false;
-  state.aflag.af = false;  // Undefined, but ends up being `0`.
+  FLAG_CF = false;
+  FLAG_PF = ParityFlag(res);
+  FLAG_ZF = ZeroFlag(res, lhs, rhs);
+  FLAG_SF = SignFlag(res, lhs, rhs);
+  FLAG_OF = false;
+  FLAG_AF = false;  // Undefined, but ends up being `0`.
 }
 
 template <typename D, typename S1, typename S2>
@@ -140,6 +140,68 @@ DEF_ISEL(NOT_GPR8) = NOT<R8W, R8>;
 DEF_ISEL_MnW_Mn(NOT_MEMv, NOT);
 DEF_ISEL_RnW_Rn(NOT_GPRv, NOT);
 
+namespace {
+
+// Like in BINARY.cpp, the `LOCK`-prefixed variants use one atomic intrinsic and
+// compute the flags from the old value.
+template <typename D, typename S1, typename S2>
+DEF_SEM(AND_LOCK, D dst, S1 src1, S2 src2) {
+  auto rhs = Read(src2);
+  auto lhs = UFetchAnd(dst, rhs);
+  SetFlagsLogical(state, lhs, rhs, UAnd(lhs, rhs));
+  return memory;
+}
+
+template <typename D, typename S1, typename S2>
+DEF_SEM(OR_LOCK, D dst, S1 src1, S2 src2) {
+  auto rhs = Read(src2);
+  auto lhs = UFetchOr(dst, rhs);
+  SetFlagsLogical(state, lhs, rhs, UOr(lhs, rhs));
+  UndefFlag(af);
+  return memory;
+}
+
+template <typename D, typename S1, typename S2>
+DEF_SEM(XOR_LOCK, D dst, S1 src1, S2 src2) {
+  auto rhs = Read(src2);
+  auto lhs = UFetchXor(dst, rhs);
+  SetFlagsLogical(state, lhs, rhs, UXor(lhs, rhs));
+  UndefFlag(af);
+  return memory;
+}
+
+template <typename D, typename S1>
+DEF_SEM(NOT_LOCK, D dst, S1 src1) {
+  UFetchXor(dst, UNot(Literal<S1>(0)));
+  return memory;
+}
+
+}  // namespace
+
+DEF_ISEL(AND_LOCK_MEMb_IMMb_80r4) = AND_LOCK<M8W, M8, I8>;
+DEF_ISEL_MnW_Mn_In(AND_LOCK_MEMv_IMMz, AND_LOCK);
+DEF_ISEL(AND_LOCK_MEMb_IMMb_82r4) = AND_LOCK<M8W, M8, I8>;
+DEF_ISEL_MnW_Mn_In(AND_LOCK_MEMv_IMMb, AND_LOCK);
+DEF_ISEL(AND_LOCK_MEMb_GPR8) = AND_LOCK<M8W, M8, R8>;
+DEF_ISEL_MnW_Mn_Rn(AND_LOCK_MEMv_GPRv, AND_LOCK);
+
+DEF_ISEL(OR_LOCK_MEMb_IMMb_80r1) = OR_LOCK<M8W, M8, I8>;
+DEF_ISEL_MnW_Mn_In(OR_LOCK_MEMv_IMMz, OR_LOCK);
+DEF_ISEL(OR_LOCK_MEMb_IMMb_82r1) = OR_LOCK<M8W, M8, I8>;
+DEF_ISEL_MnW_Mn_In(OR_LOCK_MEMv_IMMb, OR_LOCK);
+DEF_ISEL(OR_LOCK_MEMb_GPR8) = OR_LOCK<M8W, M8, R8>;
+DEF_ISEL_MnW_Mn_Rn(OR_LOCK_MEMv_GPRv, OR_LOCK);
+
+DEF_ISEL(XOR_LOCK_MEMb_IMMb_80r6) = XOR_LOCK<M8W, M8, I8>;
+DEF_ISEL_MnW_Mn_In(XOR_LOCK_MEMv_IMMz, XOR_LOCK);
+DEF_ISEL(XOR_LOCK_MEMb_IMMb_82r6) = XOR_LOCK<M8W, M8, I8>;
+DEF_ISEL_MnW_Mn_In(XOR_LOCK_MEMv_IMMb, XOR_LOCK);
+DEF_ISEL(XOR_LOCK_MEMb_GPR8) = XOR_LOCK<M8W, M8, R8>;
+DEF_ISEL_MnW_Mn_Rn(XOR_LOCK_MEMv_GPRv, XOR_LOCK);
+
+DEF_ISEL(NOT_LOCK_MEMb) = NOT_LOCK<M8W, M8>;
+DEF_ISEL_MnW_Mn(NOT_LOCK_MEMv, NOT_LOCK);
+
 DEF_ISEL(TEST_MEMb_IMMb_F6r0) = TEST<M8, I8>;
 DEF_ISEL(TEST_MEMb_IMMb_F6r1) = TEST<M8, I8>;
 DEF_ISEL(TEST_GPR8_IMMb_F6r0) = TEST<R8, I8>;
@@ -19,22 +19,22 @@
 namespace {
 
 static void SerializeFlags(State &state) {
-  state.rflag.cf = state.aflag.cf;
+  state.rflag.cf = FLAG_CF;
 
   //state.rflag.must_be_1 = 1;
-  state.rflag.pf = state.aflag.pf;
+  state.rflag.pf = FLAG_PF;
 
   //state.rflag.must_be_0a = 0;
-  state.rflag.af = state.aflag.af;
+  state.rflag.af = FLAG_AF;
 
   //state.rflag.must_be_0b = 0;
-  state.rflag.zf = state.aflag.zf;
-  state.rflag.sf = state.aflag.sf;
+  state.rflag.zf = FLAG_ZF;
+  state.rflag.sf = FLAG_SF;
 
   //state.rflag.tf = 0;  // Trap flag (not single-stepping).
   //state.rflag._if = 1;  // Interrupts are enabled (assumes user mode).
-  state.rflag.df = state.aflag.df;
-  state.rflag.of = state.aflag.of;
+  state.rflag.df = FLAG_DF;
+  state.rflag.of = FLAG_OF;
 
   //state.rflag.iopl = 0;  // In user-mode. TODO(pag): Configurable?
   //state.rflag.nt = 0;  // Not running in a nested task (interrupted interrupt).
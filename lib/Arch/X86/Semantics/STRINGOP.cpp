@@ -164,6 +164,95 @@ IF_64BIT(MAKE_CMPS(CMPSQ, uint64_t))
 
 #undef MAKE_MOVS
 
+namespace {
+
+// Returns the number of bytes in `count` elements of `elem_size` bytes that
+// start at `addr`, or zero if there are no elements, or if those bytes wrap
+// around the end of the address space. The bytes of a non-zero result can be
+// moved with one bulk memory intrinsic.
+ALWAYS_INLINE static addr_t BulkSize(addr_t count, addr_t elem_size,
+                                     addr_t addr) {
+  if (!count || count > (~static_cast<addr_t>(0) / elem_size)) {
+    return 0;
+  }
+  const addr_t num_bytes = count * elem_size;
+  if ((addr + num_bytes) < addr) {
+    return 0;
+  }
+  return num_bytes;
+}
+
+// Returns `true` if every byte of `val` is the same, and so `val` can be
+// stored repeatedly with one `__remill_memset`.
+template <typename T>
+ALWAYS_INLINE static bool IsByteSplat(T val) {
+  constexpr T kOnes =
+      static_cast<T>(static_cast<T>(~static_cast<T>(0)) / static_cast<T>(0xff));
+  return val == static_cast<T>(static_cast<uint8_t>(val) * kOnes);
+}
+
+}  // namespace
+
+// NOTE: A forward `REP MOVS` is one `memmove`, unless the destination starts
+//       inside of the source, where element-wise copying repeats earlier
+//       elements. A fault part way through a bulk copy doesn't leave `XCX`,
+//       `XSI`, and `XDI` at the faulting element.
+#define MAKE_REP_MOVS(base, type) \
+  namespace { \
+  DEF_SEM(Do##REP_##base) { \
+    auto count_reg = Read(REG_XCX); \
+    const addr_t src_addr = Read(REG_XSI); \
+    const addr_t dst_addr = Read(REG_XDI); \
+    const addr_t src = UAdd(src_addr, REG_DS_BASE); \
+    const addr_t dst = UAdd(dst_addr, REG_ES_BASE); \
+    const addr_t num_bytes = BulkSize(count_reg, sizeof(type), src); \
+    const bool dst_ok = BulkSize(count_reg, sizeof(type), dst) && \
+                        (UCmpLte(dst, src) || \
+                         UCmpGte(USub(dst, src), num_bytes)); \
+    if (BNot(FLAG_DF) && num_bytes && dst_ok) { \
+      memory = __remill_memcpy(memory, dst, src, num_bytes); \
+      Write(REG_XSI, UAdd(src_addr, num_bytes)); \
+      Write(REG_XDI, UAdd(dst_addr, num_bytes)); \
+      Write(REG_XCX, static_cast<addr_t>(0)); \
+      return memory; \
+    } \
+    while (UCmpNeq(count_reg, 0)) { \
+      memory = Do##base(memory, state); \
+      count_reg = USub(count_reg, 1); \
+      Write(REG_XCX, count_reg); \
+    } \
+    return memory; \
+  } \
+  } \
+  DEF_ISEL(REP_##base) = Do##REP_##base;
+
+// A forward `REP STOS` of a value whose bytes are all the same is a `memset`.
+// Anything else goes one element at a time.
+#define MAKE_REP_STOS(base, type, read_sel) \
+  namespace { \
+  DEF_SEM(Do##REP_##base) { \
+    auto count_reg = Read(REG_XCX); \
+    const addr_t dst_addr = Read(REG_XDI); \
+    const type val = Read(state.gpr.rax.read_sel); \
+    const addr_t dst = UAdd(dst_addr, REG_ES_BASE); \
+    const addr_t num_bytes = BulkSize(count_reg, sizeof(type), dst); \
+    if (BNot(FLAG_DF) && num_bytes && IsByteSplat(val)) { \
+      memory = __remill_memset(memory, dst, static_cast<uint8_t>(val), \
+                               num_bytes); \
+      Write(REG_XDI, UAdd(dst_addr, num_bytes)); \
+      Write(REG_XCX, static_cast<addr_t>(0)); \
+      return memory; \
+    } \
+    while (UCmpNeq(count_reg, 0)) { \
+      memory = Do##base(memory, state); \
+      count_reg = USub(count_reg, 1); \
+      Write(REG_XCX, count_reg); \
+    } \
+    return memory; \
+  } \
+  } \
+  DEF_ISEL(REP_##base) = Do##REP_##base;
+
 #define MAKE_REP(base) \
   namespace { \
   DEF_SEM(Do##REP_##base) { \
@@ -183,16 +272,18 @@ MAKE_REP(LODSW)
 MAKE_REP(LODSD)
 IF_64BIT(MAKE_REP(LODSQ))
 
-MAKE_REP(MOVSB)
-MAKE_REP(MOVSW)
-MAKE_REP(MOVSD)
-IF_64BIT(MAKE_REP(MOVSQ))
+MAKE_REP_MOVS(MOVSB, uint8_t)
+MAKE_REP_MOVS(MOVSW, uint16_t)
+MAKE_REP_MOVS(MOVSD, uint32_t)
+IF_64BIT(MAKE_REP_MOVS(MOVSQ, uint64_t))
 
-MAKE_REP(STOSB)
-MAKE_REP(STOSW)
-MAKE_REP(STOSD)
-IF_64BIT(MAKE_REP(STOSQ))
+MAKE_REP_STOS(STOSB, uint8_t, byte.low)
+MAKE_REP_STOS(STOSW, uint16_t, word)
+MAKE_REP_STOS(STOSD, uint32_t, dword)
+IF_64BIT(MAKE_REP_STOS(STOSQ, uint64_t, qword))
 #undef MAKE_REP
+#undef MAKE_REP_MOVS
+#undef MAKE_REP_STOS
 
 #define MAKE_REPE(base) \
   namespace { \
@@ -0,0 +1,338 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <glog/logging.h>
+#include <llvm/ADT/APInt.h>
+#include <llvm/ADT/BitVector.h>
+#include <llvm/IR/BasicBlock.h>
+#include <llvm/IR/CFG.h>
+#include <llvm/IR/DataLayout.h>
+#include <llvm/IR/Function.h>
+#include <llvm/IR/Instructions.h>
+#include <llvm/IR/IntrinsicInst.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Transforms/Utils/Local.h>
+
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "remill/Arch/Arch.h"
+#include "remill/BC/ABI.h"
+#include "remill/BC/Optimizer.h"
+#include "remill/BC/Util.h"
+
+namespace remill {
+namespace {
+
+// How an instruction affects the liveness of the flags.
+struct FlagEffect {
+
+  // Flags read by the instruction.
+  llvm::BitVector uses;
+
+  // The flag completely overwritten by a store, or `-1`.
+  int def{-1};
+};
+
+class DeadFlagEliminator {
+ public:
+  DeadFlagEliminator(const Arch *arch_, llvm::Function *func_)
+      : arch(arch_),
+        func(func_),
+        dl(func->getParent()->getDataLayout()),
+        state_ptr(NthArgument(func, kStatePointerArgNum)) {}
+
+  unsigned Run(void);
+
+ private:
+  // Assign an index to every flag register.
+  void FindFlags(void);
+
+  // Find all uses of the `State` pointer. Returns `false` if the pointer is
+  // used in a way that we can't reason about, e.g. stored to memory, or
+  // indexed with a non-constant offset.
+  bool FindAccesses(void);
+
+  // Record a load or store of `size` bytes at `offset` in the `State`
+  // structure.
+  void AddAccess(llvm::Instruction *inst, uint64_t offset, uint64_t size,
+                 bool is_store);
+
+  // Mark `inst` as possibly reading every flag.
+  void AddUseOfAllFlags(llvm::Instruction *inst);
+
+  // Update `live` to be the flags live before `inst`. Returns `true` if `inst`
+  // is a store to a flag that is not live.
+  bool Transfer(llvm::Instruction &inst, llvm::BitVector &live) const;
+
+  // Remove the computation of the value of a deleted flag store.
+  static void DeleteDeadComputation(llvm::Value *val);
+
+  const Arch *const arch;
+  llvm::Function *const func;
+  const llvm::DataLayout &dl;
+  llvm::Value *const state_ptr;
+
+  // Flag registers, indexed by their offsets in `State`.
+  std::unordered_map<uint64_t, std::pair<const Register *, unsigned>> flags;
+
+  // Instructions that read or write flags.
+  std::unordered_map<llvm::Instruction *, FlagEffect> effects;
+};
+
+void DeadFlagEliminator::FindFlags(void) {
+  arch->ForEachRegister([this](const Register *reg) {
+    if (arch->IsFlagRegister(reg)) {
+      const auto index = static_cast<unsigned>(flags.size());
+      flags.emplace(reg->offset, std::make_pair(reg, index));
+    }
+  });
+}
+
+bool DeadFlagEliminator::FindAccesses(void) {
+  std::vector<std::pair<llvm::Value *, uint64_t>> work_list;
+  work_list.emplace_back(state_ptr, 0u);
+
+  while (!work_list.empty()) {
+    const auto [ptr, offset] = work_list.back();
+    work_list.pop_back();
+
+    for (auto &use : ptr->uses()) {
+      auto user = use.getUser();
+
+      if (auto gep = llvm::dyn_cast<llvm::GetElementPtrInst>(user)) {
+        llvm::APInt gep_offset(dl.getIndexTypeSizeInBits(gep->getType()), 0);
+        if (!gep->accumulateConstantOffset(dl, gep_offset) ||
+            gep_offset.isNegative()) {
+          return false;
+        }
+        work_list.emplace_back(gep, offset + gep_offset.getZExtValue());
+
+      } else if (auto cast = llvm::dyn_cast<llvm::BitCastInst>(user)) {
+        work_list.emplace_back(cast, offset);
+
+      } else if (auto load = llvm::dyn_cast<llvm::LoadInst>(user)) {
+        AddAccess(load, offset, dl.getTypeStoreSize(load->getType()), false);
+
+      } else if (auto store = llvm::dyn_cast<llvm::StoreInst>(user)) {
+        if (store->getValueOperand() == ptr) {
+          return false;
+        }
+        AddAccess(store, offset,
+                  dl.getTypeStoreSize(store->getValueOperand()->getType()),
+                  true);
+
+      } else if (auto call = llvm::dyn_cast<llvm::CallInst>(user)) {
+        AddUseOfAllFlags(call);
+
+      } else {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+void DeadFlagEliminator::AddAccess(llvm::Instruction *inst, uint64_t offset,
+                                   uint64_t size, bool is_store) {
+  if (is_store) {
+    auto flag_it = flags.find(offset);
+    if (flag_it != flags.end() &&
+        llvm::cast<llvm::StoreInst>(inst)->isSimple()) {
+      const auto [reg, index] = flag_it->second;
+      if (reg->size == size) {
+        effects[inst].def = static_cast<int>(index);
+        return;
+      }
+    }
+
+    // Partial or volatile stores to flags neither kill nor read them.
+    return;
+  }
+
+  for (auto i = 0u; i < size; ++i) {
+    if (auto reg = arch->RegisterAtStateOffset(offset + i)) {
+      auto flag_it = flags.find(reg->offset);
+      if (flag_it != flags.end() && flag_it->second.first == reg) {
+        auto &uses = effects[inst].uses;
+        uses.resize(static_cast<unsigned>(flags.size()));
+        uses.set(flag_it->second.second);
+      }
+    }
+  }
+}
+
+void DeadFlagEliminator::AddUseOfAllFlags(llvm::Instruction *inst) {
+  auto &uses = effects[inst].uses;
+  uses.resize(static_cast<unsigned>(flags.size()));
+  uses.set();
+}
+
+bool DeadFlagEliminator::Transfer(llvm::Instruction &inst,
+                                  llvm::BitVector &live) const {
+  auto effect_it = effects.find(&inst);
+  if (effect_it == effects.end()) {
+    return false;
+  }
+
+  const auto &effect = effect_it->second;
+  auto is_dead = false;
+  if (effect.def != -1) {
+    const auto index = static_cast<unsigned>(effect.def);
+    is_dead = !live.test(index);
+    live.reset(index);
+  }
+  if (!effect.uses.empty()) {
+    live |= effect.uses;
+  }
+  return is_dead;
+}
+
+void DeadFlagEliminator::DeleteDeadComputation(llvm::Value *val) {
+  std::vector<llvm::Instruction *> work_list;
+  std::unordered_set<llvm::Instruction *> deleted;
+  if (auto inst = llvm::dyn_cast<llvm::Instruction>(val)) {
+    work_list.push_back(inst);
+  }
+
+  while (!work_list.empty()) {
+    auto inst = work_list.back();
+    work_list.pop_back();
+    if (deleted.count(inst) || !inst->use_empty()) {
+      continue;
+    }
+
+    // The `__remill_flag_computation_*` intrinsics are annotations, and die
+    // with the flag.
+    auto is_dead = llvm::isInstructionTriviallyDead(inst);
+    if (auto call = llvm::dyn_cast<llvm::CallInst>(inst)) {
+      auto callee = call->getCalledFunction();
+      is_dead = is_dead || (callee && callee->getName().find(
+                                          "__remill_flag_computation_") == 0);
+    }
+
+    if (is_dead) {
+      for (auto &op : inst->operands()) {
+        if (auto op_inst = llvm::dyn_cast<llvm::Instruction>(op.get())) {
+          work_list.push_back(op_inst);
+        }
+      }
+      deleted.insert(inst);
+      inst->eraseFromParent();
+    }
+  }
+}
+
+unsigned DeadFlagEliminator::Run(void) {
+  if (func->isDeclaration()) {
+    return 0u;
+  }
+
+  FindFlags();
+  if (flags.empty() || !FindAccesses()) {
+    return 0u;
+  }
+
+  const auto num_flags = static_cast<unsigned>(flags.size());
+
+  // Anything that leaves the function, or that we don't understand, may read
+  // every flag.
+  for (auto &block : *func) {
+    for (auto &inst : block) {
+      if (llvm::isa<llvm::ReturnInst>(inst)) {
+        AddUseOfAllFlags(&inst);
+      } else if (auto call = llvm::dyn_cast<llvm::CallBase>(&inst)) {
+        auto callee = call->getCalledFunction();
+        if (!callee || !callee->isDeclaration() ||
+            (!callee->isIntrinsic() &&
+             callee->getName().find("__remill_") != 0)) {
+          AddUseOfAllFlags(&inst);
+        }
+      }
+    }
+  }
+
+  // Compute the flags live on entry to each block.
+  std::unordered_map<llvm::BasicBlock *, llvm::BitVector> live_in;
+  for (auto &block : *func) {
+    live_in[&block].resize(num_flags);
+  }
+
+  std::vector<llvm::BasicBlock *> work_list;
+  std::unordered_set<llvm::BasicBlock *> in_work_list;
+  for (auto &block : *func) {
+    work_list.push_back(&block);
+    in_work_list.insert(&block);
+  }
+
+  while (!work_list.empty()) {
+    auto block = work_list.back();
+    work_list.pop_back();
+    in_work_list.erase(block);
+
+    llvm::BitVector live(num_flags);
+    for (auto succ : llvm::successors(block)) {
+      live |= live_in[succ];
+    }
+    for (auto &inst : llvm::reverse(*block)) {
+      (void) Transfer(inst, live);
+    }
+
+    if (live != live_in[block]) {
+      live_in[block] = std::move(live);
+      for (auto pred : llvm::predecessors(block)) {
+        if (in_work_list.insert(pred).second) {
+          work_list.push_back(pred);
+        }
+      }
+    }
+  }
+
+  // Find the stores to flags that are overwritten before being read.
+  std::vector<llvm::StoreInst *> dead_stores;
+  for (auto &block : *func) {
+    llvm::BitVector live(num_flags);
+    for (auto succ : llvm::successors(&block)) {
+      live |= live_in[succ];
+    }
+    for (auto &inst : llvm::reverse(block)) {
+      if (Transfer(inst, live)) {
+        dead_stores.push_back(llvm::cast<llvm::StoreInst>(&inst));
+      }
+    }
+  }
+
+  for (auto store : dead_stores) {
+    auto val = store->getValueOperand();
+    store->eraseFromParent();
+    DeleteDeadComputation(val);
+  }
+
+  return static_cast<unsigned>(dead_stores.size());
+}
+
+}  // namespace
+
+// Remove stores to flag registers in `State` that are overwritten before they
+// can be read.
+unsigned EliminateDeadFlagStores(const Arch *arch, llvm::Function *func) {
+  return DeadFlagEliminator(arch, func).Run();
+}
+
+}  // namespace remill
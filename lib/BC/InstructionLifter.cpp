@@ -17,31 +17,6 @@
 #include "InstructionLifter.h"
 
 namespace remill {
-namespace {
-
-// Try to find the function that implements this semantics.
-llvm::Function *GetInstructionFunction(llvm::Module *module,
-                                       std::string_view function) {
-  std::stringstream ss;
-  ss << "ISEL_" << function;
-  auto isel_name = ss.str();
-
-  auto isel = FindGlobaVariable(module, isel_name);
-  if (!isel) {
-    return nullptr;  // Falls back on `UNIMPLEMENTED_INSTRUCTION`.
-  }
-
-  if (!isel->isConstant() || !isel->hasInitializer()) {
-    LOG(FATAL) << "Expected a `constexpr` variable as the function pointer for "
-               << "instruction semantic function " << function << ": "
-               << LLVMThingToString(isel);
-  }
-
-  auto sem = isel->getInitializer()->stripPointerCasts();
-  return llvm::dyn_cast_or_null<llvm::Function>(sem);
-}
-
-}  // namespace
 
 InstructionLifter::Impl::Impl(const Arch *arch_,
                               const IntrinsicTable *intrinsics_)
@@ -54,10 +29,19 @@ InstructionLifter::Impl::Impl(const Arch *arch_,
                                           remill::kMemoryPointerArgNum)
                           ->getType()),
       module(intrinsics->async_hyper_call->getParent()),
-      invalid_instruction(
-          GetInstructionFunction(module, kInvalidInstructionISelName)),
+      isels([this] {
+        llvm::StringMap<llvm::GlobalVariable *> table;
+        for (auto &global : module->globals()) {
+          auto name = global.getName();
+          if (name.consume_front("ISEL_")) {
+            table[name] = &global;
+          }
+        }
+        return table;
+      }()),
+      invalid_instruction(GetInstructionFunction(kInvalidInstructionISelName)),
       unsupported_instruction(
-          GetInstructionFunction(module, kUnsupportedInstructionISelName)) {
+          GetInstructionFunction(kUnsupportedInstructionISelName)) {
 
   CHECK(invalid_instruction != nullptr)
       << kInvalidInstructionISelName << " doesn't exist";
@@ -66,6 +50,104 @@ InstructionLifter::Impl::Impl(const Arch *arch_,
       << kUnsupportedInstructionISelName << " doesn't exist";
 }
 
+// Try to find the function that implements this semantics.
+llvm::Function *
+InstructionLifter::Impl::GetInstructionFunction(std::string_view function) {
+  auto isel_it = isels.find(llvm::StringRef(function.data(), function.size()));
+  if (isel_it == isels.end()) {
+    return nullptr;  // Falls back on `UNIMPLEMENTED_INSTRUCTION`.
+  }
+
+  auto isel = isel_it->second;
+  if (!isel->isConstant() || !isel->hasInitializer()) {
+    LOG(FATAL) << "Expected a `constexpr` variable as the function pointer for "
+               << "instruction semantic function " << function << ": "
+               << LLVMThingToString(isel);
+  }
+
+  auto sem = isel->getInitializer()->stripPointerCasts();
+  return llvm::dyn_cast_or_null<llvm::Function>(sem);
+}
+
+llvm::Function *
+InstructionLifter::Impl::GetInstructionFunction(const Instruction &inst) {
+  if (inst.form == Instruction::kUnknownForm) {
+    return GetInstructionFunction(inst.function);
+  }
+
+  if (inst.form >= isel_by_form.size()) {
+    isel_by_form.resize(inst.form + 1u);
+  }
+
+  // Most forms map to one or two semantics functions, so a linear scan beats
+  // hashing.
+  auto &entries = isel_by_form[inst.form];
+  for (const auto &[name, func] : entries) {
+    if (name == inst.function) {
+      return func;
+    }
+  }
+
+  auto func = GetInstructionFunction(inst.function);
+  entries.emplace_back(inst.function, func);
+  return func;
+}
+
+void InstructionLifter::Impl::SetFunction(llvm::Function *func) {
+  if (func != last_func) {
+    ClearRegisterCaches();
+    last_func = func;
+
+    CHECK_EQ(module, func->getParent())
+        << "InstructionLifter isn't using the correct module!";
+  }
+}
+
+void InstructionLifter::Impl::ClearRegisterCaches(void) {
+  reg_ptr_cache.clear();
+  var_ptr_cache.clear();
+  mem_ptr_ref = nullptr;
+  pc_ref = nullptr;
+  next_pc_ref = nullptr;
+}
+
+InstructionLifter::Impl::~Impl(void) {
+  for (auto &[key, tpl] : lift_templates) {
+    if (tpl.func) {
+      tpl.func->dropAllReferences();
+      delete tpl.func;
+    }
+  }
+}
+
+bool InstructionLifter::Impl::GetLiftTemplateKey(const Instruction &inst,
+                                                 llvm::Function *isel_func,
+                                                 LiftTemplateKey &key) {
+  key.isel_func = isel_func;
+  auto &ops_key = key.operands;
+  template_regs.clear();
+  for (const auto &op : inst.operands) {
+    ops_key.push_back(static_cast<uintptr_t>(op.type) |
+                      (static_cast<uintptr_t>(op.action) << 8u) |
+                      (static_cast<uintptr_t>(op.size) << 16u));
+    switch (op.type) {
+      case Operand::kTypeRegister: {
+        const auto reg = op.reg.resolved ? op.reg.resolved
+                                         : arch->RegisterByName(op.reg.name);
+        if (!reg || op.reg.size != op.size) {
+          return false;
+        }
+        ops_key.push_back(reinterpret_cast<uintptr_t>(reg->type));
+        template_regs.push_back(reg);
+        break;
+      }
+      case Operand::kTypeImmediate: ops_key.push_back(op.imm.is_signed); break;
+      default: return false;
+    }
+  }
+  return true;
+}
+
 InstructionLifter::~InstructionLifter(void) {}
 
 InstructionLifter::InstructionLifter(const Arch *arch_,
@@ -88,21 +170,13 @@ LiftStatus InstructionLifter::LiftIntoBlock(Instruction &arch_inst,
                                             llvm::Value *state_ptr,
                                             bool is_delayed) {
   llvm::Function *const func = block->getParent();
-  llvm::Module *const module = func->getParent();
   llvm::Function *isel_func = nullptr;
   auto status = kLiftedInstruction;
 
-  // Cache invalidation.
-  if (func != impl->last_func) {
-    impl->reg_ptr_cache.clear();
-    impl->last_func = func;
-
-    CHECK_EQ(impl->module, module)
-        << "InstructionLifter isn't using the correct module!";
-  }
+  impl->SetFunction(func);
 
   if (arch_inst.IsValid()) {
-    isel_func = GetInstructionFunction(module, arch_inst.function);
+    isel_func = impl->GetInstructionFunction(arch_inst);
   } else {
     isel_func = impl->invalid_instruction;
     arch_inst.operands.clear();
@@ -115,13 +189,19 @@ LiftStatus InstructionLifter::LiftIntoBlock(Instruction &arch_inst,
     status = kLiftedUnsupportedInstruction;
   }
 
+  // Every instruction needs these, so look them up once per function.
+  if (!impl->mem_ptr_ref) {
+    impl->mem_ptr_ref =
+        LoadRegAddress(block, state_ptr, kMemoryVariableName).first;
+    impl->pc_ref = LoadRegAddress(block, state_ptr, kPCVariableName).first;
+    impl->next_pc_ref =
+        LoadRegAddress(block, state_ptr, kNextPCVariableName).first;
+  }
+
   llvm::IRBuilder<> ir(block);
-  const auto [mem_ptr_ref, mem_ptr_ref_type] =
-      LoadRegAddress(block, state_ptr, kMemoryVariableName);
-  const auto [pc_ref, pc_ref_type] =
-      LoadRegAddress(block, state_ptr, kPCVariableName);
-  const auto [next_pc_ref, next_pc_ref_type] =
-      LoadRegAddress(block, state_ptr, kNextPCVariableName);
+  const auto mem_ptr_ref = impl->mem_ptr_ref;
+  const auto pc_ref = impl->pc_ref;
+  const auto next_pc_ref = impl->next_pc_ref;
   const auto next_pc = ir.CreateLoad(impl->word_type, next_pc_ref);
 
   // If this instruction appears within a delay slot, then we're going to assume
@@ -170,23 +250,51 @@ LiftStatus InstructionLifter::LiftIntoBlock(Instruction &arch_inst,
   auto isel_func_type = isel_func->getFunctionType();
   auto arg_num = 2U;
 
-  for (auto &op : arch_inst.operands) {
-    if (!(arg_num < isel_func_type->getNumParams())) {
-      return kLiftedMismatchedISEL;
-    }
+  LiftTemplate *lift_template = nullptr;
+  LiftTemplateKey template_key;
+  if (impl->use_lift_templates && !is_delayed &&
+      status == kLiftedInstruction &&
+      impl->GetLiftTemplateKey(arch_inst, isel_func, template_key)) {
+    lift_template = &(impl->lift_templates[template_key]);
+  }
 
-    auto arg = NthArgument(isel_func, arg_num);
-    auto arg_type = arg->getType();
-    auto operand = LiftOperand(arch_inst, block, state_ptr, arg, op);
-    arg_num += 1;
-    auto op_type = operand->getType();
-    CHECK_EQ(op_type, arg_type)
-        << "Lifted operand " << op.Serialize() << " to " << arch_inst.function
-        << " does not have the correct type. Expected "
-        << LLVMThingToString(arg_type) << " but got "
-        << LLVMThingToString(op_type) << ".";
+  // Templates are only recorded from operands that lifted successfully, so they
+  // needn't be checked against `isel_func` again.
+  const auto lifted_from_template =
+      lift_template && lift_template->func &&
+      InstantiateLiftTemplate(*lift_template, arch_inst, block, state_ptr,
+                              isel_func, args);
+
+  if (!lifted_from_template) {
+
+    // Give up on recording a template after a few failures, e.g. when the
+    // operands always share a register.
+    const auto capture_template = lift_template && !lift_template->func &&
+                                  lift_template->num_failed_captures < 8u;
+    const auto last_inst = capture_template ? &(block->back()) : nullptr;
+    for (auto &op : arch_inst.operands) {
+      if (!(arg_num < isel_func_type->getNumParams())) {
+        return kLiftedMismatchedISEL;
+      }
+
+      auto arg = NthArgument(isel_func, arg_num);
+      auto arg_type = arg->getType();
+      auto operand = LiftOperand(arch_inst, block, state_ptr, arg, op);
+      arg_num += 1;
+      auto op_type = operand->getType();
+      CHECK_EQ(op_type, arg_type)
+          << "Lifted operand " << op.Serialize() << " to "
+          << arch_inst.function << " does not have the correct type. Expected "
+          << LLVMThingToString(arg_type) << " but got "
+          << LLVMThingToString(op_type) << ".";
+
+      args.push_back(operand);
+    }
 
-    args.push_back(operand);
+    if (capture_template) {
+      CaptureLiftTemplate(*lift_template, arch_inst, block, state_ptr,
+                          last_inst, args);
+    }
   }
 
   // Pass in current value of the memory pointer.
@@ -224,84 +332,244 @@ LiftStatus InstructionLifter::LiftIntoBlock(Instruction &arch_inst,
   return status;
 }
 
-// Load the address of a register.
-std::pair<llvm::Value *, llvm::Type *>
-InstructionLifter::LoadRegAddress(llvm::BasicBlock *block,
-                                  llvm::Value *state_ptr,
-                                  std::string_view reg_name_) const {
-  const auto func = block->getParent();
-  const auto module = func->getParent();
+namespace {
 
-  // Invalidate the cache.
-  if (func != impl->last_func) {
-    impl->reg_ptr_cache.clear();
-    impl->last_func = func;
+// Load the address of the register named by an operand, skipping the lookup
+// of its name if the decoder resolved the register.
+static std::pair<llvm::Value *, llvm::Type *>
+LoadOperandRegAddress(const InstructionLifter &lifter, llvm::BasicBlock *block,
+                      llvm::Value *state_ptr, const Operand::Register &reg) {
+  if (reg.resolved) {
+    return lifter.LoadRegAddress(block, state_ptr, reg.resolved);
+  } else {
+    return lifter.LoadRegAddress(block, state_ptr, reg.name);
+  }
+}
 
-    CHECK_EQ(func->getParent(), impl->module);
+// Load the value of the register named by an operand.
+static llvm::Value *LoadOperandRegValue(const InstructionLifter &lifter,
+                                        llvm::BasicBlock *block,
+                                        llvm::Value *state_ptr,
+                                        const Operand::Register &reg) {
+  if (reg.resolved) {
+    return lifter.LoadRegValue(block, state_ptr, reg.resolved);
+  } else {
+    return lifter.LoadRegValue(block, state_ptr, reg.name);
   }
+}
 
-  std::string reg_name(reg_name_.data(), reg_name_.size());
-  auto [reg_ptr_it, added] = impl->reg_ptr_cache.emplace(
-      std::move(reg_name),
-      std::pair<llvm::Value *, llvm::Type *>{nullptr, nullptr});
+// Zero-extend `val`, the value of the register `reg_name`, to the size of
+// the machine word, i.e. of `zero`.
+static llvm::Value *ZeroExtendToWord(llvm::BasicBlock *block, llvm::Value *val,
+                                     std::string_view reg_name,
+                                     llvm::ConstantInt *zero) {
+  auto val_type = llvm::dyn_cast_or_null<llvm::IntegerType>(val->getType());
+  auto word_type = zero->getType();
 
-  if (reg_ptr_it->second.first) {
-    (void) added;
-    return reg_ptr_it->second;
+  CHECK(val_type) << "Register " << reg_name << " expected to be an integer.";
+
+  auto val_size = val_type->getIntegerBitWidth();
+  auto word_size = word_type->getIntegerBitWidth();
+  CHECK_LE(val_size, word_size)
+      << "Register " << reg_name << " expected to be no larger than the "
+      << "machine word size (" << word_type->getIntegerBitWidth() << " bits).";
+
+  if (val_size < word_size) {
+    val = new llvm::ZExtInst(val, word_type, llvm::Twine::createNull(), block);
   }
 
+  return val;
+}
 
-  auto reg = impl->arch->RegisterByName(reg_name_);
+// Return the value of the register named by an operand, or zero if the
+// operand names no register.
+static llvm::Value *LoadOperandWordRegValOrZero(const InstructionLifter &lifter,
+                                                llvm::BasicBlock *block,
+                                                llvm::Value *state_ptr,
+                                                const Operand::Register &reg,
+                                                llvm::ConstantInt *zero) {
+  if (reg.name.empty()) {
+    return zero;
+  }
+  return ZeroExtendToWord(
+      block, LoadOperandRegValue(lifter, block, state_ptr, reg), reg.name,
+      zero);
+}
 
-  // It's already a variable in the function.
-  const auto [var_ptr, var_ptr_type] = FindVarInFunction(func, reg_name_, true);
-  if (var_ptr) {
-    auto ty = var_ptr_type;
-    //NOTE(Ian) for stuff like NEXT_PC existing in the block we arent going to have reg type info, im not sure i like pulling it from var_ptr_type regardles. Not sure what to do about it
-    if (reg) {
-      ty = reg->type;
+}  // namespace
+
+void InstructionLifter::EnableLiftTemplates(bool enable) {
+  impl->use_lift_templates = enable;
+}
+
+bool InstructionLifter::InstantiateLiftTemplate(
+    const LiftTemplate &tpl, Instruction &inst, llvm::BasicBlock *block,
+    llvm::Value *state_ptr, llvm::Function *isel_func,
+    std::vector<llvm::Value *> &args) {
+  llvm::ValueToValueMapTy value_map;
+  value_map[tpl.func->getArg(0)] = state_ptr;
+
+  // NOTE: With typed pointers, a register that's a variable of the function may
+  //       have a differently typed address than in the template. Lift such
+  //       operands normally.
+  auto num_regs = 1u;
+  for (auto reg : impl->template_regs) {
+    auto param = tpl.func->getArg(num_regs++);
+    auto reg_ptr = LoadRegAddress(block, state_ptr, reg).first;
+    if (reg_ptr->getType() != param->getType()) {
+      return false;
+    }
+    value_map[param] = reg_ptr;
+  }
+
+  llvm::IRBuilder<> ir(block);
+  for (auto &tpl_inst : tpl.func->getEntryBlock()) {
+    auto new_inst = ir.Insert(tpl_inst.clone());
+    value_map[&tpl_inst] = new_inst;
+    llvm::RemapInstruction(new_inst, value_map,
+                           llvm::RF_NoModuleLevelChanges);
+  }
+
+  auto arg_num = 2u;
+  for (auto &op : inst.operands) {
+    auto val = tpl.operand_values[arg_num - 2u];
+    if (!val) {
+      val = LiftOperand(inst, block, state_ptr, NthArgument(isel_func, arg_num),
+                        op);
+    } else if (!llvm::isa<llvm::Constant>(val)) {
+      val = value_map[val];
+    }
+    args.push_back(val);
+    arg_num += 1;
+  }
+
+  return true;
+}
+
+void InstructionLifter::CaptureLiftTemplate(
+    LiftTemplate &tpl, Instruction &inst, llvm::BasicBlock *block,
+    llvm::Value *state_ptr, llvm::Instruction *last_inst,
+    const std::vector<llvm::Value *> &args) {
+
+  // The values that become the arguments of the template. If any two are
+  // the same, e.g. `add x0, x0, #1`, then we can't tell which operand uses
+  // which, so wait for another instruction.
+  std::vector<llvm::Value *> params = {state_ptr};
+  std::unordered_set<llvm::Value *> seen_params = {state_ptr};
+  for (auto reg : impl->template_regs) {
+    auto reg_ptr = LoadRegAddress(block, state_ptr, reg).first;
+    if (!seen_params.insert(reg_ptr).second) {
+      tpl.num_failed_captures++;
+      return;
+    }
+    params.push_back(reg_ptr);
+  }
+
+  // Find the IR that lifted the operands. It may only use the values that
+  // become arguments, and itself.
+  std::vector<llvm::Instruction *> insts;
+  std::unordered_set<llvm::Value *> seen_insts;
+  for (auto it = std::next(last_inst->getIterator()); it != block->end();
+       ++it) {
+    if (!seen_params.count(&*it)) {
+      insts.push_back(&*it);
+      seen_insts.insert(&*it);
+    }
+  }
+
+  auto is_captured = [&](llvm::Value *val) {
+    return llvm::isa<llvm::Constant>(val) || seen_params.count(val) ||
+           seen_insts.count(val);
+  };
+
+  for (auto new_inst : insts) {
+    for (auto &op_use : new_inst->operands()) {
+      if (!is_captured(op_use.get())) {
+        tpl.num_failed_captures++;
+        return;
+      }
     }
-    reg_ptr_it->second = {var_ptr, ty};
-    return reg_ptr_it->second;
-  }
-
-  // It's a register known to this architecture, so go and build a GEP to it
-  // right now. We'll try to be careful about the placement of the actual
-  // indexing instructions so that they always follow the definition of the
-  // state pointer, and thus are most likely to dominate all future uses.
-  if (reg) {
-    llvm::Value *reg_ptr = nullptr;
-
-    // The state pointer is an argument.
-    if (auto state_arg = llvm::dyn_cast<llvm::Argument>(state_ptr); state_arg) {
-      DCHECK_EQ(state_arg->getParent(), block->getParent());
-      auto &target_block = block->getParent()->getEntryBlock();
-      llvm::IRBuilder<> ir(&target_block, target_block.getFirstInsertionPt());
-      reg_ptr = reg->AddressOf(state_ptr, ir);
-
-      // The state pointer is an instruction, likely an `AllocaInst`.
-    } else if (auto state_inst = llvm::dyn_cast<llvm::Instruction>(state_ptr);
-               state_inst) {
-      llvm::IRBuilder<> ir(state_inst);
-      reg_ptr = reg->AddressOf(state_ptr, ir);
-
-      // The state pointer is a constant, likely an `llvm::GlobalVariable`.
-    } else if (auto state_const = llvm::dyn_cast<llvm::Constant>(state_ptr);
-               state_const) {
-      auto &target_block = block->getParent()->getEntryBlock();
-      llvm::IRBuilder<> ir(&target_block, target_block.getFirstInsertionPt());
-      reg_ptr = reg->AddressOf(state_ptr, ir);
-
-      // Not sure.
+  }
+
+  // `args` starts with the memory and `State` pointers.
+  for (auto i = 0u; i < inst.operands.size(); ++i) {
+    if (!is_captured(args[i + 2u])) {
+      tpl.num_failed_captures++;
+      return;
+    }
+  }
+
+  std::vector<llvm::Type *> param_types;
+  for (auto param : params) {
+    param_types.push_back(param->getType());
+  }
+
+  auto &context = block->getContext();
+  tpl.func = llvm::Function::Create(
+      llvm::FunctionType::get(llvm::Type::getVoidTy(context), param_types,
+                              false),
+      llvm::GlobalValue::PrivateLinkage, "__remill_lift_template");
+  auto tpl_block = llvm::BasicBlock::Create(context, "", tpl.func);
+
+  llvm::ValueToValueMapTy value_map;
+  for (auto i = 0u; i < params.size(); ++i) {
+    value_map[params[i]] = tpl.func->getArg(i);
+  }
+
+  llvm::IRBuilder<> ir(tpl_block);
+  for (auto new_inst : insts) {
+    auto tpl_inst = ir.Insert(new_inst->clone());
+    value_map[new_inst] = tpl_inst;
+    llvm::RemapInstruction(tpl_inst, value_map,
+                           llvm::RF_NoModuleLevelChanges);
+  }
+
+  tpl.operand_values.clear();
+  for (auto i = 0u; i < inst.operands.size(); ++i) {
+    auto val = args[i + 2u];
+    if (inst.operands[i].type == Operand::kTypeImmediate) {
+      tpl.operand_values.push_back(nullptr);
+    } else if (llvm::isa<llvm::Constant>(val)) {
+      tpl.operand_values.push_back(val);
     } else {
-      LOG(FATAL) << "Unsupported value type for the State pointer: "
-                 << LLVMThingToString(state_ptr);
+      tpl.operand_values.push_back(value_map[val]);
     }
+  }
+}
+
+// Load the address of a register.
+std::pair<llvm::Value *, llvm::Type *>
+InstructionLifter::LoadRegAddress(llvm::BasicBlock *block,
+                                  llvm::Value *state_ptr,
+                                  std::string_view reg_name_) const {
+  const auto func = block->getParent();
+  const auto module = func->getParent();
+  impl->SetFunction(func);
 
-    reg_ptr_it->second = {reg_ptr, reg->type};
-    return reg_ptr_it->second;
+  for (const auto &[var_name, var] : impl->var_ptr_cache) {
+    if (var_name == reg_name_) {
+      return var;
+    }
+  }
+
+  // It's a register known to this architecture.
+  if (auto reg = impl->arch->RegisterByName(reg_name_)) {
+    return LoadRegAddress(block, state_ptr, reg);
+  }
+
+  // It's already a variable in the function.
+  //
+  // NOTE(Ian) for stuff like NEXT_PC existing in the block we arent going to
+  // have reg type info, im not sure i like pulling it from var_ptr_type
+  // regardles. Not sure what to do about it
+  const auto var = FindVarInFunction(func, reg_name_, true);
+  if (var.first) {
+    impl->var_ptr_cache.emplace_back(std::string(reg_name_), var);
+    return var;
   }
 
+  std::string reg_name(reg_name_.data(), reg_name_.size());
+
   // Try to find it as a global variable.
   if (auto gvar = module->getGlobalVariable(reg_name)) {
     return {gvar, gvar->getValueType()};
@@ -327,9 +595,70 @@ InstructionLifter::LoadRegAddress(llvm::BasicBlock *block,
           impl->word_type};
 }
 
+// Load the address of a register of the lifter's architecture.
+std::pair<llvm::Value *, llvm::Type *>
+InstructionLifter::LoadRegAddress(llvm::BasicBlock *block,
+                                  llvm::Value *state_ptr,
+                                  const Register *reg) const {
+  DCHECK_EQ(reg->arch, impl->arch);
+
+  const auto func = block->getParent();
+  impl->SetFunction(func);
+
+  if (reg->index >= impl->reg_ptr_cache.size()) {
+    impl->reg_ptr_cache.resize(reg->index + 1u);
+  }
+
+  auto &reg_ptr_entry = impl->reg_ptr_cache[reg->index];
+  if (reg_ptr_entry.first) {
+    return reg_ptr_entry;
+  }
+
+  // It's already a variable in the function.
+  if (auto var_ptr = FindVarInFunction(func, reg->name, true).first) {
+    reg_ptr_entry = {var_ptr, reg->type};
+    return reg_ptr_entry;
+  }
+
+  // Go and build a GEP to the register right now. We'll try to be careful
+  // about the placement of the actual indexing instructions so that they
+  // always follow the definition of the state pointer, and thus are most
+  // likely to dominate all future uses.
+  llvm::Value *reg_ptr = nullptr;
+
+  // The state pointer is an argument.
+  if (auto state_arg = llvm::dyn_cast<llvm::Argument>(state_ptr); state_arg) {
+    DCHECK_EQ(state_arg->getParent(), block->getParent());
+    auto &target_block = block->getParent()->getEntryBlock();
+    llvm::IRBuilder<> ir(&target_block, target_block.getFirstInsertionPt());
+    reg_ptr = reg->AddressOf(state_ptr, ir);
+
+    // The state pointer is an instruction, likely an `AllocaInst`.
+  } else if (auto state_inst = llvm::dyn_cast<llvm::Instruction>(state_ptr);
+             state_inst) {
+    llvm::IRBuilder<> ir(state_inst);
+    reg_ptr = reg->AddressOf(state_ptr, ir);
+
+    // The state pointer is a constant, likely an `llvm::GlobalVariable`.
+  } else if (auto state_const = llvm::dyn_cast<llvm::Constant>(state_ptr);
+             state_const) {
+    auto &target_block = block->getParent()->getEntryBlock();
+    llvm::IRBuilder<> ir(&target_block, target_block.getFirstInsertionPt());
+    reg_ptr = reg->AddressOf(state_ptr, ir);
+
+    // Not sure.
+  } else {
+    LOG(FATAL) << "Unsupported value type for the State pointer: "
+               << LLVMThingToString(state_ptr);
+  }
+
+  reg_ptr_entry = {reg_ptr, reg->type};
+  return reg_ptr_entry;
+}
+
 // Clear out the cache of the current register values/addresses loaded.
 void InstructionLifter::ClearCache(void) const {
-  impl->reg_ptr_cache.clear();
+  impl->ClearRegisterCaches();
   impl->last_func = nullptr;
 }
 
@@ -342,6 +671,15 @@ llvm::Value *InstructionLifter::LoadRegValue(llvm::BasicBlock *block,
   return new llvm::LoadInst(ptr_ty, ptr, llvm::Twine::createNull(), block);
 }
 
+// Load the value of a register of the lifter's architecture.
+llvm::Value *InstructionLifter::LoadRegValue(llvm::BasicBlock *block,
+                                             llvm::Value *state_ptr,
+                                             const Register *reg) const {
+  auto [ptr, ptr_ty] = LoadRegAddress(block, state_ptr, reg);
+  CHECK_NOTNULL(ptr);
+  return new llvm::LoadInst(ptr_ty, ptr, llvm::Twine::createNull(), block);
+}
+
 // Return a register value, or zero.
 llvm::Value *InstructionLifter::LoadWordRegValOrZero(llvm::BasicBlock *block,
                                                      llvm::Value *state_ptr,
@@ -352,23 +690,8 @@ llvm::Value *InstructionLifter::LoadWordRegValOrZero(llvm::BasicBlock *block,
     return zero;
   }
 
-  auto val = LoadRegValue(block, state_ptr, reg_name);
-  auto val_type = llvm::dyn_cast_or_null<llvm::IntegerType>(val->getType());
-  auto word_type = zero->getType();
-
-  CHECK(val_type) << "Register " << reg_name << " expected to be an integer.";
-
-  auto val_size = val_type->getIntegerBitWidth();
-  auto word_size = word_type->getIntegerBitWidth();
-  CHECK_LE(val_size, word_size)
-      << "Register " << reg_name << " expected to be no larger than the "
-      << "machine word size (" << word_type->getIntegerBitWidth() << " bits).";
-
-  if (val_size < word_size) {
-    val = new llvm::ZExtInst(val, word_type, llvm::Twine::createNull(), block);
-  }
-
-  return val;
+  return ZeroExtendToWord(block, LoadRegValue(block, state_ptr, reg_name),
+                          reg_name, zero);
 }
 
 llvm::Value *InstructionLifter::LiftShiftRegisterOperand(
@@ -386,7 +709,7 @@ llvm::Value *InstructionLifter::LiftShiftRegisterOperand(
       << "for instruction at " << std::hex << inst.pc;
 
   const llvm::DataLayout data_layout(module->getDataLayout());
-  auto reg = LoadRegValue(block, state_ptr, arch_reg.name);
+  auto reg = LoadOperandRegValue(*this, block, state_ptr, arch_reg);
   auto reg_type = reg->getType();
   auto reg_size = data_layout.getTypeSizeInBits(reg_type).getFixedValue();
   auto word_size = impl->arch->address_size;
@@ -577,7 +900,8 @@ llvm::Value *InstructionLifter::LiftRegisterOperand(Instruction &inst,
   if (!arg_type) {
     return llvm::UndefValue::get(arg->getType());
   } else if (llvm::isa<llvm::PointerType>(arg_type)) {
-    auto [val, val_type] = LoadRegAddress(block, state_ptr, arch_reg.name);
+    auto [val, val_type] =
+        LoadOperandRegAddress(*this, block, state_ptr, arch_reg);
     return ConvertToIntendedType(inst, op, block, val, real_arg_type);
 
   } else {
@@ -585,7 +909,7 @@ llvm::Value *InstructionLifter::LiftRegisterOperand(Instruction &inst,
         << "Expected " << arch_reg.name << " to be an integral or float type "
         << "for instruction at " << std::hex << inst.pc;
 
-    auto val = LoadRegValue(block, state_ptr, arch_reg.name);
+    auto val = LoadOperandRegValue(*this, block, state_ptr, arch_reg);
 
     const llvm::DataLayout data_layout(module->getDataLayout());
     auto val_type = val->getType();
@@ -830,9 +1154,9 @@ llvm::Value *InstructionLifter::LiftExpressionOperandRec(
     }
   } else if (auto reg_op = std::get_if<const Register *>(op)) {
     if (!arg || !llvm::isa<llvm::PointerType>(arg->getType())) {
-      return LoadRegValue(block, state_ptr, (*reg_op)->name);
+      return LoadRegValue(block, state_ptr, *reg_op);
     } else {
-      return LoadRegAddress(block, state_ptr, (*reg_op)->name).first;
+      return LoadRegAddress(block, state_ptr, *reg_op).first;
     }
 
   } else if (auto ci_op = std::get_if<llvm::Constant *>(op)) {
@@ -871,14 +1195,14 @@ llvm::Value *InstructionLifter::LiftAddressOperand(Instruction &inst,
       << "for instruction at " << std::hex << inst.pc
       << " is wider than the machine word size.";
 
-  auto addr =
-      LoadWordRegValOrZero(block, state_ptr, arch_addr.base_reg.name, zero);
-  auto index =
-      LoadWordRegValOrZero(block, state_ptr, arch_addr.index_reg.name, zero);
+  auto addr = LoadOperandWordRegValOrZero(*this, block, state_ptr,
+                                          arch_addr.base_reg, zero);
+  auto index = LoadOperandWordRegValOrZero(*this, block, state_ptr,
+                                           arch_addr.index_reg, zero);
   auto scale = llvm::ConstantInt::get(
       word_type, static_cast<uint64_t>(arch_addr.scale), true);
-  auto segment = LoadWordRegValOrZero(block, state_ptr,
-                                      arch_addr.segment_base_reg.name, zero);
+  auto segment = LoadOperandWordRegValOrZero(
+      *this, block, state_ptr, arch_addr.segment_base_reg, zero);
 
   llvm::IRBuilder<> ir(block);
 
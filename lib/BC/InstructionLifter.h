@@ -15,7 +15,10 @@
  */
 
 #include <glog/logging.h>
+#include <llvm/ADT/DenseMap.h>
+#include <llvm/ADT/Hashing.h>
 #include <llvm/ADT/SmallVector.h>
+#include <llvm/ADT/StringMap.h>
 #include <llvm/IR/BasicBlock.h>
 #include <llvm/IR/Constants.h>
 #include <llvm/IR/DataLayout.h>
@@ -40,6 +43,7 @@
 #include <sstream>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -53,10 +57,94 @@
 
 namespace remill {
 
+// The IR that lifts the operands of one kind of instruction, with the
+// addresses of its register operands as the arguments of `func`.
+struct InstructionLifter::LiftTemplate {
+
+  // A function that isn't part of any module, whose only block holds the IR
+  // to copy. Its first argument stands in for the `State` pointer, and then
+  // there is one argument per register operand.
+  llvm::Function *func{nullptr};
+
+  // The lifted value of each operand, as a value in `func` or a constant.
+  // Immediate operands are `nullptr`, as they are lifted again for each
+  // instruction.
+  std::vector<llvm::Value *> operand_values;
+
+  // Number of times that the IR couldn't be recorded, e.g. because two
+  // operands named the same register.
+  unsigned num_failed_captures{0};
+};
+
+// Identifies the lift template of an instruction.
+//
+// NOTE: Semantics functions are keyed by address, like in `isel_by_form`.
+//       They live in the lifter's module for as long as the lifter does.
+struct InstructionLifter::LiftTemplateKey {
+  llvm::Function *isel_func{nullptr};
+
+  // The kind, action, and size of each operand, then the type of each
+  // register operand, or the signedness of each immediate operand.
+  llvm::SmallVector<uintptr_t, 8> operands;
+
+  inline bool operator==(const LiftTemplateKey &that) const {
+    return isel_func == that.isel_func && operands == that.operands;
+  }
+
+  // Lets keys be used in an `llvm::DenseMap`.
+  struct Info {
+    static inline LiftTemplateKey getEmptyKey(void) {
+      LiftTemplateKey key;
+      key.isel_func = llvm::DenseMapInfo<llvm::Function *>::getEmptyKey();
+      return key;
+    }
+
+    static inline LiftTemplateKey getTombstoneKey(void) {
+      LiftTemplateKey key;
+      key.isel_func = llvm::DenseMapInfo<llvm::Function *>::getTombstoneKey();
+      return key;
+    }
+
+    static unsigned getHashValue(const LiftTemplateKey &key) {
+      return static_cast<unsigned>(llvm::hash_combine(
+          key.isel_func, llvm::hash_combine_range(key.operands.begin(),
+                                                  key.operands.end())));
+    }
+
+    static bool isEqual(const LiftTemplateKey &lhs,
+                        const LiftTemplateKey &rhs) {
+      return lhs == rhs;
+    }
+  };
+};
+
 class InstructionLifter::Impl {
  public:
   Impl(const Arch *arch_, const IntrinsicTable *intrinsics_);
 
+  ~Impl(void);
+
+  // Fill `key` with the semantics function and the kinds of operands of
+  // `inst`, and `template_regs` with its register operands. Returns `false`
+  // if `inst` has operands that templates don't handle, i.e. anything other
+  // than known registers and immediates.
+  bool GetLiftTemplateKey(const Instruction &inst, llvm::Function *isel_func,
+                          LiftTemplateKey &key);
+
+  // Find the semantics function that implements `inst`, or `nullptr` if the
+  // instruction is unsupported.
+  llvm::Function *GetInstructionFunction(const Instruction &inst);
+
+  // Find the semantics function named `function`, or `nullptr`.
+  llvm::Function *GetInstructionFunction(std::string_view function);
+
+  // Note that we're lifting into `func`, clearing out the caches of register
+  // addresses if they belong to another function.
+  void SetFunction(llvm::Function *func);
+
+  // Clear out the caches of register addresses.
+  void ClearRegisterCaches(void);
+
   // Architecture being used for lifting.
   const Arch *const arch;
 
@@ -69,17 +157,58 @@ class InstructionLifter::Impl {
   // Type of the memory pointer.
   llvm::Type *const memory_ptr_type;
 
-  // Cache of looked up registers inside of `last_func`.
-  std::unordered_map<std::string, std::pair<llvm::Value *, llvm::Type *>>
-      reg_ptr_cache;
+  // Cache of looked up registers inside of `last_func`, indexed by
+  // `Register::index`. Entries of registers that haven't been looked up are
+  // `nullptr`.
+  std::vector<std::pair<llvm::Value *, llvm::Type *>> reg_ptr_cache;
+
+  // Cache of looked up variables inside of `last_func` that aren't registers,
+  // e.g. `MEMORY` and `NEXT_PC`. There are only a few of these, so a linear
+  // scan of the names is cheaper than hashing.
+  std::vector<std::pair<std::string, std::pair<llvm::Value *, llvm::Type *>>>
+      var_ptr_cache;
+
+  // Addresses of the `MEMORY`, `PC`, and `NEXT_PC` variables inside of
+  // `last_func`, which are needed to lift every instruction.
+  llvm::Value *mem_ptr_ref{nullptr};
+  llvm::Value *pc_ref{nullptr};
+  llvm::Value *next_pc_ref{nullptr};
 
   // The function into which we're lifting. If This gets out of date, we
-  // clear out `reg_ptr_cache`.
+  // clear out `reg_ptr_cache`, `var_ptr_cache`, and the addresses of the
+  // variables.
   llvm::Function *last_func{nullptr};
 
   llvm::Module *const module;
+
+  // All `ISEL_*` variables in `module`, keyed by the name of the instruction
+  // that they implement (i.e. without the `ISEL_` prefix). This is built once
+  // so that we don't need to build up names and search the module's symbol
+  // table for every lifted instruction.
+  llvm::StringMap<llvm::GlobalVariable *> isels;
+
+  // Semantics functions indexed by `Instruction::form`. Decoders append
+  // suffixes (e.g. operand sizes) to the name derived from the form, so each
+  // entry is a short list of names seen for that form, and the function that
+  // implements each one.
+  std::vector<llvm::SmallVector<std::pair<std::string, llvm::Function *>, 2>>
+      isel_by_form;
+
   llvm::Function *const invalid_instruction;
   llvm::Function *const unsupported_instruction;
+
+  // Whether or not to lift the operands of instructions using
+  // `lift_templates`.
+  bool use_lift_templates{false};
+
+  // Lift templates, keyed by `GetLiftTemplateKey`.
+  llvm::DenseMap<LiftTemplateKey, LiftTemplate, LiftTemplateKey::Info>
+      lift_templates;
+
+  // The register operands of the instruction whose key was last made by
+  // `GetLiftTemplateKey`, so that templates can go straight to
+  // `reg_ptr_cache` rather than looking registers up by name.
+  llvm::SmallVector<const Register *, 4> template_regs;
 };
 
 }  // namespace remill
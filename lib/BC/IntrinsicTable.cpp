@@ -88,6 +88,20 @@ IntrinsicTable::IntrinsicTable(llvm::Module *module)
       write_memory_f128(
           FindIntrinsic(module, "__remill_write_memory_f128")),
 
+      read_memory_v128(FindIntrinsic(module, "__remill_read_memory_v128")),
+      read_memory_v256(FindIntrinsic(module, "__remill_read_memory_v256")),
+      read_memory_v512(FindIntrinsic(module, "__remill_read_memory_v512")),
+
+      write_memory_v128(
+          FindIntrinsic(module, "__remill_write_memory_v128")),
+      write_memory_v256(
+          FindIntrinsic(module, "__remill_write_memory_v256")),
+      write_memory_v512(
+          FindIntrinsic(module, "__remill_write_memory_v512")),
+
+      memory_copy(FindIntrinsic(module, "__remill_memcpy")),
+      memory_set(FindIntrinsic(module, "__remill_memset")),
+
       // Memory barriers.
       barrier_load_load(
           FindIntrinsic(module, "__remill_barrier_load_load")),
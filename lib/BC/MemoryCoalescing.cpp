@@ -0,0 +1,418 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <llvm/IR/BasicBlock.h>
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/DataLayout.h>
+#include <llvm/IR/DerivedTypes.h>
+#include <llvm/IR/Function.h>
+#include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/InstrTypes.h>
+#include <llvm/IR/Instructions.h>
+#include <llvm/IR/IntrinsicInst.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Transforms/Utils/BasicBlockUtils.h>
+
+#include <cstdint>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "remill/BC/Optimizer.h"
+
+namespace remill {
+namespace {
+
+// Merged accesses never cross a boundary of this size, so they fault exactly
+// when one of the original accesses would have.
+static constexpr uint64_t kPageSize = 4096u;
+
+// Sizes, in bytes, of the accesses that can be merged, along with the names
+// of their read and write intrinsics. Two adjacent accesses of one size are
+// merged into an access of the next size.
+static const struct {
+  unsigned size;
+  const char *read_name;
+  const char *write_name;
+} kAccessSizes[] = {
+    {1u, "__remill_read_memory_8", "__remill_write_memory_8"},
+    {2u, "__remill_read_memory_16", "__remill_write_memory_16"},
+    {4u, "__remill_read_memory_32", "__remill_write_memory_32"},
+    {8u, "__remill_read_memory_64", "__remill_write_memory_64"},
+    {16u, "__remill_read_memory_v128", "__remill_write_memory_v128"},
+};
+
+static constexpr unsigned kNumAccessSizes =
+    sizeof(kAccessSizes) / sizeof(kAccessSizes[0]);
+
+// A call to a memory read or write intrinsic.
+struct Access {
+  llvm::CallInst *call{nullptr};
+  bool is_write{false};
+
+  // Index into `kAccessSizes`.
+  unsigned size_index{0};
+
+  // The accessed address is `base + offset`.
+  llvm::Value *base{nullptr};
+  int64_t offset{0};
+
+  unsigned Size(void) const {
+    return kAccessSizes[size_index].size;
+  }
+
+  llvm::Value *Address(void) const {
+    return call->getArgOperand(1);
+  }
+};
+
+// Split `addr` into a base value and a constant offset from it, by looking
+// through additions and subtractions of constants.
+static std::pair<llvm::Value *, int64_t> SplitAddress(llvm::Value *addr) {
+  int64_t offset = 0;
+  while (auto op = llvm::dyn_cast<llvm::BinaryOperator>(addr)) {
+    auto lhs = op->getOperand(0);
+    auto rhs = op->getOperand(1);
+    if (op->getOpcode() == llvm::Instruction::Add) {
+      if (auto rhs_const = llvm::dyn_cast<llvm::ConstantInt>(rhs)) {
+        offset += rhs_const->getSExtValue();
+        addr = lhs;
+      } else if (auto lhs_const = llvm::dyn_cast<llvm::ConstantInt>(lhs)) {
+        offset += lhs_const->getSExtValue();
+        addr = rhs;
+      } else {
+        break;
+      }
+    } else if (op->getOpcode() == llvm::Instruction::Sub) {
+      if (auto rhs_const = llvm::dyn_cast<llvm::ConstantInt>(rhs)) {
+        offset -= rhs_const->getSExtValue();
+        addr = lhs;
+      } else {
+        break;
+      }
+    } else {
+      break;
+    }
+  }
+  return {addr, offset};
+}
+
+class MemoryCoalescer {
+ public:
+  explicit MemoryCoalescer(llvm::Function *func_);
+
+  unsigned Run(void);
+
+ private:
+  // Fill in `access` if `call` is a call to a read or write intrinsic of a
+  // size that can be merged.
+  bool Classify(llvm::CallInst *call, Access &access) const;
+
+  // Returns `true` if `first` and `second`, with `first` before `second` and
+  // no other memory intrinsic calls between them, can be merged.
+  static bool CanMerge(const Access &first, const Access &second);
+
+  // Find the pairs of accesses in `block` to merge.
+  void FindPairs(llvm::BasicBlock &block,
+                 std::vector<std::pair<Access, Access>> &pairs) const;
+
+  // Returns `true` if the `size` bytes at `addr` don't cross a page boundary.
+  llvm::Value *CreateWithinPage(llvm::IRBuilder<> &ir, llvm::Value *addr,
+                                unsigned size) const;
+
+  // Get the stack slot through which merged 16-byte accesses are passed.
+  llvm::Value *GetVectorSlot(void);
+
+  // Merge two adjacent reads, placing the merged read at `first`.
+  void MergeReads(const Access &first, const Access &second);
+
+  // Merge two adjacent writes, placing the merged write at `second`.
+  void MergeWrites(const Access &first, const Access &second);
+
+  llvm::Function *const func;
+  llvm::Module *const module;
+  llvm::LLVMContext &context;
+
+  llvm::Function *reads[kNumAccessSizes];
+  llvm::Function *writes[kNumAccessSizes];
+
+  llvm::Value *vector_slot{nullptr};
+};
+
+MemoryCoalescer::MemoryCoalescer(llvm::Function *func_)
+    : func(func_),
+      module(func->getParent()),
+      context(module->getContext()) {
+  for (auto i = 0u; i < kNumAccessSizes; ++i) {
+    reads[i] = module->getFunction(kAccessSizes[i].read_name);
+    writes[i] = module->getFunction(kAccessSizes[i].write_name);
+  }
+}
+
+bool MemoryCoalescer::Classify(llvm::CallInst *call, Access &access) const {
+  auto callee = call->getCalledFunction();
+  if (!callee) {
+    return false;
+  }
+
+  // The largest size is only ever a merged access.
+  for (auto i = 0u; i + 1u < kNumAccessSizes; ++i) {
+    const auto is_read = callee == reads[i];
+    if (!is_read && callee != writes[i]) {
+      continue;
+    }
+
+    // Only merge into sizes that have intrinsics.
+    if (!reads[i + 1u] || !writes[i + 1u]) {
+      return false;
+    }
+
+    access.call = call;
+    access.is_write = !is_read;
+    access.size_index = i;
+    std::tie(access.base, access.offset) = SplitAddress(access.Address());
+    return true;
+  }
+  return false;
+}
+
+bool MemoryCoalescer::CanMerge(const Access &first, const Access &second) {
+  if (first.is_write != second.is_write ||
+      first.size_index != second.size_index || first.base != second.base ||
+      first.Address()->getType() != second.Address()->getType()) {
+    return false;
+  }
+
+  const auto size = static_cast<int64_t>(first.Size());
+  if (first.offset + size != second.offset &&
+      second.offset + size != first.offset) {
+    return false;
+  }
+
+  // The memory pointer produced by the first write must only be used by the
+  // second write, otherwise something observes the memory between them.
+  if (first.is_write) {
+    return first.call->hasOneUse() &&
+           second.call->getArgOperand(0) == first.call;
+  }
+  return true;
+}
+
+void MemoryCoalescer::FindPairs(
+    llvm::BasicBlock &block,
+    std::vector<std::pair<Access, Access>> &pairs) const {
+  Access prev;
+  auto has_prev = false;
+  for (auto &inst : block) {
+    auto call = llvm::dyn_cast<llvm::CallInst>(&inst);
+
+    // LLVM intrinsics, e.g. lifetime markers, don't touch guest memory, but
+    // other calls might.
+    if (!call || llvm::isa<llvm::IntrinsicInst>(call)) {
+      continue;
+    }
+
+    Access curr;
+    if (!Classify(call, curr)) {
+      has_prev = false;
+
+    } else if (has_prev && CanMerge(prev, curr)) {
+      pairs.emplace_back(prev, curr);
+      has_prev = false;
+
+    } else {
+      prev = curr;
+      has_prev = true;
+    }
+  }
+}
+
+llvm::Value *MemoryCoalescer::CreateWithinPage(llvm::IRBuilder<> &ir,
+                                               llvm::Value *addr,
+                                               unsigned size) const {
+  const auto addr_type = addr->getType();
+  auto page_offset =
+      ir.CreateAnd(addr, llvm::ConstantInt::get(addr_type, kPageSize - 1u));
+  return ir.CreateICmpULE(
+      page_offset, llvm::ConstantInt::get(addr_type, kPageSize - size));
+}
+
+llvm::Value *MemoryCoalescer::GetVectorSlot(void) {
+  if (!vector_slot) {
+    auto &entry_block = func->getEntryBlock();
+    llvm::IRBuilder<> ir(&entry_block, entry_block.getFirstInsertionPt());
+    vector_slot = ir.CreateAlloca(
+        llvm::ArrayType::get(llvm::Type::getInt64Ty(context), 2u));
+  }
+  return vector_slot;
+}
+
+void MemoryCoalescer::MergeReads(const Access &first, const Access &second) {
+  const auto merged_index = first.size_index + 1u;
+  const auto size = first.Size();
+  const auto is_first_low = first.offset < second.offset;
+  const auto mem_ptr = first.call->getArgOperand(0);
+  const auto type = first.call->getType();
+
+  // `second`'s address may be computed after `first`, so recompute it from the
+  // common base.
+  llvm::IRBuilder<> ir(first.call);
+  const auto first_addr = first.Address();
+  const auto second_addr = ir.CreateAdd(
+      second.base,
+      llvm::ConstantInt::getSigned(first_addr->getType(), second.offset));
+  const auto low_addr = is_first_low ? first_addr : second_addr;
+
+  llvm::Instruction *then_term = nullptr;
+  llvm::Instruction *else_term = nullptr;
+  llvm::SplitBlockAndInsertIfThenElse(
+      CreateWithinPage(ir, low_addr, size * 2u), first.call, &then_term,
+      &else_term);
+
+  // Read both halves at once.
+  ir.SetInsertPoint(then_term);
+  llvm::Value *low_val = nullptr;
+  llvm::Value *high_val = nullptr;
+  if (merged_index + 1u == kNumAccessSizes) {
+    const auto slot = GetVectorSlot();
+    llvm::Value *args[] = {mem_ptr, low_addr, slot};
+    ir.CreateCall(reads[merged_index], args);
+    low_val = ir.CreateLoad(type, slot);
+    high_val = ir.CreateLoad(
+        type, ir.CreateConstGEP1_32(ir.getInt8Ty(), slot, size));
+  } else {
+    llvm::Value *args[] = {mem_ptr, low_addr};
+    const auto merged = ir.CreateCall(reads[merged_index], args);
+    low_val = ir.CreateTrunc(merged, type);
+    high_val = ir.CreateTrunc(ir.CreateLShr(merged, size * 8u), type);
+  }
+  const auto merged_first = is_first_low ? low_val : high_val;
+  const auto merged_second = is_first_low ? high_val : low_val;
+
+  // Read each half on its own, in the original order.
+  ir.SetInsertPoint(else_term);
+  llvm::Value *first_args[] = {mem_ptr, first_addr};
+  llvm::Value *second_args[] = {mem_ptr, second_addr};
+  const auto split_first =
+      ir.CreateCall(reads[first.size_index], first_args);
+  const auto split_second =
+      ir.CreateCall(reads[first.size_index], second_args);
+
+  ir.SetInsertPoint(first.call);
+  auto first_val = ir.CreatePHI(type, 2u);
+  first_val->addIncoming(merged_first, then_term->getParent());
+  first_val->addIncoming(split_first, else_term->getParent());
+  auto second_val = ir.CreatePHI(type, 2u);
+  second_val->addIncoming(merged_second, then_term->getParent());
+  second_val->addIncoming(split_second, else_term->getParent());
+
+  first.call->replaceAllUsesWith(first_val);
+  second.call->replaceAllUsesWith(second_val);
+  first.call->eraseFromParent();
+  second.call->eraseFromParent();
+}
+
+void MemoryCoalescer::MergeWrites(const Access &first, const Access &second) {
+  const auto merged_index = first.size_index + 1u;
+  const auto size = first.Size();
+  const auto is_first_low = first.offset < second.offset;
+  const auto mem_ptr = first.call->getArgOperand(0);
+  const auto first_addr = first.Address();
+  const auto second_addr = second.Address();
+  const auto first_val = first.call->getArgOperand(2);
+  const auto second_val = second.call->getArgOperand(2);
+  const auto low_addr = is_first_low ? first_addr : second_addr;
+  const auto low_val = is_first_low ? first_val : second_val;
+  const auto high_val = is_first_low ? second_val : first_val;
+
+  llvm::IRBuilder<> ir(second.call);
+  llvm::Instruction *then_term = nullptr;
+  llvm::Instruction *else_term = nullptr;
+  llvm::SplitBlockAndInsertIfThenElse(
+      CreateWithinPage(ir, low_addr, size * 2u), second.call, &then_term,
+      &else_term);
+
+  // Write both halves at once.
+  ir.SetInsertPoint(then_term);
+  llvm::Value *merged = nullptr;
+  if (merged_index + 1u == kNumAccessSizes) {
+    const auto slot = GetVectorSlot();
+    ir.CreateStore(low_val, slot);
+    ir.CreateStore(high_val,
+                   ir.CreateConstGEP1_32(ir.getInt8Ty(), slot, size));
+    llvm::Value *args[] = {mem_ptr, low_addr, slot};
+    merged = ir.CreateCall(writes[merged_index], args);
+  } else {
+    const auto merged_type = llvm::Type::getIntNTy(context, size * 16u);
+    const auto merged_val = ir.CreateOr(
+        ir.CreateZExt(low_val, merged_type),
+        ir.CreateShl(ir.CreateZExt(high_val, merged_type), size * 8u));
+    llvm::Value *args[] = {mem_ptr, low_addr, merged_val};
+    merged = ir.CreateCall(writes[merged_index], args);
+  }
+
+  // Write each half on its own, in the original order.
+  ir.SetInsertPoint(else_term);
+  llvm::Value *first_args[] = {mem_ptr, first_addr, first_val};
+  const auto split_first =
+      ir.CreateCall(writes[first.size_index], first_args);
+  llvm::Value *second_args[] = {split_first, second_addr, second_val};
+  const auto split_second =
+      ir.CreateCall(writes[first.size_index], second_args);
+
+  ir.SetInsertPoint(second.call);
+  auto new_mem_ptr = ir.CreatePHI(second.call->getType(), 2u);
+  new_mem_ptr->addIncoming(merged, then_term->getParent());
+  new_mem_ptr->addIncoming(split_second, else_term->getParent());
+
+  second.call->replaceAllUsesWith(new_mem_ptr);
+  second.call->eraseFromParent();
+  first.call->eraseFromParent();
+}
+
+unsigned MemoryCoalescer::Run(void) {
+
+  // The lower addressed half is the less significant half.
+  if (module->getDataLayout().isBigEndian()) {
+    return 0u;
+  }
+
+  std::vector<std::pair<Access, Access>> pairs;
+  for (auto &block : *func) {
+    FindPairs(block, pairs);
+  }
+
+  for (const auto &[first, second] : pairs) {
+    if (first.is_write) {
+      MergeWrites(first, second);
+    } else {
+      MergeReads(first, second);
+    }
+  }
+
+  return static_cast<unsigned>(pairs.size() * 2u);
+}
+
+}  // namespace
+
+unsigned CoalesceMemoryAccesses(llvm::Function *func) {
+  if (func->isDeclaration()) {
+    return 0u;
+  }
+  return MemoryCoalescer(func).Run();
+}
+
+}  // namespace remill
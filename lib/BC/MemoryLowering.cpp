@@ -0,0 +1,356 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <glog/logging.h>
+#include <llvm/ADT/StringRef.h>
+#include <llvm/IR/BasicBlock.h>
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/DataLayout.h>
+#include <llvm/IR/Function.h>
+#include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/Instructions.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Metadata.h>
+#include <llvm/IR/Module.h>
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "remill/BC/Optimizer.h"
+
+namespace remill {
+namespace {
+
+// How a call to a memory intrinsic is lowered.
+enum class MemoryAccess {
+
+  // `T __remill_read_memory_*(Memory *, addr_t)`
+  kRead,
+
+  // `Memory *__remill_read_memory_*(Memory *, addr_t, T &)`
+  kReadInto,
+
+  // `Memory *__remill_write_memory_*(Memory *, addr_t, T)`
+  kWrite,
+
+  // `Memory *__remill_write_memory_*(Memory *, addr_t, const T &)`
+  kWriteFrom,
+
+  // `Memory *__remill_memcpy(Memory *, addr_t, addr_t, addr_t)`
+  kCopy,
+
+  // `Memory *__remill_memset(Memory *, addr_t, uint8_t, addr_t)`
+  kSet,
+
+  // `Memory *__remill_fetch_and_*_N(Memory *, addr_t, T &)`
+  kFetch,
+
+  // `Memory *__remill_compare_exchange_memory_N(Memory *, addr_t, T &, T)`
+  kCompareExchange
+};
+
+// Suffixes of the memory read and write intrinsics, along with the number of
+// bytes accessed by those which pass their values by reference.
+static const std::pair<const char *, uint64_t> kAccessSuffixes[] = {
+    {"8", 0u},      {"16", 0u},     {"32", 0u},     {"64", 0u},
+    {"f32", 0u},    {"f64", 0u},    {"f128", 0u},   {"f80", 10u},
+    {"v128", 16u},  {"v256", 32u},  {"v512", 64u},
+};
+
+// Operations of the `__remill_fetch_and_*` intrinsics.
+static const std::pair<const char *, llvm::AtomicRMWInst::BinOp> kFetchOps[] = {
+    {"add_", llvm::AtomicRMWInst::Add}, {"sub_", llvm::AtomicRMWInst::Sub},
+    {"and_", llvm::AtomicRMWInst::And}, {"or_", llvm::AtomicRMWInst::Or},
+    {"xor_", llvm::AtomicRMWInst::Xor}, {"nand_", llvm::AtomicRMWInst::Nand},
+};
+
+// Consume the operation of a `__remill_fetch_and_*` intrinsic from the front
+// of `name`.
+static bool ConsumeFetchOp(llvm::StringRef &name,
+                           llvm::AtomicRMWInst::BinOp &op) {
+  if (!name.consume_front("__remill_fetch_and_")) {
+    return false;
+  }
+  for (const auto &[prefix, fetch_op] : kFetchOps) {
+    if (name.consume_front(prefix)) {
+      op = fetch_op;
+      return true;
+    }
+  }
+  return false;
+}
+
+// Parse the number of bits accessed by an atomic memory intrinsic into a
+// number of bytes.
+static bool ParseAtomicSize(llvm::StringRef bits, uint64_t &size) {
+  if (bits.getAsInteger(10, size)) {
+    return false;
+  }
+  switch (size) {
+    case 8:
+    case 16:
+    case 32:
+    case 64:
+    case 128: size /= 8u; return true;
+    default: return false;
+  }
+}
+
+// Figure out how to lower a call to the function named `name`. `size` is set
+// to the number of bytes accessed by the intrinsics that pass their values by
+// reference. Returns `false` if `name` isn't a memory intrinsic that can be
+// lowered.
+static bool ClassifyIntrinsic(llvm::StringRef name, MemoryAccess &access,
+                              uint64_t &size) {
+  size = 0u;
+  llvm::AtomicRMWInst::BinOp op = llvm::AtomicRMWInst::Add;
+  if (name == "__remill_memcpy") {
+    access = MemoryAccess::kCopy;
+    return true;
+
+  } else if (name == "__remill_memset") {
+    access = MemoryAccess::kSet;
+    return true;
+
+  } else if (ConsumeFetchOp(name, op)) {
+    access = MemoryAccess::kFetch;
+    return ParseAtomicSize(name, size) && size <= 8u;
+
+  } else if (name.consume_front("__remill_compare_exchange_memory_")) {
+    access = MemoryAccess::kCompareExchange;
+    return ParseAtomicSize(name, size);
+  }
+
+  auto is_read = false;
+  if (name.consume_front("__remill_read_memory_")) {
+    is_read = true;
+  } else if (!name.consume_front("__remill_write_memory_")) {
+    return false;
+  }
+
+  for (const auto &[suffix, by_ref_size] : kAccessSuffixes) {
+    if (name == suffix) {
+      size = by_ref_size;
+      if (is_read) {
+        access = size ? MemoryAccess::kReadInto : MemoryAccess::kRead;
+      } else {
+        access = size ? MemoryAccess::kWriteFrom : MemoryAccess::kWrite;
+      }
+      return true;
+    }
+  }
+  return false;
+}
+
+// Returns the number of arguments passed to an intrinsic lowered by `access`.
+static unsigned NumArgs(MemoryAccess access) {
+  switch (access) {
+    case MemoryAccess::kRead: return 2u;
+    case MemoryAccess::kCopy:
+    case MemoryAccess::kSet:
+    case MemoryAccess::kCompareExchange: return 4u;
+    default: return 3u;
+  }
+}
+
+class MemoryLowerer {
+ public:
+  MemoryLowerer(llvm::Function *func_, const DirectMemoryModel &model_)
+      : func(func_),
+        model(model_),
+        module(func->getParent()),
+        context(module->getContext()),
+        intptr_type(module->getDataLayout().getIntPtrType(context)),
+        ptr_type(llvm::PointerType::get(context, 0)),
+        i8_type(llvm::Type::getInt8Ty(context)) {}
+
+  unsigned Run(void);
+
+ private:
+  // Get the host address of guest address zero, loading it in the entry block
+  // of `func` if it's held in a variable.
+  llvm::Value *GetBase(void);
+
+  // Compute the host pointer to the guest address `addr`.
+  llvm::Value *HostPointer(llvm::IRBuilder<> &ir, llvm::Value *addr);
+
+  // Replace `call` with direct accesses of host memory.
+  void Lower(llvm::CallInst *call, MemoryAccess access, uint64_t size);
+
+  llvm::Function *const func;
+  const DirectMemoryModel &model;
+  llvm::Module *const module;
+  llvm::LLVMContext &context;
+  llvm::IntegerType *const intptr_type;
+  llvm::PointerType *const ptr_type;
+  llvm::Type *const i8_type;
+
+  llvm::Value *base{nullptr};
+};
+
+llvm::Value *MemoryLowerer::GetBase(void) {
+  if (base) {
+    return base;
+  }
+
+  if (model.base_variable.empty()) {
+    base = llvm::ConstantExpr::getIntToPtr(
+        llvm::ConstantInt::get(intptr_type, model.base_address, false),
+        ptr_type);
+    return base;
+  }
+
+  // The base never changes while lifted code runs, so load it once, as
+  // invariant, so that guest stores don't force a reload.
+  auto base_var = module->getOrInsertGlobal(model.base_variable, ptr_type);
+  auto &entry_block = func->getEntryBlock();
+  llvm::IRBuilder<> ir(&entry_block, entry_block.getFirstInsertionPt());
+  auto load = ir.CreateLoad(ptr_type, base_var);
+  load->setMetadata(llvm::LLVMContext::MD_invariant_load,
+                    llvm::MDNode::get(context, {}));
+  base = load;
+  return base;
+}
+
+llvm::Value *MemoryLowerer::HostPointer(llvm::IRBuilder<> &ir,
+                                        llvm::Value *addr) {
+  auto offset = ir.CreateZExtOrTrunc(addr, intptr_type);
+  if (model.address_mask) {
+    offset = ir.CreateAnd(
+        offset,
+        llvm::ConstantInt::get(intptr_type, model.address_mask, false));
+  }
+  return ir.CreateGEP(i8_type, GetBase(), offset);
+}
+
+void MemoryLowerer::Lower(llvm::CallInst *call, MemoryAccess access,
+                          uint64_t size) {
+  CHECK_EQ(call->arg_size(), NumArgs(access))
+      << "Unexpected signature for memory intrinsic "
+      << call->getCalledFunction()->getName().str();
+
+  llvm::IRBuilder<> ir(call);
+  const auto mem_ptr = call->getArgOperand(0);
+  const auto ptr = HostPointer(ir, call->getArgOperand(1));
+  const llvm::MaybeAlign align(1);
+  const llvm::MaybeAlign atomic_align(model.misaligned_atomics ? 1u : size);
+
+  llvm::Value *replacement = mem_ptr;
+  switch (access) {
+    case MemoryAccess::kRead:
+      replacement = ir.CreateAlignedLoad(call->getType(), ptr, align);
+      break;
+    case MemoryAccess::kReadInto:
+      ir.CreateMemCpy(call->getArgOperand(2), align, ptr, align, size);
+      break;
+    case MemoryAccess::kWrite:
+      ir.CreateAlignedStore(call->getArgOperand(2), ptr, align);
+      break;
+    case MemoryAccess::kWriteFrom:
+      ir.CreateMemCpy(ptr, align, call->getArgOperand(2), align, size);
+      break;
+    case MemoryAccess::kCopy:
+      ir.CreateMemMove(ptr, align, HostPointer(ir, call->getArgOperand(2)),
+                       align, call->getArgOperand(3));
+      break;
+    case MemoryAccess::kSet:
+      ir.CreateMemSet(ptr, call->getArgOperand(2), call->getArgOperand(3),
+                      align);
+      break;
+
+    // NOTE: The atomic intrinsics pass the value (or expected value) by
+    //       reference, and return the old value through it. They are
+    //       sequentially consistent.
+    case MemoryAccess::kFetch: {
+      llvm::AtomicRMWInst::BinOp op = llvm::AtomicRMWInst::Add;
+      auto name = call->getCalledFunction()->getName();
+      CHECK(ConsumeFetchOp(name, op));
+      const auto type = llvm::Type::getIntNTy(context, size * 8u);
+      const auto val_ptr = call->getArgOperand(2);
+      auto old_val = ir.CreateAtomicRMW(
+          op, ptr, ir.CreateAlignedLoad(type, val_ptr, align),
+          atomic_align, llvm::AtomicOrdering::SequentiallyConsistent);
+      ir.CreateAlignedStore(old_val, val_ptr, align);
+      break;
+    }
+    case MemoryAccess::kCompareExchange: {
+      const auto type = llvm::Type::getIntNTy(context, size * 8u);
+      const auto expected_ptr = call->getArgOperand(2);
+      auto desired = call->getArgOperand(3);
+
+      // The 128-bit intrinsic also passes `desired` by reference.
+      if (desired->getType()->isPointerTy()) {
+        desired = ir.CreateAlignedLoad(type, desired, align);
+      }
+      auto cmpxchg = ir.CreateAtomicCmpXchg(
+          ptr, ir.CreateAlignedLoad(type, expected_ptr, align), desired,
+          atomic_align, llvm::AtomicOrdering::SequentiallyConsistent,
+          llvm::AtomicOrdering::SequentiallyConsistent);
+      ir.CreateAlignedStore(ir.CreateExtractValue(cmpxchg, 0), expected_ptr,
+                            align);
+      break;
+    }
+  }
+
+  call->replaceAllUsesWith(replacement);
+  call->eraseFromParent();
+}
+
+unsigned MemoryLowerer::Run(void) {
+  std::vector<std::pair<llvm::CallInst *, std::pair<MemoryAccess, uint64_t>>>
+      calls;
+  for (auto &block : *func) {
+    for (auto &inst : block) {
+      auto call = llvm::dyn_cast<llvm::CallInst>(&inst);
+      if (!call) {
+        continue;
+      }
+      auto callee = call->getCalledFunction();
+      MemoryAccess access = MemoryAccess::kRead;
+      uint64_t size = 0u;
+      if (!callee || !ClassifyIntrinsic(callee->getName(), access, size)) {
+        continue;
+      }
+
+      // NOTE: Masking can't bound a guest-controlled length, so leave these to
+      //       the runtime.
+      if (model.address_mask &&
+          (access == MemoryAccess::kCopy || access == MemoryAccess::kSet)) {
+        continue;
+      }
+      calls.emplace_back(call, std::make_pair(access, size));
+    }
+  }
+
+  for (auto [call, how] : calls) {
+    Lower(call, how.first, how.second);
+  }
+
+  return static_cast<unsigned>(calls.size());
+}
+
+}  // namespace
+
+unsigned LowerMemoryIntrinsics(llvm::Function *func,
+                               const DirectMemoryModel &model) {
+  if (func->isDeclaration()) {
+    return 0u;
+  }
+  return MemoryLowerer(func, model).Run();
+}
+
+}  // namespace remill
@@ -38,55 +38,302 @@
 #include <llvm/Transforms/IPO.h>
 #include <llvm/Transforms/IPO/Inliner.h>
 #include <llvm/Transforms/IPO/ModuleInliner.h>
+#include <llvm/Transforms/InstCombine/InstCombine.h>
 #include <llvm/Transforms/Scalar.h>
+#include <llvm/Transforms/Scalar/DeadStoreElimination.h>
+#include <llvm/Transforms/Scalar/EarlyCSE.h>
+#include <llvm/Transforms/Scalar/GVN.h>
+#include <llvm/Transforms/Scalar/SROA.h>
+#include <llvm/Transforms/Scalar/SimplifyCFG.h>
 #include <llvm/Transforms/Utils/Cloning.h>
 #include <llvm/Transforms/Utils/Local.h>
 #include <llvm/Transforms/Utils/ValueMapper.h>
+#include <llvm/Transforms/Vectorize/LoopVectorize.h>
+#include <llvm/Transforms/Vectorize/SLPVectorizer.h>
+
+#include <chrono>
+#include <vector>
 
 #include "remill/Arch/Arch.h"
 #include "remill/BC/Util.h"
 #include "remill/BC/Version.h"
 
 namespace remill {
+namespace {
 
-void OptimizeModule(const remill::Arch *arch, llvm::Module *module,
-                    std::function<llvm::Function *(void)> generator,
-                    OptimizationGuide guide) {
-  OptimizeBareModule(module, guide);
+llvm::OptimizationLevel GetOptimizationLevel(unsigned level) {
+  switch (level) {
+    case 0: return llvm::OptimizationLevel::O0;
+    case 1: return llvm::OptimizationLevel::O1;
+    case 2: return llvm::OptimizationLevel::O2;
+    default: return llvm::OptimizationLevel::O3;
+  }
 }
 
-// Optimize a normal module. This might not contain special Remill-specific
-// intrinsics functions like `__remill_jump`, etc.
-void OptimizeBareModule(llvm::Module *module, OptimizationGuide guide) {
+template <typename Funcs>
+size_t CountInstructions(const Funcs &funcs) {
+  size_t count = 0u;
+  for (llvm::Function *func : funcs) {
+    count += func->getInstructionCount();
+  }
+  return count;
+}
+
+void VerifyOrDie(llvm::Module *module, const char *when) {
+  if (auto maybe_message = VerifyModuleMsg(module)) {
+    LOG(FATAL) << "Module " << module->getName().str() << " failed to verify "
+               << when << " optimization: " << *maybe_message;
+  }
+}
+
+// Remill's intrinsics, e.g. `__remill_read_memory_32`, are the interface
+// between lifted code and whatever consumes it, and so calls to them must
+// survive optimization. Most are declarations, but some semantics modules
+// provide definitions, which we don't want inlined into lifted code.
+void PreserveIntrinsicCalls(llvm::Module *module) {
+  for (auto &func : *module) {
+    if (!func.isDeclaration() && func.getName().find("__remill_") == 0) {
+      func.removeFnAttr(llvm::Attribute::AlwaysInline);
+      func.removeFnAttr(llvm::Attribute::InlineHint);
+      func.addFnAttr(llvm::Attribute::NoInline);
+    }
+  }
+}
+
+// Build the function pipeline that is run on lifted traces, after the
+// semantics functions have been inlined into them.
+llvm::FunctionPassManager
+BuildTracePipeline(llvm::PassBuilder &pb, const OptimizationGuide &guide) {
+  auto fpm = pb.buildFunctionSimplificationPipeline(
+      GetOptimizationLevel(guide.level), llvm::ThinOrFullLTOPhase::None);
+
+  // The inlined semantics leave behind many redundant loads and stores through
+  // the `State` pointer, so always clean them up, whatever the level.
+#if LLVM_VERSION_MAJOR >= 16
+  fpm.addPass(llvm::SROAPass(llvm::SROAOptions::ModifyCFG));
+#else
+  fpm.addPass(llvm::SROAPass());
+#endif  // LLVM_VERSION_MAJOR
+  fpm.addPass(llvm::EarlyCSEPass(true /* UseMemorySSA */));
+  fpm.addPass(llvm::GVNPass());
+  fpm.addPass(llvm::DSEPass());
+  fpm.addPass(llvm::InstCombinePass());
+
+  if (guide.loop_vectorize) {
+    fpm.addPass(llvm::LoopVectorizePass());
+  }
+
+  if (guide.slp_vectorize) {
+    fpm.addPass(llvm::SLPVectorizerPass());
+  }
+
+  fpm.addPass(llvm::SimplifyCFGPass());
+  return fpm;
+}
+
+// Bundles up everything needed to run new pass manager pipelines.
+class PassRunner {
+ public:
+  explicit PassRunner(const OptimizationGuide &guide)
+      : pb(nullptr, GetTuningOptions(guide)) {
+    pb.registerModuleAnalyses(mam);
+    pb.registerFunctionAnalyses(fam);
+    pb.registerLoopAnalyses(lam);
+    pb.registerCGSCCAnalyses(cam);
+    pb.crossRegisterProxies(lam, fam, cam, mam);
+  }
+
+  ~PassRunner(void) {
+    mam.clear();
+    fam.clear();
+    lam.clear();
+    cam.clear();
+  }
+
+  static llvm::PipelineTuningOptions
+  GetTuningOptions(const OptimizationGuide &guide) {
+    llvm::PipelineTuningOptions opts;
+#if LLVM_VERSION_MAJOR >= 16
+    opts.InlinerThreshold = 250;
+#endif  // LLVM_VERSION_MAJOR
+    opts.SLPVectorization = guide.slp_vectorize;
+    opts.LoopVectorization = guide.loop_vectorize;
+    return opts;
+  }
 
   llvm::ModuleAnalysisManager mam;
   llvm::FunctionAnalysisManager fam;
   llvm::LoopAnalysisManager lam;
   llvm::CGSCCAnalysisManager cam;
+  llvm::PassBuilder pb;
+};
 
+// Logs the results of optimizing some functions.
+class OptimizationReport {
+ public:
+  OptimizationReport(const OptimizationGuide &guide_, const char *what_,
+                     size_t num_funcs_, size_t num_insts_before_)
+      : guide(guide_),
+        what(what_),
+        num_funcs(num_funcs_),
+        num_insts_before(num_insts_before_),
+        start(std::chrono::steady_clock::now()) {}
 
-  llvm::PipelineTuningOptions opts;
-#if LLVM_VERSION_MAJOR >= 16
-  opts.InlinerThreshold = 250;
-#endif // LLVM_VERSION_MAJOR
-  llvm::PassBuilder pb(nullptr, opts);
+  void Finish(size_t num_insts_after) const {
+    if (!guide.report) {
+      return;
+    }
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start);
+    LOG(INFO) << "Optimized " << num_funcs << ' ' << what << " at -O"
+              << guide.level << " in " << elapsed.count() << "ms; "
+              << num_insts_before << " instructions before, "
+              << num_insts_after << " instructions after";
+  }
 
-  pb.registerModuleAnalyses(mam);
-  pb.registerFunctionAnalyses(fam);
-  pb.registerLoopAnalyses(lam);
-  pb.registerCGSCCAnalyses(cam);
-  pb.crossRegisterProxies(lam, fam, cam, mam);
+ private:
+  const OptimizationGuide &guide;
+  const char *const what;
+  const size_t num_funcs;
+  const size_t num_insts_before;
+  const std::chrono::steady_clock::time_point start;
+};
 
+}  // namespace
+
+// Optimize a module containing lifted traces, which are produced by
+// `generator`. Semantics functions are inlined into the traces, and then, if
+// `guide.level` is non-zero, the traces alone are optimized.
+void OptimizeModule(const remill::Arch *arch, llvm::Module *module,
+                    std::function<llvm::Function *(void)> generator,
+                    OptimizationGuide guide) {
+  std::vector<llvm::Function *> traces;
+  while (auto trace = generator()) {
+    traces.push_back(trace);
+  }
+
+  // Lazily loaded semantics must be read in before inlining.
+  CHECK(MaterializeUsedFunctions(module))
+      << "Unable to materialize the semantics used by the lifted code";
+
+  if (guide.verify_input) {
+    VerifyOrDie(module, "before");
+  }
+
+  OptimizationReport report(guide, "traces", traces.size(),
+                            CountInstructions(traces));
+
+  PreserveIntrinsicCalls(module);
+
+  PassRunner runner(guide);
   llvm::ModulePassManager mpm;
   mpm.addPass(llvm::ModuleInlinerPass(llvm::getInlineParams(250)));
+  mpm.run(*module, runner.mam);
+
+  llvm::FunctionPassManager fpm;
+  if (guide.level) {
+    fpm = BuildTracePipeline(runner.pb, guide);
+  }
+
+  unsigned num_promoted = 0u;
+  unsigned num_dead_flags = 0u;
+  unsigned num_coalesced = 0u;
+  unsigned num_lowered = 0u;
+  for (auto trace : traces) {
+    if (trace->isDeclaration()) {
+      continue;
+    }
+    if (guide.level && guide.eliminate_dead_flags) {
+      const auto num_removed = EliminateDeadFlagStores(arch, trace);
+      LOG_IF(INFO, guide.report && num_removed)
+          << "Removed " << num_removed << " dead flag stores from "
+          << trace->getName().str();
+      num_dead_flags += num_removed;
+    }
+    if (guide.level && guide.promote_registers) {
+      num_promoted += PromoteStateRegisters(arch, trace);
+    }
+
+    // NOTE: Coalesce after promoting registers, so that addresses computed from
+    //       the same register share a base, and lower memory before the trace
+    //       pipeline so that it can optimize the direct accesses.
+    if (guide.coalesce_memory) {
+      num_coalesced += CoalesceMemoryAccesses(trace);
+    }
+    if (guide.lower_memory) {
+      num_lowered += LowerMemoryIntrinsics(trace, guide.memory_model);
+    }
+    if (guide.level) {
+      runner.fam.invalidate(*trace, llvm::PreservedAnalyses::none());
+      fpm.run(*trace, runner.fam);
+    }
+  }
 
-  mpm.run(*module, mam);
+  report.Finish(CountInstructions(traces));
+  if (guide.report && guide.coalesce_memory) {
+    LOG(INFO) << "Merged " << num_coalesced
+              << " memory intrinsic calls into wider calls across "
+              << traces.size() << " traces in module "
+              << module->getName().str();
+  }
+  if (guide.report && guide.lower_memory) {
+    LOG(INFO) << "Lowered " << num_lowered
+              << " memory intrinsic calls into direct accesses across "
+              << traces.size() << " traces";
+  }
+  if (guide.report && guide.promote_registers && guide.level) {
+    LOG(INFO) << "Promoted " << num_promoted
+              << " registers into SSA form across " << traces.size()
+              << " traces";
+  }
+  if (guide.report && guide.eliminate_dead_flags && guide.level) {
+    LOG(INFO) << "Removed " << num_dead_flags << " dead flag stores across "
+              << traces.size() << " traces";
+  }
+
+  if (guide.verify_output) {
+    VerifyOrDie(module, "after");
+  }
+}
+
+// Optimize a normal module. This might not contain special Remill-specific
+// intrinsics functions like `__remill_jump`, etc.
+void OptimizeBareModule(llvm::Module *module, OptimizationGuide guide) {
+  CHECK(MaterializeUsedFunctions(module))
+      << "Unable to materialize the functions used by the module";
+
+  if (guide.verify_input) {
+    VerifyOrDie(module, "before");
+  }
+
+  std::vector<llvm::Function *> funcs;
+  for (auto &func : *module) {
+    funcs.push_back(&func);
+  }
+
+  OptimizationReport report(guide, "functions", funcs.size(),
+                            CountInstructions(funcs));
+
+  PassRunner runner(guide);
+  llvm::ModulePassManager mpm;
+  if (guide.level) {
+    mpm = runner.pb.buildPerModuleDefaultPipeline(
+        GetOptimizationLevel(guide.level));
+  } else {
+    mpm.addPass(llvm::ModuleInlinerPass(llvm::getInlineParams(250)));
+  }
+  mpm.run(*module, runner.mam);
 
+  // The module pipeline may have deleted some of `funcs`.
+  funcs.clear();
+  for (auto &func : *module) {
+    funcs.push_back(&func);
+  }
+  report.Finish(CountInstructions(funcs));
 
-  mam.clear();
-  fam.clear();
-  lam.clear();
-  cam.clear();
+  if (guide.verify_output) {
+    VerifyOrDie(module, "after");
+  }
 }
 
 }  // namespace remill
@@ -0,0 +1,308 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <glog/logging.h>
+#include <llvm/ADT/APInt.h>
+#include <llvm/IR/BasicBlock.h>
+#include <llvm/IR/DataLayout.h>
+#include <llvm/IR/Dominators.h>
+#include <llvm/IR/Function.h>
+#include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/Instructions.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Transforms/Utils/PromoteMemToReg.h>
+
+#include <map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "remill/Arch/Arch.h"
+#include "remill/BC/ABI.h"
+#include "remill/BC/Optimizer.h"
+#include "remill/BC/Util.h"
+
+namespace remill {
+namespace {
+
+// A load from, or store to, a constant offset in the `State` structure.
+struct StateAccess {
+  llvm::Instruction *inst;
+  uint64_t offset;
+};
+
+// A register whose accesses we may promote.
+struct PromotedRegister {
+  const Register *reg{nullptr};
+
+  // Set to `false` if any access to this register can't be redirected to
+  // `alloca`, e.g. because it straddles two registers.
+  bool promotable{true};
+
+  // Whether or not any access is a store. Registers that are only read never
+  // need to be spilled back to the `State` structure.
+  bool written{false};
+
+  std::vector<StateAccess> accesses;
+
+  llvm::AllocaInst *alloca{nullptr};
+};
+
+class RegisterPromoter {
+ public:
+  RegisterPromoter(const Arch *arch_, llvm::Function *func_)
+      : arch(arch_),
+        func(func_),
+        dl(func->getParent()->getDataLayout()),
+        state_ptr(NthArgument(func, kStatePointerArgNum)) {}
+
+  unsigned Run(void);
+
+ private:
+  // Find all uses of the `State` pointer. Returns `false` if the pointer is
+  // used in a way that we can't reason about, e.g. stored to memory, or
+  // indexed with a non-constant offset.
+  bool FindAccesses(void);
+
+  // Record a load or store at `offset` in the `State` structure.
+  void AddAccess(llvm::Instruction *inst, uint64_t offset, llvm::Type *type,
+                 bool is_store);
+
+  // Prevent the promotion of every register overlapping the bytes in
+  // `[offset, offset + size)`.
+  void Pin(uint64_t offset, uint64_t size);
+
+  // Redirect all accesses of `preg` to a new `alloca`.
+  void Promote(PromotedRegister &preg, llvm::IRBuilder<> &entry_ir);
+
+  // Write the values of all written registers back into `State`.
+  void Spill(llvm::Instruction *before);
+
+  // Reload the values of all registers from `State`.
+  void Reload(llvm::Instruction *after);
+
+  const Arch *const arch;
+  llvm::Function *const func;
+  const llvm::DataLayout &dl;
+  llvm::Value *const state_ptr;
+
+  // Registers accessed within `func`, keyed by their offset in `State`. This
+  // is ordered so that the spills and reloads we produce are deterministic.
+  std::map<uint64_t, PromotedRegister> regs;
+
+  // Calls that are passed the `State` pointer, or something derived from it.
+  // These may read or write any register, so all registers must be in
+  // `State` before the call, and can be changed by the time it returns.
+  std::vector<llvm::CallInst *> calls;
+};
+
+bool RegisterPromoter::FindAccesses(void) {
+  std::vector<std::pair<llvm::Value *, uint64_t>> work_list;
+  std::unordered_set<llvm::CallInst *> seen_calls;
+  work_list.emplace_back(state_ptr, 0u);
+
+  while (!work_list.empty()) {
+    const auto [ptr, offset] = work_list.back();
+    work_list.pop_back();
+
+    for (auto &use : ptr->uses()) {
+      auto user = use.getUser();
+
+      if (auto gep = llvm::dyn_cast<llvm::GetElementPtrInst>(user)) {
+        llvm::APInt gep_offset(dl.getIndexTypeSizeInBits(gep->getType()), 0);
+        if (!gep->accumulateConstantOffset(dl, gep_offset) ||
+            gep_offset.isNegative()) {
+          return false;
+        }
+        work_list.emplace_back(gep, offset + gep_offset.getZExtValue());
+
+      } else if (auto cast = llvm::dyn_cast<llvm::BitCastInst>(user)) {
+        work_list.emplace_back(cast, offset);
+
+      } else if (auto load = llvm::dyn_cast<llvm::LoadInst>(user)) {
+        if (!load->isSimple()) {
+          return false;
+        }
+        AddAccess(load, offset, load->getType(), false);
+
+      } else if (auto store = llvm::dyn_cast<llvm::StoreInst>(user)) {
+        if (!store->isSimple() || store->getValueOperand() == ptr) {
+          return false;
+        }
+        AddAccess(store, offset, store->getValueOperand()->getType(), true);
+
+      } else if (auto call = llvm::dyn_cast<llvm::CallInst>(user)) {
+        if (seen_calls.insert(call).second) {
+          calls.push_back(call);
+        }
+
+      } else {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+void RegisterPromoter::AddAccess(llvm::Instruction *inst, uint64_t offset,
+                                 llvm::Type *type, bool is_store) {
+  const uint64_t size = dl.getTypeStoreSize(type);
+  const auto first_reg = arch->RegisterAtStateOffset(offset);
+  const auto last_reg = arch->RegisterAtStateOffset(offset + size - 1u);
+  if (!size || !first_reg || !last_reg ||
+      first_reg->EnclosingRegister() != last_reg->EnclosingRegister()) {
+    Pin(offset, size);
+    return;
+  }
+
+  const auto reg = first_reg->EnclosingRegister();
+  auto &preg = regs[reg->offset];
+  preg.reg = reg;
+  preg.written = preg.written || is_store;
+  preg.accesses.push_back({inst, offset});
+}
+
+void RegisterPromoter::Pin(uint64_t offset, uint64_t size) {
+  for (auto i = 0u; i < size; ++i) {
+    if (auto reg = arch->RegisterAtStateOffset(offset + i)) {
+      reg = reg->EnclosingRegister();
+      auto &preg = regs[reg->offset];
+      preg.reg = reg;
+      preg.promotable = false;
+    }
+  }
+}
+
+void RegisterPromoter::Promote(PromotedRegister &preg,
+                               llvm::IRBuilder<> &entry_ir) {
+  const auto reg = preg.reg;
+  preg.alloca = entry_ir.CreateAlloca(reg->type, nullptr, reg->name);
+  entry_ir.CreateStore(
+      entry_ir.CreateLoad(reg->type, reg->AddressOf(state_ptr, entry_ir)),
+      preg.alloca);
+
+  for (auto [inst, offset] : preg.accesses) {
+    llvm::Value *ptr = preg.alloca;
+    if (offset != reg->offset) {
+      llvm::IRBuilder<> ir(inst);
+      ptr = ir.CreateConstInBoundsGEP1_64(
+          llvm::Type::getInt8Ty(func->getContext()), ptr,
+          offset - reg->offset);
+    }
+
+    if (auto load = llvm::dyn_cast<llvm::LoadInst>(inst)) {
+      load->setOperand(load->getPointerOperandIndex(), ptr);
+    } else {
+      auto store = llvm::cast<llvm::StoreInst>(inst);
+      store->setOperand(store->getPointerOperandIndex(), ptr);
+    }
+  }
+}
+
+void RegisterPromoter::Spill(llvm::Instruction *before) {
+  llvm::IRBuilder<> ir(before);
+  for (auto &[offset, preg] : regs) {
+    if (preg.alloca && preg.written) {
+      const auto reg = preg.reg;
+      ir.CreateStore(ir.CreateLoad(reg->type, preg.alloca),
+                     reg->AddressOf(state_ptr, ir));
+    }
+  }
+}
+
+void RegisterPromoter::Reload(llvm::Instruction *after) {
+  llvm::IRBuilder<> ir(after->getNextNode());
+  for (auto &[offset, preg] : regs) {
+    if (preg.alloca) {
+      const auto reg = preg.reg;
+      ir.CreateStore(
+          ir.CreateLoad(reg->type, reg->AddressOf(state_ptr, ir)),
+          preg.alloca);
+    }
+  }
+}
+
+unsigned RegisterPromoter::Run(void) {
+  if (func->isDeclaration() || !FindAccesses()) {
+    return 0u;
+  }
+
+  auto &entry_block = func->getEntryBlock();
+  llvm::IRBuilder<> entry_ir(&entry_block, entry_block.getFirstInsertionPt());
+
+  unsigned num_promoted = 0u;
+  for (auto &[offset, preg] : regs) {
+    if (preg.promotable && !preg.accesses.empty()) {
+      Promote(preg, entry_ir);
+      ++num_promoted;
+    }
+  }
+
+  if (!num_promoted) {
+    return 0u;
+  }
+
+  // A call followed by a `ret`, e.g. a tail call to another trace, leaves
+  // `State` final, so don't overwrite it with stale copies.
+  std::unordered_set<llvm::Instruction *> calls_before_ret;
+  for (auto call : calls) {
+    Spill(call);
+    auto next = call->getNextNode();
+    if (llvm::isa<llvm::ReturnInst>(next)) {
+      calls_before_ret.insert(next);
+    } else {
+      CHECK(!call->isMustTailCall())
+          << "Musttail call not followed by a return in "
+          << func->getName().str();
+      Reload(call);
+    }
+  }
+
+  for (auto &block : *func) {
+    auto term = block.getTerminator();
+    if (llvm::isa<llvm::ReturnInst>(term) && !calls_before_ret.count(term)) {
+      Spill(term);
+    }
+  }
+
+  // Most registers are accessed in their entirety, and so their `alloca`s
+  // can go straight into SSA form. The rest, e.g. `W0` accesses to `X0`, are
+  // left for SROA to split up.
+  std::vector<llvm::AllocaInst *> allocas;
+  for (auto &[offset, preg] : regs) {
+    if (preg.alloca && llvm::isAllocaPromotable(preg.alloca)) {
+      allocas.push_back(preg.alloca);
+    }
+  }
+
+  if (!allocas.empty()) {
+    llvm::DominatorTree dt(*func);
+    llvm::PromoteMemToReg(allocas, dt);
+  }
+
+  return num_promoted;
+}
+
+}  // namespace
+
+// Promote the guest registers accessed through the `State` structure pointer
+// argument of the lifted function `func` into SSA values.
+unsigned PromoteStateRegisters(const Arch *arch, llvm::Function *func) {
+  return RegisterPromoter(arch, func).Run();
+}
+
+}  // namespace remill
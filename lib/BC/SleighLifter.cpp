@@ -179,7 +179,7 @@ class SleighLifter::PcodeToLLVMEmitIntoBlock {
    private:
     const sleigh::ContextRegMappings &sleigh_to_remill_reg;
     llvm::LLVMContext &context;
-    const ContextValues &context_values;
+    const DecodingContext &decoding_context;
     std::unordered_map<std::string, llvm::Value *> regptrs;
 
 
@@ -193,31 +193,33 @@ class SleighLifter::PcodeToLLVMEmitIntoBlock {
 
 
         auto maybe_reg =
-            this->sleigh_to_remill_reg.GetInternalRegMapping().find(k);
+            this->sleigh_to_remill_reg.GetInternalRegIdMapping().find(k);
 
         if (maybe_reg ==
-            this->sleigh_to_remill_reg.GetInternalRegMapping().end()) {
+            this->sleigh_to_remill_reg.GetInternalRegIdMapping().end()) {
           continue;
         }
 
-        auto maybe_value = context_values.find(maybe_reg->second);
-        if (maybe_value == context_values.end()) {
+        const auto reg_id = maybe_reg->second;
+        if (!decoding_context.HasValueForReg(reg_id)) {
           continue;
         }
 
-        builder.CreateStore(llvm::ConstantInt::get(ity, maybe_value->second),
-                            reg_ptr);
+        builder.CreateStore(
+            llvm::ConstantInt::get(ity,
+                                   decoding_context.GetContextValue(reg_id)),
+            reg_ptr);
       }
     }
 
    public:
     DecodingContextConstants(
         const sleigh::ContextRegMappings &sleigh_to_remill_reg,
-        llvm::LLVMContext &context, const ContextValues &context_values,
+        llvm::LLVMContext &context, const DecodingContext &decoding_context,
         llvm::BasicBlock *target_block)
         : sleigh_to_remill_reg(sleigh_to_remill_reg),
           context(context),
-          context_values(context_values) {
+          decoding_context(decoding_context) {
       this->PrepareEntryBlock(target_block);
     }
 
@@ -450,7 +452,10 @@ class SleighLifter::PcodeToLLVMEmitIntoBlock {
   ConstantReplacementContext replacement_cont;
 
   // Generic sleigh arch
-  std::vector<std::string> user_op_names;
+  const std::vector<std::string> &user_op_names;
+
+  // Engine that produced the p-code being lifted.
+  ::Sleigh &engine;
 
   llvm::BasicBlock *entry_block;
   llvm::BasicBlock *exit_block;
@@ -495,7 +500,8 @@ class SleighLifter::PcodeToLLVMEmitIntoBlock {
   PcodeToLLVMEmitIntoBlock(
       llvm::BasicBlock *target_block, llvm::Value *state_pointer,
       const Instruction &insn, SleighLifter &insn_lifter_parent,
-      std::vector<std::string> user_op_names_, llvm::BasicBlock *exit_block_,
+      const std::vector<std::string> &user_op_names_, ::Sleigh &engine_,
+      llvm::BasicBlock *exit_block_,
       const sleigh::MaybeBranchTakenVar &to_lift_btaken_,
       PcodeToLLVMEmitIntoBlock::DecodingContextConstants context_reg_lifter)
       : target_block(target_block),
@@ -507,6 +513,7 @@ class SleighLifter::PcodeToLLVMEmitIntoBlock {
         uniques(target_block->getContext()),
         unknown_regs(target_block->getContext()),
         user_op_names(user_op_names_),
+        engine(engine_),
         entry_block(target_block),
         exit_block(exit_block_),
         to_lift_btaken(to_lift_btaken_),
@@ -572,7 +579,7 @@ class SleighLifter::PcodeToLLVMEmitIntoBlock {
 
     auto reg_ptr = this->unknown_regs.GetUniquePtr(
         target_vnode.offset, target_vnode.size, entry_bldr);
-    print_vardata(this->insn_lifter_parent.GetEngine(), ss, target_vnode);
+    print_vardata(this->engine, ss, target_vnode);
     DLOG(ERROR) << "Creating unique for unknown register: " << ss.str() << " "
                 << reg_ptr->getName().str();
 
@@ -596,7 +603,7 @@ class SleighLifter::PcodeToLLVMEmitIntoBlock {
 
       return this->CreateMemoryAddress(constant_offset, vnode);
     } else if (space_name == "register") {
-      auto reg_name = this->insn_lifter_parent.GetEngine().getRegisterName(
+      auto reg_name = this->engine.getRegisterName(
           vnode.space, vnode.offset, vnode.size);
 
       DLOG(INFO) << "Looking for reg name " << reg_name << " from offset "
@@ -1691,9 +1698,8 @@ SleighLifter::SleighLifter(const remill::Arch &arch_,
                            const remill::sleigh::SleighDecoder &dec_,
                            const IntrinsicTable &intrinsics_)
     : InstructionLifter(&arch_, intrinsics_),
-      sleigh_context(new sleigh::SingleInstructionSleighContext(
-          dec_.GetSLAName(), dec_.GetPSpec())),
-      decoder(dec_) {}
+      decoder(dec_),
+      user_op_names(dec_.GetUserOpNames()) {}
 
 
 const std::string_view SleighLifter::kInstructionFunctionPrefix =
@@ -1741,16 +1747,13 @@ std::pair<LiftStatus, std::optional<llvm::Function *>>
 SleighLifter::LiftIntoInternalBlockWithSleighState(
     Instruction &inst, llvm::Module *target_mod, bool is_delayed,
     const sleigh::MaybeBranchTakenVar &btaken,
-    const ContextValues &context_values) {
-
-  this->sleigh_context->resetContext();
-  this->decoder.InitializeSleighContext(inst.pc, *this->sleigh_context,
-                                        context_values);
+    const DecodingContext &decoding_context,
+    const std::vector<sleigh::RemillPcodeOp> &ops, ::Sleigh &engine) {
 
-  sleigh::PcodeDecoder pcode_record(this->GetEngine());
-  sleigh_context->oneInstruction(inst.pc, pcode_record, inst.bytes);
-  for (const auto &op : pcode_record.ops) {
-    DLOG(INFO) << "Pcodeop: " << DumpPcode(this->GetEngine(), op);
+  // The p-code was recorded when `inst` was decoded under the same context, so
+  // don't decode it again.
+  for (const auto &op : ops) {
+    DLOG(INFO) << "Pcodeop: " << DumpPcode(engine, op);
   }
 
   DLOG(INFO) << "Secondary lift of bytes: " << llvm::toHex(inst.bytes);
@@ -1775,17 +1778,17 @@ SleighLifter::LiftIntoInternalBlockWithSleighState(
   // TODO(Ian): make a safe to use sleighinstruction context that wraps a context with an arch to preform reset reinits
 
 
-  auto cfg = sleigh::CreateCFG(pcode_record.ops);
+  auto cfg = sleigh::CreateCFG(ops);
 
 
   SleighLifter::PcodeToLLVMEmitIntoBlock::DecodingContextConstants
       decoding_context_lifter(this->decoder.GetContextRegisterMapping(),
-                              target_mod->getContext(), context_values,
+                              target_mod->getContext(), decoding_context,
                               target_block);
 
   SleighLifter::PcodeToLLVMEmitIntoBlock lifter(
       target_block, internal_state_pointer, inst, *this,
-      this->sleigh_context->getUserOpNames(), exit_block, btaken,
+      this->user_op_names, engine, exit_block, btaken,
       std::move(decoding_context_lifter));
 
 
@@ -1812,7 +1815,8 @@ SleighLifter::LiftIntoInternalBlockWithSleighState(
 LiftStatus SleighLifter::LiftIntoBlockWithSleighState(
     Instruction &inst, llvm::BasicBlock *block, llvm::Value *state_ptr,
     bool is_delayed, const sleigh::MaybeBranchTakenVar &btaken,
-    const ContextValues &context_values) {
+    const DecodingContext &decoding_context,
+    const std::vector<sleigh::RemillPcodeOp> &ops, ::Sleigh &engine) {
   if (!inst.IsValid()) {
     DLOG(ERROR) << "Invalid function" << inst.Serialize();
     return kLiftedInvalidInstruction;
@@ -1821,7 +1825,8 @@ LiftStatus SleighLifter::LiftIntoBlockWithSleighState(
 
   // Call the instruction function
   auto res = this->LiftIntoInternalBlockWithSleighState(
-      inst, block->getModule(), is_delayed, btaken, context_values);
+      inst, block->getModule(), is_delayed, btaken, decoding_context, ops,
+      engine);
 
   if (res.first != LiftStatus::kLiftedInstruction || !res.second.has_value()) {
     return res.first;
@@ -1848,7 +1853,7 @@ LiftStatus SleighLifter::LiftIntoBlockWithSleighState(
       intoblock_builer.CreateZExtOrTrunc(
           this->decoder.LiftPcFromCurrPc(intoblock_builer, next_pc,
                                          inst.bytes.size(),
-                                         DecodingContext(context_values)),
+                                         decoding_context),
           pc_ref_type),
       pc_ref);
 
@@ -1878,15 +1883,14 @@ LiftStatus SleighLifter::LiftIntoBlockWithSleighState(
   return res.first;
 }
 
-Sleigh &SleighLifter::GetEngine(void) const {
-  return this->sleigh_context->GetEngine();
-}
-
 SleighLifterWithState::SleighLifterWithState(
-    sleigh::MaybeBranchTakenVar btaken_, ContextValues context_values_,
+    sleigh::MaybeBranchTakenVar btaken_, DecodingContext decoding_context_,
+    std::vector<sleigh::RemillPcodeOp> ops_, ::Sleigh &engine_,
     std::shared_ptr<SleighLifter> lifter_)
     : btaken(btaken_),
-      context_values(std::move(context_values_)),
+      decoding_context(decoding_context_),
+      ops(std::move(ops_)),
+      engine(engine_),
       lifter(std::move(lifter_)) {}
 
 // Lift a single instruction into a basic block. `is_delayed` signifies that
@@ -1895,7 +1899,8 @@ LiftStatus
 SleighLifterWithState::LiftIntoBlock(Instruction &inst, llvm::BasicBlock *block,
                                      llvm::Value *state_ptr, bool is_delayed) {
   return this->lifter->LiftIntoBlockWithSleighState(
-      inst, block, state_ptr, is_delayed, this->btaken, this->context_values);
+      inst, block, state_ptr, is_delayed, this->btaken, this->decoding_context,
+      this->ops, this->engine);
 }
 
 
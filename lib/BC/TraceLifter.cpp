@@ -15,15 +15,35 @@
  */
 
 #include <glog/logging.h>
+#include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/Bitcode/BitcodeWriter.h>
+#include <llvm/IR/Constants.h>
 #include <llvm/IR/Instructions.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Metadata.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/raw_ostream.h>
+#include <llvm/Support/xxhash.h>
+#include <remill/Arch/Arch.h>
 #include <remill/Arch/Instruction.h>
 #include <remill/BC/IntrinsicTable.h>
 #include <remill/BC/TraceLifter.h>
 #include <remill/BC/Util.h>
+#include <remill/Version/Version.h>
 
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <iomanip>
 #include <map>
+#include <mutex>
 #include <set>
 #include <sstream>
+#include <thread>
+#include <typeinfo>
+#include <unordered_set>
 
 #include "InstructionLifter.h"
 
@@ -52,6 +72,24 @@ void TraceManager::ForEachDevirtualizedTarget(
   // Must be extended.
 }
 
+// Try to read up to `size` executable bytes starting at `addr`. By default
+// this goes byte-by-byte through `TryReadExecutableByte`.
+//
+// The view points into `bytes`, so the next call on this thread invalidates it.
+std::string_view TraceManager::TryReadExecutableBytes(uint64_t addr,
+                                                      size_t size) {
+  thread_local std::string bytes;
+  bytes.clear();
+  for (size_t i = 0; i < size; ++i) {
+    uint8_t byte = 0;
+    if (!TryReadExecutableByte(addr + i, &byte)) {
+      break;
+    }
+    bytes.push_back(static_cast<char>(byte));
+  }
+  return bytes;
+}
+
 // Figure out the name for the trace starting at address `addr`.
 std::string TraceManager::TraceName(uint64_t addr) {
   std::stringstream ss;
@@ -63,6 +101,29 @@ namespace {
 
 using DecoderWorkList = std::set<uint64_t>;  // For ordering.
 
+// Names of the metadata recorded in the modules of cached traces.
+static constexpr auto kCachedBytesMDName = "remill.trace_cache.bytes";
+static constexpr auto kCachedBytesHashMDName = "remill.trace_cache.bytes_hash";
+static constexpr auto kCachedHeadsMDName = "remill.trace_cache.heads";
+static constexpr auto kCachedTailCallsMDName = "remill.trace_cache.tail_calls";
+static constexpr auto kCachedDevirtMDName = "remill.trace_cache.devirt_targets";
+
+// Version of the way that traces are lifted and cached. Bump this whenever a
+// change to the lifters would change the IR of a lifted trace, so that traces
+// cached by older lifters are not reused.
+static constexpr unsigned kTraceCacheVersion = 2u;
+
+// Targets of an indirect control flow instruction, as reported by a trace
+// manager.
+using DevirtualizedTargets =
+    std::vector<std::pair<uint64_t, DevirtualizedTargetKind>>;
+
+static std::string ToHex(uint64_t val) {
+  std::stringstream ss;
+  ss << std::hex << std::setw(16) << std::setfill('0') << val;
+  return ss.str();
+}
+
 }  // namespace
 
 class TraceLifter::Impl {
@@ -74,9 +135,82 @@ class TraceLifter::Impl {
   bool Lift(uint64_t addr,
             std::function<void(uint64_t, llvm::Function *)> callback);
 
-  // Reads the bytes of an instruction at `addr` into `state.inst_bytes`.
+  // Reads the bytes of an instruction at `addr` into `inst_bytes`.
   bool ReadInstructionBytes(uint64_t addr);
 
+  // Decode the instruction in `inst_bytes` at `addr` into `inst_`, going
+  // through the decode cache if it's enabled.
+  bool DecodeInstruction(uint64_t addr, Instruction &inst_, bool is_delayed);
+
+  // Returns the lifter that lifts the decoded instruction `inst_`.
+  InstructionLifterIntf *LifterFor(const Instruction &inst_);
+
+  // Enable the on-disk cache of lifted traces.
+  bool EnableCache(std::filesystem::path dir, std::string_view options);
+
+  // Recompute `cache_key_prefix` from the lifter's current settings.
+  void UpdateCacheKey(void);
+
+  // Path of the file caching the trace at `trace_addr`.
+  std::filesystem::path CachedTracePath(uint64_t trace_addr) const;
+
+  // Hash the bytes in `trace_bytes`, along with their addresses.
+  uint64_t HashTraceBytes(void) const;
+
+  // Try to fill in the body of the declaration `func` with the cached trace
+  // at `trace_addr`. The cached trace is only used if the bytes it was lifted
+  // from can still be read, and if they, the trace heads within it, and the
+  // devirtualized targets of its indirect control flow are all unchanged.
+  bool LoadCachedTrace(uint64_t trace_addr, llvm::Function *func);
+
+  // Store the just-lifted trace `func` at `trace_addr` into the cache.
+  void StoreCachedTrace(uint64_t trace_addr, llvm::Function *func);
+
+  // Record the bytes of an instruction decoded into the current trace.
+  void AddTraceBytes(uint64_t pc, std::string_view bytes) {
+    if (!cache_dir.empty()) {
+      trace_bytes[pc] = bytes;
+    }
+  }
+
+  // Add a trace head referenced by the current trace.
+  void AddTraceHead(uint64_t pc) {
+    trace_work_list.insert(pc);
+    if (!cache_dir.empty()) {
+      trace_heads.insert(pc);
+    }
+  }
+
+  // Record whether or not the instruction at `pc` in the current trace was
+  // lifted as a tail-call to another trace.
+  void AddTailCallCheck(uint64_t pc, bool is_tail_call) {
+    if (!cache_dir.empty()) {
+      trace_tail_calls[pc] = is_tail_call;
+    }
+  }
+
+  // Record the devirtualized targets of `inst_` in the current trace.
+  void AddDevirtualizedTargets(const Instruction &inst_) {
+    if (!cache_dir.empty() && inst_.IsIndirectControlFlow()) {
+      trace_devirt_targets[inst_.pc] = GetDevirtualizedTargets(inst_);
+    }
+  }
+
+  // Returns the targets that `manager` reports for `inst_`.
+  DevirtualizedTargets GetDevirtualizedTargets(const Instruction &inst_) {
+    DevirtualizedTargets targets;
+    manager.ForEachDevirtualizedTarget(
+        inst_, [&](uint64_t target, DevirtualizedTargetKind kind) {
+          targets.emplace_back(target, kind);
+        });
+    return targets;
+  }
+
+  // Returns `true` if the code at `addr` is lifted as a call to another trace.
+  bool IsTraceHead(uint64_t addr) {
+    return GetLiftedTraceDeclaration(addr) || trace_work_list.count(addr);
+  }
+
   // Return an already lifted trace starting with the code at address
   // `addr`.
   //
@@ -137,16 +271,69 @@ class TraceLifter::Impl {
   const uint64_t addr_mask;
   TraceManager &manager;
 
+  // Lifter used to set up every lifted trace. This lives as long as the
+  // trace lifter so that its tables are reused, and its cache of register
+  // addresses is cleared whenever a new trace is started.
+  const OperandLifter::OpLifterPtr op_lifter;
+
+  // `op_lifter`, if it's a plain `InstructionLifter`. This lifts every
+  // instruction whose own lifter is also a plain `InstructionLifter`, so that
+  // the options of the trace lifter, e.g. lift templates, are set up once on
+  // a lifter that the trace lifter owns, rather than on the shared lifters
+  // that instructions carry.
+  InstructionLifter *const inst_lifter;
+
+  // Other lifters that have lifted instructions into the current trace, and
+  // whose caches have been cleared since the trace was started.
+  std::unordered_set<InstructionLifterIntf *> trace_lifters;
+
   llvm::Function *func;
   llvm::BasicBlock *block;
   llvm::SwitchInst *switch_inst;
+
+  // TODO(Ian): The trace lifter is not supporting contexts, and so decodes
+  //            every instruction with the initial context.
+  const DecodingContext initial_context;
   const size_t max_inst_bytes;
-  std::string inst_bytes;
+
+  // View of the bytes of the instruction being decoded. This is owned by
+  // `manager`, and is only valid until the next `ReadInstructionBytes`.
+  std::string_view inst_bytes;
   Instruction inst;
   Instruction delayed_inst;
   DecoderWorkList trace_work_list;
   DecoderWorkList inst_work_list;
   std::map<uint64_t, llvm::BasicBlock *> blocks;
+
+  // Directory of cached traces, or empty if caching is disabled.
+  std::filesystem::path cache_dir;
+
+  // Hash of the semantics bitcode file, and the caller's options that the
+  // cached traces depend on.
+  uint64_t cache_semantics_hash{0};
+  std::string cache_options;
+
+  // Architecture name, followed by a hash of the lifter version, the
+  // semantics bitcode file and the lifter options, which is mixed into the
+  // name of every cached trace.
+  std::string cache_key_prefix;
+
+  // Bytes decoded by, and trace heads referenced by, the trace being lifted.
+  std::map<uint64_t, std::string> trace_bytes;
+  DecoderWorkList trace_heads;
+
+  // Whether or not each instruction address in the trace being lifted was
+  // another trace's head, and the devirtualized targets of its indirect
+  // control flow instructions. These change the lifted trace without
+  // changing its bytes.
+  std::map<uint64_t, bool> trace_tail_calls;
+  std::map<uint64_t, DevirtualizedTargets> trace_devirt_targets;
+
+  // Cache of decoded instructions, or `nullptr` if it's disabled.
+  std::unique_ptr<DecodeCache> decode_cache;
+
+  // Whether or not the instruction lifters should reuse lifted operand IR.
+  bool use_lift_templates{false};
 };
 
 TraceLifter::Impl::Impl(const Arch *arch_, TraceManager *manager_)
@@ -158,14 +345,15 @@ TraceLifter::Impl::Impl(const Arch *arch_, TraceManager *manager_)
       addr_mask(arch->address_size >= 64 ? ~0ULL
                                          : (~0ULL >> arch->address_size)),
       manager(*manager_),
+      op_lifter(arch->DefaultLifter(*intrinsics)),
+      inst_lifter(op_lifter && typeid(*op_lifter) == typeid(InstructionLifter)
+                      ? static_cast<InstructionLifter *>(op_lifter.get())
+                      : nullptr),
       func(nullptr),
       block(nullptr),
       switch_inst(nullptr),
-      // TODO(Ian): The trace lfiter is not supporting contexts
-      max_inst_bytes(arch->MaxInstructionSize(arch->CreateInitialContext())) {
-
-  inst_bytes.reserve(max_inst_bytes);
-}
+      initial_context(arch->CreateInitialContext()),
+      max_inst_bytes(arch->MaxInstructionSize(initial_context)) {}
 
 // Return an already lifted trace starting with the code at address
 // `addr`.
@@ -215,21 +403,399 @@ void TraceLifter::NullCallback(uint64_t, llvm::Function *) {}
 
 // Reads the bytes of an instruction at `addr` into `inst_bytes`.
 bool TraceLifter::Impl::ReadInstructionBytes(uint64_t addr) {
-  inst_bytes.clear();
-  for (size_t i = 0; i < max_inst_bytes; ++i) {
-    const auto byte_addr = (addr + i) & addr_mask;
-    if (byte_addr < addr) {
-      break;  // 32- or 64-bit address overflow.
+  inst_bytes = {};
+  if (addr > addr_mask) {
+    return false;
+  }
+
+  // Don't read past the end of the address space.
+  auto size = max_inst_bytes;
+  if (const uint64_t max_size = addr_mask - addr; max_size < size) {
+    size = static_cast<size_t>(max_size + 1u);
+  }
+
+  inst_bytes = manager.TryReadExecutableBytes(addr, size);
+  if (inst_bytes.size() > size) {
+    inst_bytes = inst_bytes.substr(0, size);
+  }
+
+  if (inst_bytes.empty()) {
+    DLOG(WARNING) << "Couldn't read executable byte at " << std::hex << addr
+                  << std::dec;
+    return false;
+  }
+  return true;
+}
+
+// Decode the instruction in `inst_bytes` at `addr` into `inst_`.
+bool TraceLifter::Impl::DecodeInstruction(uint64_t addr, Instruction &inst_,
+                                          bool is_delayed) {
+  if (decode_cache) {
+    if (is_delayed) {
+      return decode_cache->DecodeDelayedInstruction(addr, inst_bytes, inst_,
+                                                    initial_context);
+    } else {
+      return decode_cache->DecodeInstruction(addr, inst_bytes, inst_,
+                                             initial_context);
     }
-    uint8_t byte = 0;
-    if (!manager.TryReadExecutableByte(byte_addr, &byte)) {
-      DLOG(WARNING) << "Couldn't read executable byte at " << std::hex
-                    << byte_addr << std::dec;
-      break;
+  } else if (is_delayed) {
+    return arch->DecodeDelayedInstruction(addr, inst_bytes, inst_,
+                                          initial_context);
+  } else {
+    return arch->DecodeInstruction(addr, inst_bytes, inst_, initial_context);
+  }
+}
+
+// Instructions decoded by `arch` that carry a plain `InstructionLifter` are
+// lifted by `inst_lifter` instead, which lifts them in the same way.
+InstructionLifterIntf *TraceLifter::Impl::LifterFor(const Instruction &inst_) {
+  const auto lifter = inst_.GetLifter().get();
+  if (inst_lifter &&
+      (!lifter ||
+       (inst_.arch == arch && typeid(*lifter) == typeid(InstructionLifter)))) {
+    return inst_lifter;
+  }
+  CHECK(lifter != nullptr)
+      << "No lifter for instruction " << inst_.Serialize();
+
+  // The lifter's caches may refer to another function, or to a deleted one at
+  // `func`'s address.
+  if (trace_lifters.insert(lifter).second) {
+    lifter->ClearCache();
+  }
+  return lifter;
+}
+
+void TraceLifter::EnableDecodeCache(size_t max_entries) {
+  impl->decode_cache = std::make_unique<DecodeCache>(impl->arch, max_entries);
+}
+
+DecodeCacheStats TraceLifter::GetDecodeCacheStats(void) const {
+  if (impl->decode_cache) {
+    return impl->decode_cache->Stats();
+  } else {
+    return {};
+  }
+}
+
+bool TraceLifter::EnableCache(std::filesystem::path dir,
+                              std::string_view options) {
+  return impl->EnableCache(std::move(dir), options);
+}
+
+// Only plain `InstructionLifter`s have templates.
+void TraceLifter::EnableLiftTemplates(bool enable) {
+  impl->use_lift_templates = enable;
+  if (impl->inst_lifter) {
+    impl->inst_lifter->EnableLiftTemplates(enable);
+  }
+
+  // Traces lifted with and without templates are cached apart.
+  if (!impl->cache_dir.empty()) {
+    impl->UpdateCacheKey();
+  }
+}
+
+// Enable the on-disk cache of lifted traces.
+bool TraceLifter::Impl::EnableCache(std::filesystem::path dir,
+                                    std::string_view options) {
+  const auto arch_name = GetArchName(arch->arch_name);
+  const auto sem_path = FindSemanticsBitcodeFile(arch_name);
+  if (!sem_path) {
+    LOG(ERROR) << "Cannot find path to " << arch_name
+               << " semantics bitcode file; not caching lifted traces";
+    return false;
+  }
+
+  auto sem_buf = llvm::MemoryBuffer::getFile(sem_path->string());
+  if (!sem_buf) {
+    LOG(ERROR) << "Unable to read semantics bitcode file " << *sem_path
+               << ": " << sem_buf.getError().message();
+    return false;
+  }
+
+  std::error_code ec;
+  std::filesystem::create_directories(dir, ec);
+  if (ec) {
+    LOG(ERROR) << "Unable to create trace cache directory " << dir << ": "
+               << ec.message();
+    return false;
+  }
+
+  cache_dir = std::move(dir);
+  cache_semantics_hash = llvm::xxHash64((*sem_buf)->getBuffer());
+  cache_options = options;
+  UpdateCacheKey();
+  return true;
+}
+
+// Recompute `cache_key_prefix` from the lifter's current settings.
+void TraceLifter::Impl::UpdateCacheKey(void) {
+  std::stringstream key;
+  key << kTraceCacheVersion << '.' << ToHex(cache_semantics_hash) << '.'
+      << use_lift_templates << '.' << cache_options;
+
+  // Every instruction is decoded with the initial context.
+  for (const auto &[reg_name, reg_val] : initial_context.GetContextValues()) {
+    key << '.' << reg_name << '=' << reg_val;
+  }
+
+  // NOTE: A dirty build has its base commit's hash, so bump
+  //       `kTraceCacheVersion` when changing how traces are cached.
+  if (version::HasVersionData()) {
+    key << '.' << version::GetCommitHash();
+  }
+
+  cache_key_prefix = std::string(GetArchName(arch->arch_name)) + "." +
+                     ToHex(llvm::xxHash64(key.str()));
+}
+
+// Path of the file caching the trace at `trace_addr`.
+std::filesystem::path
+TraceLifter::Impl::CachedTracePath(uint64_t trace_addr) const {
+  return cache_dir / (cache_key_prefix + "." + ToHex(trace_addr) + ".bc");
+}
+
+// Hash the bytes in `trace_bytes`, along with their addresses.
+uint64_t TraceLifter::Impl::HashTraceBytes(void) const {
+  std::string data;
+  for (const auto &[pc, bytes] : trace_bytes) {
+    data.append(reinterpret_cast<const char *>(&pc), sizeof(pc));
+    const uint64_t size = bytes.size();
+    data.append(reinterpret_cast<const char *>(&size), sizeof(size));
+    data.append(bytes);
+  }
+  return llvm::xxHash64(data);
+}
+
+// Try to fill in the body of the declaration `func` with the cached trace
+// at `trace_addr`.
+bool TraceLifter::Impl::LoadCachedTrace(uint64_t trace_addr,
+                                        llvm::Function *func) {
+  const auto path = CachedTracePath(trace_addr);
+  std::error_code ec;
+  if (!std::filesystem::exists(path, ec)) {
+    return false;
+  }
+
+  auto buf = llvm::MemoryBuffer::getFile(path.string());
+  if (!buf) {
+    return false;
+  }
+
+  // NOTE: The cached trace is parsed into its own context. Parsing it into
+  //       `context` would duplicate its named types, e.g. as `%struct.State.0`,
+  //       every time. Cloning maps them back onto the types in `module`.
+  llvm::LLVMContext cached_context;
+  auto cached_module_or =
+      llvm::parseBitcodeFile((*buf)->getMemBufferRef(), cached_context);
+  if (!cached_module_or) {
+    LOG(WARNING) << "Ignoring unreadable cached trace " << path << ": "
+                 << llvm::toString(cached_module_or.takeError());
+    return false;
+  }
+
+  auto cached_module = std::move(*cached_module_or);
+  auto cached_func = cached_module->getFunction(func->getName());
+  auto bytes_md = cached_module->getNamedMetadata(kCachedBytesMDName);
+  auto hash_md = cached_module->getNamedMetadata(kCachedBytesHashMDName);
+  auto heads_md = cached_module->getNamedMetadata(kCachedHeadsMDName);
+  auto tail_calls_md = cached_module->getNamedMetadata(kCachedTailCallsMDName);
+  auto devirt_md = cached_module->getNamedMetadata(kCachedDevirtMDName);
+  if (!cached_func || cached_func->isDeclaration() || !bytes_md || !hash_md ||
+      !heads_md || !tail_calls_md || !devirt_md ||
+      hash_md->getNumOperands() != 1u ||
+      RecontextualizeType(cached_func->getFunctionType(), context) !=
+          func->getFunctionType()) {
+    LOG(WARNING) << "Ignoring malformed cached trace " << path;
+    return false;
+  }
+
+  auto md_to_int = [](const llvm::MDOperand &op) -> uint64_t {
+    return llvm::mdconst::extract<llvm::ConstantInt>(op)->getZExtValue();
+  };
+
+  // Re-read the bytes that the cached trace was lifted from.
+  trace_bytes.clear();
+  for (auto node : bytes_md->operands()) {
+    const auto pc = md_to_int(node->getOperand(0));
+    const auto size = md_to_int(node->getOperand(1));
+    auto bytes = manager.TryReadExecutableBytes(pc, size);
+    if (bytes.size() < size) {
+      return false;
     }
-    inst_bytes.push_back(static_cast<char>(byte));
+    trace_bytes[pc] = bytes.substr(0, size);
+  }
+
+  if (HashTraceBytes() != md_to_int(hash_md->getOperand(0)->getOperand(0))) {
+    return false;
+  }
+
+  // Instructions that are now trace heads would be lifted as tail-calls, and
+  // those that no longer are would be lifted inline.
+  for (auto node : tail_calls_md->operands()) {
+    const auto pc = md_to_int(node->getOperand(0));
+    if (IsTraceHead(pc) != (md_to_int(node->getOperand(1)) != 0u)) {
+      return false;
+    }
+  }
+
+  // The manager may now know of more or fewer targets of an indirect control
+  // flow instruction.
+  for (auto node : devirt_md->operands()) {
+    const auto pc = md_to_int(node->getOperand(0));
+    DevirtualizedTargets cached_targets;
+    for (auto i = 1u; i + 1u < node->getNumOperands(); i += 2u) {
+      cached_targets.emplace_back(
+          md_to_int(node->getOperand(i)),
+          static_cast<DevirtualizedTargetKind>(
+              md_to_int(node->getOperand(i + 1u))));
+    }
+
+    Instruction cached_inst;
+    if (!ReadInstructionBytes(pc) ||
+        !DecodeInstruction(pc, cached_inst, false) ||
+        GetDevirtualizedTargets(cached_inst) != cached_targets) {
+      return false;
+    }
+  }
+
+  CloneFunctionInto(cached_func, func);
+
+  for (auto node : heads_md->operands()) {
+    trace_work_list.insert(md_to_int(node->getOperand(0)));
+  }
+
+  DLOG(INFO) << "Loaded cached trace at address " << std::hex << trace_addr
+             << std::dec << " from " << path;
+  return true;
+}
+
+// Store the just-lifted trace `func` at `trace_addr` into the cache.
+void TraceLifter::Impl::StoreCachedTrace(uint64_t trace_addr,
+                                         llvm::Function *func) {
+  llvm::Module cached_module(func->getName(), context);
+  cached_module.setDataLayout(module->getDataLayout());
+  cached_module.setTargetTriple(module->getTargetTriple());
+
+  // Semantics functions are internal, so declare them as external, even inside
+  // of constant expressions, and let them resolve by name on load.
+  std::vector<llvm::Constant *> work_list;
+  std::unordered_set<llvm::Constant *> seen;
+  for (auto &block : *func) {
+    for (auto &inst : block) {
+      for (auto &op : inst.operands()) {
+        if (auto const_op = llvm::dyn_cast<llvm::Constant>(op.get());
+            const_op && seen.insert(const_op).second) {
+          work_list.push_back(const_op);
+        }
+      }
+    }
+  }
+
+  while (!work_list.empty()) {
+    auto const_val = work_list.back();
+    work_list.pop_back();
+
+    auto gv = llvm::dyn_cast<llvm::GlobalValue>(const_val);
+    if (!gv) {
+      for (auto &op : const_val->operands()) {
+        if (auto const_op = llvm::dyn_cast<llvm::Constant>(op.get());
+            const_op && seen.insert(const_op).second) {
+          work_list.push_back(const_op);
+        }
+      }
+      continue;
+    }
+
+    if (!gv->hasLocalLinkage() || cached_module.getNamedValue(gv->getName())) {
+      continue;
+    }
+    if (auto callee = llvm::dyn_cast<llvm::Function>(gv)) {
+      llvm::Function::Create(callee->getFunctionType(),
+                             llvm::GlobalValue::ExternalLinkage,
+                             callee->getName(), &cached_module);
+    } else if (auto var = llvm::dyn_cast<llvm::GlobalVariable>(gv)) {
+      new llvm::GlobalVariable(cached_module, var->getValueType(),
+                               var->isConstant(),
+                               llvm::GlobalValue::ExternalLinkage, nullptr,
+                               var->getName());
+    }
+  }
+
+  auto cached_func =
+      arch->DeclareLiftedFunction(func->getName().str(), &cached_module);
+  CloneFunctionInto(func, cached_func);
+
+  auto i64_type = llvm::Type::getInt64Ty(context);
+  auto md_int = [=](uint64_t val) -> llvm::Metadata * {
+    return llvm::ConstantAsMetadata::get(llvm::ConstantInt::get(i64_type, val));
+  };
+
+  auto bytes_md = cached_module.getOrInsertNamedMetadata(kCachedBytesMDName);
+  for (const auto &[pc, bytes] : trace_bytes) {
+    bytes_md->addOperand(
+        llvm::MDNode::get(context, {md_int(pc), md_int(bytes.size())}));
+  }
+
+  auto hash_md = cached_module.getOrInsertNamedMetadata(kCachedBytesHashMDName);
+  hash_md->addOperand(llvm::MDNode::get(context, md_int(HashTraceBytes())));
+
+  auto heads_md = cached_module.getOrInsertNamedMetadata(kCachedHeadsMDName);
+  for (auto head : trace_heads) {
+    heads_md->addOperand(llvm::MDNode::get(context, md_int(head)));
+  }
+
+  auto tail_calls_md =
+      cached_module.getOrInsertNamedMetadata(kCachedTailCallsMDName);
+  for (auto [pc, is_tail_call] : trace_tail_calls) {
+    tail_calls_md->addOperand(
+        llvm::MDNode::get(context, {md_int(pc), md_int(is_tail_call)}));
+  }
+
+  auto devirt_md = cached_module.getOrInsertNamedMetadata(kCachedDevirtMDName);
+  for (const auto &[pc, targets] : trace_devirt_targets) {
+    llvm::SmallVector<llvm::Metadata *, 8> ops = {md_int(pc)};
+    for (auto [target, kind] : targets) {
+      ops.push_back(md_int(target));
+      ops.push_back(md_int(static_cast<uint64_t>(kind)));
+    }
+    devirt_md->addOperand(llvm::MDNode::get(context, ops));
+  }
+
+  // Write to a unique temporary file and rename it, so that other lifters never
+  // see a partial trace.
+  const auto path = CachedTracePath(trace_addr);
+  int tmp_fd = -1;
+  llvm::SmallString<128> tmp_path;
+  if (auto ec = llvm::sys::fs::createUniqueFile(
+          path.string() + ".tmp-%%%%%%%%", tmp_fd, tmp_path)) {
+    LOG(WARNING) << "Unable to cache trace at address " << std::hex
+                 << trace_addr << std::dec << " to " << path << ": "
+                 << ec.message();
+    return;
+  }
+
+  {
+    llvm::raw_fd_ostream tmp_stream(tmp_fd, true /* shouldClose */);
+    llvm::WriteBitcodeToFile(cached_module, tmp_stream);
+    tmp_stream.flush();
+    if (tmp_stream.has_error()) {
+      LOG(WARNING) << "Unable to cache trace at address " << std::hex
+                   << trace_addr << std::dec << " to " << path << ": "
+                   << tmp_stream.error().message();
+      tmp_stream.clear_error();
+      llvm::sys::fs::remove(tmp_path);
+      return;
+    }
+  }
+
+  if (auto ec = llvm::sys::fs::rename(tmp_path, path.string())) {
+    LOG(WARNING) << "Unable to cache trace at address " << std::hex
+                 << trace_addr << std::dec << " to " << path << ": "
+                 << ec.message();
+    llvm::sys::fs::remove(tmp_path);
   }
-  return !inst_bytes.empty();
 }
 
 // Lift one or more traces starting from `addr`.
@@ -245,7 +811,7 @@ bool TraceLifter::Impl::Lift(
   trace_work_list.clear();
   inst_work_list.clear();
   blocks.clear();
-  inst_bytes.clear();
+  inst_bytes = {};
   func = nullptr;
   switch_inst = nullptr;
   block = nullptr;
@@ -286,6 +852,17 @@ bool TraceLifter::Impl::Lift(
 
     CHECK(func->isDeclaration());
 
+    trace_bytes.clear();
+    trace_heads.clear();
+    trace_tail_calls.clear();
+    trace_devirt_targets.clear();
+    if (!cache_dir.empty() && LoadCachedTrace(trace_addr, func)) {
+      callback(trace_addr, func);
+      manager.SetLiftedTraceDefinition(trace_addr, func);
+      continue;
+    }
+    trace_bytes.clear();
+
     // Fill in the function, and make sure the block with all register
     // variables jumps to the block that will contain the first instruction
     // of the trace.
@@ -293,11 +870,15 @@ bool TraceLifter::Impl::Lift(
 
     auto state_ptr = NthArgument(func, kStatePointerArgNum);
 
+    // `func` may reuse a deleted function's address, so clear the lifter's
+    // caches explicitly. `LifterFor` clears the others.
+    op_lifter->ClearCache();
+    trace_lifters.clear();
+
     if (auto entry_block = &(func->front())) {
       auto pc = LoadProgramCounterArg(func);
-      auto [next_pc_ref, next_pc_ref_type] =
-          this->arch->DefaultLifter(*this->intrinsics)
-              ->LoadRegAddress(entry_block, state_ptr, kNextPCVariableName);
+      auto [next_pc_ref, next_pc_ref_type] = op_lifter->LoadRegAddress(
+          entry_block, state_ptr, kNextPCVariableName);
 
       // Initialize `NEXT_PC`.
       (void) new llvm::StoreInst(pc, next_pc_ref, entry_block);
@@ -325,7 +906,9 @@ bool TraceLifter::Impl::Lift(
       // trace head, and if so, tail-call into that trace directly without
       // decoding or lifting the instruction.
       if (inst_addr != trace_addr) {
-        if (auto inst_as_trace = get_trace_decl(inst_addr)) {
+        auto inst_as_trace = get_trace_decl(inst_addr);
+        AddTailCallCheck(inst_addr, inst_as_trace != nullptr);
+        if (inst_as_trace) {
           AddTerminatingTailCall(block, inst_as_trace, *intrinsics);
           continue;
         }
@@ -339,12 +922,17 @@ bool TraceLifter::Impl::Lift(
 
       inst.Reset();
 
-      // TODO(Ian): not passing context around in trace lifter
-      std::ignore = arch->DecodeInstruction(inst_addr, inst_bytes, inst,
-                                            this->arch->CreateInitialContext());
+      const auto decoded = DecodeInstruction(inst_addr, inst, false);
+
+      // What's lifted for an undecodable instruction may depend on every byte
+      // read.
+      AddTraceBytes(inst_addr, decoded ? inst.bytes : inst_bytes);
+      if (decoded) {
+        AddDevirtualizedTargets(inst);
+      }
 
       auto lift_status =
-          inst.GetLifter()->LiftIntoBlock(inst, block, state_ptr);
+          LifterFor(inst)->LiftIntoBlock(inst, block, state_ptr);
       if (kLiftedInstruction != lift_status) {
         AddTerminatingTailCall(block, intrinsics->error, *intrinsics);
         continue;
@@ -355,14 +943,13 @@ bool TraceLifter::Impl::Lift(
       if (try_delay) {
         delayed_inst.Reset();
         if (!ReadInstructionBytes(inst.delayed_pc) ||
-            !arch->DecodeDelayedInstruction(
-                inst.delayed_pc, inst_bytes, delayed_inst,
-                this->arch->CreateInitialContext())) {
+            !DecodeInstruction(inst.delayed_pc, delayed_inst, true)) {
           LOG(ERROR) << "Couldn't read delayed inst "
                      << delayed_inst.Serialize();
           AddTerminatingTailCall(block, intrinsics->error, *intrinsics);
           continue;
         }
+        AddTraceBytes(inst.delayed_pc, delayed_inst.bytes);
       }
 
       // Functor used to add in a delayed instruction.
@@ -375,8 +962,9 @@ bool TraceLifter::Impl::Lift(
                                             on_branch_taken_path)) {
           return;
         }
-        lift_status = delayed_inst.GetLifter()->LiftIntoBlock(
-            delayed_inst, into_block, state_ptr, true /* is_delayed */);
+        lift_status = LifterFor(delayed_inst)
+                          ->LiftIntoBlock(delayed_inst, into_block, state_ptr,
+                                          true /* is_delayed */);
         if (kLiftedInstruction != lift_status) {
           AddTerminatingTailCall(block, intrinsics->error, *intrinsics);
         }
@@ -478,7 +1066,7 @@ bool TraceLifter::Impl::Lift(
         direct_func_call:
           try_add_delay_slot(true, block);
           if (inst.branch_not_taken_pc != inst.branch_taken_pc) {
-            trace_work_list.insert(inst.branch_taken_pc);
+            AddTraceHead(inst.branch_taken_pc);
             auto target_trace = get_trace_decl(inst.branch_taken_pc);
             AddCall(block, target_trace, *intrinsics);
           }
@@ -517,7 +1105,7 @@ bool TraceLifter::Impl::Lift(
           llvm::BranchInst::Create(taken_block, not_taken_block,
                                    LoadBranchTaken(block), block);
 
-          trace_work_list.insert(inst.branch_taken_pc);
+          AddTraceHead(inst.branch_taken_pc);
           auto target_trace = get_trace_decl(inst.branch_taken_pc);
 
           AddCall(taken_block, intrinsics->function_call, *intrinsics);
@@ -659,6 +1247,10 @@ bool TraceLifter::Impl::Lift(
       }
     }
 
+    if (!cache_dir.empty()) {
+      StoreCachedTrace(trace_addr, func);
+    }
+
     callback(trace_addr, func);
     manager.SetLiftedTraceDefinition(trace_addr, func);
   }
@@ -666,4 +1258,419 @@ bool TraceLifter::Impl::Lift(
   return true;
 }
 
+namespace {
+
+// Trace heads that have been claimed by some worker of a
+// `ParallelTraceLifter`. A trace head is claimed when it is first queued, and
+// whichever worker pops or steals it from a queue is the only one that will
+// lift it; every other worker will reference it by declaration.
+class TraceClaims {
+ public:
+  bool TryClaim(uint64_t addr) {
+    std::lock_guard<std::mutex> locker(lock);
+    return claimed.insert(addr).second;
+  }
+
+ private:
+  std::mutex lock;
+  std::unordered_set<uint64_t> claimed;
+};
+
+// A queue of trace heads belonging to one worker. Workers pop from the front
+// of their own queue, and steal from the back of other workers' queues.
+class TraceHeadQueue {
+ public:
+  void Push(uint64_t addr) {
+    std::lock_guard<std::mutex> locker(lock);
+    heads.push_back(addr);
+  }
+
+  bool PopFront(uint64_t *addr) {
+    std::lock_guard<std::mutex> locker(lock);
+    if (heads.empty()) {
+      return false;
+    }
+    *addr = heads.front();
+    heads.pop_front();
+    return true;
+  }
+
+  bool StealBack(uint64_t *addr) {
+    std::lock_guard<std::mutex> locker(lock);
+    if (heads.empty()) {
+      return false;
+    }
+    *addr = heads.back();
+    heads.pop_back();
+    return true;
+  }
+
+ private:
+  std::mutex lock;
+  std::deque<uint64_t> heads;
+};
+
+// The trace manager used by a single worker of a `ParallelTraceLifter`. It
+// forwards to the user's trace manager, and makes sure that each trace is
+// only lifted by the worker that claimed it.
+class ShardTraceManager final : public TraceManager {
+ public:
+  ShardTraceManager(const Arch *arch_, llvm::Module *module_,
+                    TraceManager &manager_, std::mutex &manager_lock_,
+                    TraceClaims &claims_,
+                    std::function<void(uint64_t)> enqueue_)
+      : arch(arch_),
+        module(module_),
+        manager(manager_),
+        manager_lock(manager_lock_),
+        claims(claims_),
+        enqueue(std::move(enqueue_)) {}
+
+  std::string TraceName(uint64_t addr) final {
+    return manager.TraceName(addr);
+  }
+
+  void SetLiftedTraceDefinition(uint64_t addr,
+                                llvm::Function *lifted_func) final {
+    traces[addr] = lifted_func;
+  }
+
+  // Returns `nullptr` only if this worker should lift the trace at `addr`,
+  // i.e. if `addr` is the trace head that this worker took from a queue.
+  // Otherwise returns a declaration within `module`; these declarations are
+  // resolved when the workers' modules are merged.
+  //
+  // Queue newly found trace heads instead of lifting them here, so that idle
+  // workers can steal them.
+  llvm::Function *GetLiftedTraceDefinition(uint64_t addr) final {
+    if (auto trace_it = traces.find(addr); trace_it != traces.end()) {
+      return trace_it->second;
+    }
+
+    if (addr == root) {
+      return nullptr;
+    }
+
+    bool lifted_elsewhere = false;
+    {
+      std::lock_guard<std::mutex> locker(manager_lock);
+      lifted_elsewhere = manager.GetLiftedTraceDefinition(addr) != nullptr;
+    }
+
+    if (!lifted_elsewhere && claims.TryClaim(addr)) {
+      enqueue(addr);
+    }
+
+    const auto name = TraceName(addr);
+    if (auto func = module->getFunction(name)) {
+      return func;
+    }
+    return arch->DeclareLiftedFunction(name, module);
+  }
+
+  void ForEachDevirtualizedTarget(
+      const Instruction &inst,
+      std::function<void(uint64_t, DevirtualizedTargetKind)> func) final {
+    std::lock_guard<std::mutex> locker(manager_lock);
+    manager.ForEachDevirtualizedTarget(inst, std::move(func));
+  }
+
+  bool TryReadExecutableByte(uint64_t addr, uint8_t *byte) final {
+    return manager.TryReadExecutableByte(addr, byte);
+  }
+
+  std::string_view TryReadExecutableBytes(uint64_t addr, size_t size) final {
+    return manager.TryReadExecutableBytes(addr, size);
+  }
+
+  const Arch *const arch;
+  llvm::Module *const module;
+  TraceManager &manager;
+  std::mutex &manager_lock;
+  TraceClaims &claims;
+
+  // Queues a newly claimed trace head.
+  const std::function<void(uint64_t)> enqueue;
+
+  // The trace head that this worker is currently lifting.
+  uint64_t root{0};
+
+  // Traces lifted by this worker since the last merge.
+  std::map<uint64_t, llvm::Function *> traces;
+};
+
+// Everything owned by one worker of a `ParallelTraceLifter`. The order of
+// the fields matters: the module and arch must be destroyed before the
+// context that they belong to.
+struct TraceLifterShard {
+  llvm::LLVMContext context;
+  Arch::ArchPtr arch;
+  std::unique_ptr<llvm::Module> module;
+  std::unique_ptr<ShardTraceManager> manager;
+  std::unique_ptr<TraceLifter> lifter;
+};
+
+}  // namespace
+
+class ParallelTraceLifter::Impl {
+ public:
+  Impl(const Arch *arch_, TraceManager *manager_, unsigned num_workers_);
+
+  // Lift all traces reachable from `addrs`.
+  bool Lift(const std::vector<uint64_t> &addrs,
+            std::function<void(uint64_t, llvm::Function *)> callback);
+
+  // Create the context, arch, and semantics module of the `worker_index`th
+  // worker.
+  std::unique_ptr<TraceLifterShard> CreateShard(unsigned worker_index);
+
+  // Body of the `worker_index`th worker thread.
+  void RunWorker(unsigned worker_index);
+
+  // Queue the claimed trace head `addr` onto the `worker_index`th queue.
+  void Enqueue(unsigned worker_index, uint64_t addr);
+
+  // Move the traces lifted by `shard` into `module`.
+  void MergeShard(
+      TraceLifterShard &shard,
+      const std::function<void(uint64_t, llvm::Function *)> &callback);
+
+  const Arch *const arch;
+  llvm::Module *const module;
+  TraceManager &manager;
+  const unsigned num_workers;
+
+  // Directory of cached traces shared by the workers, or empty, and the
+  // caller's options that the cached traces depend on.
+  std::filesystem::path cache_dir;
+  std::string cache_options;
+
+  // Number of entries in each worker's decode cache, or zero if the decode
+  // caches are disabled.
+  size_t decode_cache_size{0};
+
+  // Whether or not the workers should reuse lifted operand IR.
+  bool use_lift_templates{false};
+
+  std::mutex manager_lock;
+  TraceClaims claims;
+  std::vector<TraceHeadQueue> queues;
+  std::vector<std::unique_ptr<TraceLifterShard>> shards;
+
+  // Number of queued trace heads that haven't yet been lifted. Workers stop
+  // once this reaches zero; until then, a worker that is still lifting may
+  // queue more trace heads.
+  std::atomic<size_t> num_pending{0};
+};
+
+ParallelTraceLifter::Impl::Impl(const Arch *arch_, TraceManager *manager_,
+                                unsigned num_workers_)
+    : arch(arch_),
+      module(arch->GetInstrinsicTable()->async_hyper_call->getParent()),
+      manager(*manager_),
+      num_workers(num_workers_ ? num_workers_
+                               : std::max(1u,
+                                          std::thread::hardware_concurrency())),
+      queues(num_workers),
+      shards(num_workers) {}
+
+std::unique_ptr<TraceLifterShard>
+ParallelTraceLifter::Impl::CreateShard(unsigned worker_index) {
+  auto shard = std::make_unique<TraceLifterShard>();
+  shard->arch = Arch::Build(&(shard->context), arch->os_name, arch->arch_name);
+  CHECK(shard->arch != nullptr)
+      << "Unable to build architecture for parallel lifting worker";
+
+  // Traces are cloned into a module with its own semantics, so the bodies of
+  // the worker's semantics are never needed.
+  shard->module = LoadArchSemanticsLazily(shard->arch.get());
+  shard->manager = std::make_unique<ShardTraceManager>(
+      shard->arch.get(), shard->module.get(), manager, manager_lock, claims,
+      [=](uint64_t addr) { Enqueue(worker_index, addr); });
+  shard->lifter =
+      std::make_unique<TraceLifter>(shard->arch.get(), *shard->manager);
+  if (!cache_dir.empty()) {
+    shard->lifter->EnableCache(cache_dir, cache_options);
+  }
+  if (decode_cache_size) {
+    shard->lifter->EnableDecodeCache(decode_cache_size);
+  }
+  shard->lifter->EnableLiftTemplates(use_lift_templates);
+  return shard;
+}
+
+void ParallelTraceLifter::Impl::Enqueue(unsigned worker_index,
+                                        uint64_t addr) {
+  num_pending.fetch_add(1u);
+  queues[worker_index].Push(addr);
+}
+
+void ParallelTraceLifter::Impl::RunWorker(unsigned worker_index) {
+  auto &shard = shards[worker_index];
+  if (!shard) {
+    shard = CreateShard(worker_index);
+  }
+
+  auto next_trace_head = [=](uint64_t *addr) -> bool {
+    if (queues[worker_index].PopFront(addr)) {
+      return true;
+    }
+    for (auto i = 1u; i < num_workers; ++i) {
+      if (queues[(worker_index + i) % num_workers].StealBack(addr)) {
+        return true;
+      }
+    }
+    return false;
+  };
+
+  // A busy worker may still queue more heads, so keep looking until every
+  // queued head is lifted.
+  while (num_pending.load()) {
+    uint64_t addr = 0;
+    if (!next_trace_head(&addr)) {
+      std::this_thread::yield();
+      continue;
+    }
+
+    // NOTE: No lock is needed. Each worker has its own `Arch`, SLEIGH engines
+    //       are borrowed from a pool per decode, and `ShardTraceManager`
+    //       serializes calls into the user's `TraceManager`.
+    shard->manager->root = addr;
+    shard->lifter->Lift(addr);
+    num_pending.fetch_sub(1u);
+  }
+}
+
+void ParallelTraceLifter::Impl::MergeShard(
+    TraceLifterShard &shard,
+    const std::function<void(uint64_t, llvm::Function *)> &callback) {
+  for (auto [trace_addr, shard_func] : shard.manager->traces) {
+    const auto name = shard_func->getName().str();
+    auto func = module->getFunction(name);
+    if (!func) {
+      func = arch->DeclareLiftedFunction(name, module);
+    }
+
+    if (!func->isDeclaration()) {
+      LOG(ERROR) << "Trace " << name << " at " << std::hex << trace_addr
+                 << std::dec << " was lifted more than once";
+      continue;
+    }
+
+    CloneFunctionInto(shard_func, func);
+
+    // Leave a declaration behind so that traces lifted by this worker in
+    // future calls to `Lift` can still reference this trace.
+    shard_func->deleteBody();
+
+    callback(trace_addr, func);
+    manager.SetLiftedTraceDefinition(trace_addr, func);
+  }
+  shard.manager->traces.clear();
+}
+
+bool ParallelTraceLifter::Impl::Lift(
+    const std::vector<uint64_t> &addrs,
+    std::function<void(uint64_t, llvm::Function *)> callback) {
+
+  // Distribute the trace heads round-robin; imbalances are corrected by
+  // work stealing.
+  auto i = 0u;
+  for (auto addr : addrs) {
+    {
+      std::lock_guard<std::mutex> locker(manager_lock);
+      if (manager.GetLiftedTraceDefinition(addr)) {
+        continue;
+      }
+    }
+    if (claims.TryClaim(addr)) {
+      Enqueue(i++ % num_workers, addr);
+    }
+  }
+
+  std::vector<std::thread> workers;
+  workers.reserve(num_workers);
+  for (auto worker_index = 0u; worker_index < num_workers; ++worker_index) {
+    workers.emplace_back(&Impl::RunWorker, this, worker_index);
+  }
+  for (auto &worker : workers) {
+    worker.join();
+  }
+
+  // Merge on this thread, after all workers have finished, as it touches
+  // both the workers' contexts and the destination context.
+  for (auto &shard : shards) {
+    if (shard) {
+      MergeShard(*shard, callback);
+    }
+  }
+
+  return true;
+}
+
+ParallelTraceLifter::~ParallelTraceLifter(void) {}
+
+ParallelTraceLifter::ParallelTraceLifter(const Arch *arch_,
+                                         TraceManager *manager_,
+                                         unsigned num_workers_)
+    : impl(new Impl(arch_, manager_, num_workers_)) {}
+
+// Share a cache of lifted traces in `dir` between all of the workers.
+bool ParallelTraceLifter::EnableCache(std::filesystem::path dir,
+                                      std::string_view options) {
+  std::error_code ec;
+  std::filesystem::create_directories(dir, ec);
+  if (ec) {
+    LOG(ERROR) << "Unable to create trace cache directory " << dir << ": "
+               << ec.message();
+    return false;
+  }
+  for (auto &shard : impl->shards) {
+    if (shard) {
+      shard->lifter->EnableCache(dir, options);
+    }
+  }
+  impl->cache_dir = std::move(dir);
+  impl->cache_options = options;
+  return true;
+}
+
+// Give each of the workers its own decode cache.
+void ParallelTraceLifter::EnableDecodeCache(size_t max_entries) {
+  for (auto &shard : impl->shards) {
+    if (shard) {
+      shard->lifter->EnableDecodeCache(max_entries);
+    }
+  }
+  impl->decode_cache_size = max_entries;
+}
+
+// Have each of the workers reuse lifted operand IR.
+void ParallelTraceLifter::EnableLiftTemplates(bool enable) {
+  for (auto &shard : impl->shards) {
+    if (shard) {
+      shard->lifter->EnableLiftTemplates(enable);
+    }
+  }
+  impl->use_lift_templates = enable;
+}
+
+// Counters of the decode caches of all of the workers, added together.
+DecodeCacheStats ParallelTraceLifter::GetDecodeCacheStats(void) const {
+  DecodeCacheStats stats;
+  for (auto &shard : impl->shards) {
+    if (shard) {
+      stats += shard->lifter->GetDecodeCacheStats();
+    }
+  }
+  return stats;
+}
+
+// Lift all traces reachable from `addrs`.
+bool ParallelTraceLifter::Lift(
+    const std::vector<uint64_t> &addrs,
+    std::function<void(uint64_t, llvm::Function *)> callback) {
+  return impl->Lift(addrs, callback);
+}
+
 }  // namespace remill
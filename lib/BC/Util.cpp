@@ -21,6 +21,7 @@
 #include <sstream>
 #include <system_error>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -43,6 +44,7 @@
 #include <llvm/IR/Module.h>
 #include <llvm/IR/Verifier.h>
 #include <llvm/IRReader/IRReader.h>
+#include <llvm/Support/Error.h>
 #include <llvm/Support/FileSystem.h>
 #include <llvm/Support/SourceMgr.h>
 #include <llvm/Support/ToolOutputFile.h>
@@ -399,9 +401,12 @@ std::unique_ptr<llvm::Module> LoadArchSemantics(const Arch *arch) {
   return LoadArchSemantics(arch, {});
 }
 
-std::unique_ptr<llvm::Module>
+namespace {
+
+static std::unique_ptr<llvm::Module>
 LoadArchSemantics(const Arch *arch,
-                  const std::vector<std::filesystem::path> &sem_dirs) {
+                  const std::vector<std::filesystem::path> &sem_dirs,
+                  bool lazy) {
   auto arch_name = GetArchName(arch->arch_name);
 
   // If `sem_dirs` does not contain the dir, fallback to compiled in paths.
@@ -415,15 +420,145 @@ LoadArchSemantics(const Arch *arch,
                << " semantics bitcode file.";
 
   DLOG(INFO) << "Loading " << arch_name << " semantics from file " << *path;
-  auto module = LoadModuleFromFile(arch->context, *path);
+  std::unique_ptr<llvm::Module> module;
+  if (lazy) {
+    llvm::SMDiagnostic err;
+    module = llvm::getLazyIRFileModule(path->string(), err, *arch->context);
+    if (!module) {
+      LOG(FATAL) << "Unable to parse module file " << *path << ": "
+                 << err.getMessage().str();
+    }
+  } else {
+    module = LoadModuleFromFile(arch->context, *path);
+  }
+
   arch->PrepareModule(module);
   arch->InitFromSemanticsModule(module.get());
+
+  // This doesn't materialize lazily loaded functions, and the annotations
+  // survive materialization.
   for (auto &func : *module) {
     Annotate<remill::Semantics>(&func);
   }
   return module;
 }
 
+}  // namespace
+
+std::unique_ptr<llvm::Module>
+LoadArchSemantics(const Arch *arch,
+                  const std::vector<std::filesystem::path> &sem_dirs) {
+  return LoadArchSemantics(arch, sem_dirs, false);
+}
+
+std::unique_ptr<llvm::Module> LoadArchSemanticsLazily(const Arch *arch) {
+  return LoadArchSemanticsLazily(arch, {});
+}
+
+std::unique_ptr<llvm::Module>
+LoadArchSemanticsLazily(const Arch *arch,
+                        const std::vector<std::filesystem::path> &sem_dirs) {
+  return LoadArchSemantics(arch, sem_dirs, true);
+}
+
+// Materialize the bodies of all functions that are reachable from functions
+// with bodies in a lazily loaded `module`, and drop the rest.
+bool MaterializeUsedFunctions(llvm::Module *module) {
+  std::vector<llvm::Function *> work_list;
+  auto is_lazy = false;
+  for (auto &func : *module) {
+    if (func.isMaterializable()) {
+      is_lazy = true;
+    } else if (!func.isDeclaration()) {
+      work_list.push_back(&func);
+    }
+  }
+
+  if (!is_lazy) {
+    return true;
+  }
+
+  std::unordered_set<llvm::Function *> seen_funcs(work_list.begin(),
+                                                  work_list.end());
+  std::unordered_set<llvm::Constant *> seen_consts;
+  std::vector<llvm::Constant *> const_work_list;
+
+  // Find the functions referenced by `val`, looking through constant
+  // expressions, aggregates, and the initializers of global variables.
+  auto visit = [&](llvm::Value *val) {
+    auto c = llvm::dyn_cast<llvm::Constant>(val);
+    if (!c || llvm::isa<llvm::ConstantData>(c)) {
+      return;
+    }
+    const_work_list.push_back(c);
+    while (!const_work_list.empty()) {
+      c = const_work_list.back();
+      const_work_list.pop_back();
+      if (!seen_consts.insert(c).second) {
+        continue;
+      }
+
+      if (auto func = llvm::dyn_cast<llvm::Function>(c)) {
+        if (seen_funcs.insert(func).second) {
+          work_list.push_back(func);
+        }
+      } else if (auto gv = llvm::dyn_cast<llvm::GlobalVariable>(c)) {
+        if (gv->hasInitializer()) {
+          const_work_list.push_back(gv->getInitializer());
+        }
+      } else if (auto ga = llvm::dyn_cast<llvm::GlobalAlias>(c)) {
+        const_work_list.push_back(ga->getAliasee());
+      } else if (!llvm::isa<llvm::ConstantData>(c)) {
+        for (auto &op : c->operands()) {
+          if (auto op_c = llvm::dyn_cast<llvm::Constant>(op.get())) {
+            const_work_list.push_back(op_c);
+          }
+        }
+      }
+    }
+  };
+
+  auto num_materialized = 0u;
+  while (!work_list.empty()) {
+    auto func = work_list.back();
+    work_list.pop_back();
+
+    if (func->isMaterializable()) {
+      if (auto err = func->materialize()) {
+        LOG(ERROR) << "Unable to materialize function " << func->getName().str()
+                   << ": " << llvm::toString(std::move(err));
+        return false;
+      }
+      ++num_materialized;
+    }
+
+    if (func->hasPersonalityFn()) {
+      visit(func->getPersonalityFn());
+    }
+    for (auto &block : *func) {
+      for (auto &inst : block) {
+        for (auto &op : inst.operands()) {
+          visit(op.get());
+        }
+      }
+    }
+  }
+
+  // Everything left over is unused, so avoid reading it at all.
+  auto num_dropped = 0u;
+  for (auto &func : *module) {
+    if (func.isMaterializable()) {
+      func.deleteBody();
+      ++num_dropped;
+    }
+  }
+
+  DLOG(INFO) << "Materialized " << num_materialized << " and dropped "
+             << num_dropped << " functions of module "
+             << module->getName().str();
+  return true;
+}
+
 std::optional<std::string> VerifyModuleMsg(llvm::Module *module) {
   std::string error;
   llvm::raw_string_ostream error_stream(error);
@@ -811,6 +946,84 @@ static llvm::Constant *CloneConstant(llvm::Constant *val) {
 
 #endif
 
+static llvm::Type *RecontextualizeType(llvm::Type *type,
+                                       llvm::LLVMContext &context,
+                                       TypeMap &cache);
+
+// Returns `true` if `struct_type` has the same body as `existing`, once it is
+// moved into the context of `existing`.
+static bool IsSameStructure(llvm::StructType *struct_type,
+                            llvm::StructType *existing, TypeMap &cache) {
+  if (struct_type->isOpaque() || existing->isOpaque()) {
+    return struct_type->isOpaque() == existing->isOpaque();
+  }
+
+  if (struct_type->isPacked() != existing->isPacked() ||
+      struct_type->getNumElements() != existing->getNumElements()) {
+    return false;
+  }
+
+  auto &context = existing->getContext();
+  for (auto i = 0u; i < struct_type->getNumElements(); ++i) {
+    if (RecontextualizeType(struct_type->getElementType(i), context, cache) !=
+        existing->getElementType(i)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Get an instance of `attrs` that belongs to `context`.
+static llvm::AttributeSet RecontextualizeAttributes(llvm::AttributeSet attrs,
+                                                    llvm::LLVMContext &context,
+                                                    TypeMap &cache) {
+  llvm::AttrBuilder builder(context);
+  for (auto attr : attrs) {
+    if (attr.isStringAttribute()) {
+      builder.addAttribute(attr.getKindAsString(), attr.getValueAsString());
+    } else if (attr.isTypeAttribute()) {
+      builder.addTypeAttr(
+          attr.getKindAsEnum(),
+          RecontextualizeType(attr.getValueAsType(), context, cache));
+    } else if (attr.isIntAttribute()) {
+      builder.addRawIntAttr(attr.getKindAsEnum(), attr.getValueAsInt());
+#if LLVM_VERSION_MAJOR >= 19
+    } else if (attr.isConstantRangeAttribute()) {
+      builder.addConstantRangeAttr(attr.getKindAsEnum(),
+                                   attr.getValueAsConstantRange());
+#endif  // LLVM_VERSION_MAJOR
+#if LLVM_VERSION_MAJOR >= 20
+    } else if (attr.isConstantRangeListAttribute()) {
+      builder.addConstantRangeListAttr(attr.getKindAsEnum(),
+                                       attr.getValueAsConstantRangeList());
+#endif  // LLVM_VERSION_MAJOR
+    } else {
+      builder.addAttribute(attr.getKindAsEnum());
+    }
+  }
+  return llvm::AttributeSet::get(context, builder);
+}
+
+// Get an instance of `attrs` that belongs to `context`.
+static llvm::AttributeList RecontextualizeAttributes(llvm::AttributeList attrs,
+                                                     llvm::LLVMContext &context,
+                                                     TypeMap &cache) {
+  if (attrs.isEmpty()) {
+    return {};
+  }
+
+  llvm::SmallVector<llvm::AttributeSet, 8> arg_attrs;
+  for (auto i = 0u; i < attrs.getNumAttrSets() - 2u; ++i) {
+    arg_attrs.push_back(
+        RecontextualizeAttributes(attrs.getParamAttrs(i), context, cache));
+  }
+
+  return llvm::AttributeList::get(
+      context, RecontextualizeAttributes(attrs.getFnAttrs(), context, cache),
+      RecontextualizeAttributes(attrs.getRetAttrs(), context, cache),
+      arg_attrs);
+}
+
 static llvm::Function *DeclareFunctionInModule(llvm::Function *func,
                                                llvm::Module *dest_module,
                                                ValueMap &value_map) {
@@ -822,9 +1035,9 @@ static llvm::Function *DeclareFunctionInModule(llvm::Function *func,
 
   auto dest_func = dest_module->getFunction(func->getName());
   if (dest_func) {
-    CHECK_EQ(
-        RecontextualizeType(func->getFunctionType(), dest_module->getContext()),
-        dest_func->getFunctionType());
+    CHECK_EQ(::remill::RecontextualizeType(func->getFunctionType(),
+                                           dest_module->getContext()),
+             dest_func->getFunctionType());
 
     moved_func = dest_func;
     return dest_func;
@@ -835,12 +1048,18 @@ static llvm::Function *DeclareFunctionInModule(llvm::Function *func,
       << " as external in another module";
 
   const auto func_type = llvm::dyn_cast<llvm::FunctionType>(
-      RecontextualizeType(func->getFunctionType(), dest_module->getContext()));
+      ::remill::RecontextualizeType(func->getFunctionType(),
+                                    dest_module->getContext()));
 
   dest_func = llvm::Function::Create(func_type, func->getLinkage(),
                                      func->getName(), dest_module);
 
   dest_func->copyAttributesFrom(func);
+  if (&(func->getContext()) != &(dest_module->getContext())) {
+    TypeMap type_map;
+    dest_func->setAttributes(RecontextualizeAttributes(
+        func->getAttributes(), dest_module->getContext(), type_map));
+  }
   dest_func->setVisibility(func->getVisibility());
   dest_func->setCallingConv(func->getCallingConv());
   if (func->hasSection()) {
@@ -915,6 +1134,19 @@ static llvm::Type *RecontextualizeType(llvm::Type *type,
 
     case llvm::Type::StructTyID: {
       auto struct_type = llvm::dyn_cast<llvm::StructType>(type);
+
+      // Reuse a same-named structure that is already in `context`, e.g. so
+      // that `%struct.State` in another context maps to this context's
+      // `%struct.State`, rather than to a new `%struct.State.0`.
+      if (!struct_type->isLiteral()) {
+        auto existing =
+            llvm::StructType::getTypeByName(context, struct_type->getName());
+        if (existing && IsSameStructure(struct_type, existing, cache)) {
+          cached = existing;
+          return existing;
+        }
+      }
+
       llvm::StructType *new_struct_type = nullptr;
       if (struct_type->isLiteral()) {
         new_struct_type = llvm::StructType::create(context);
@@ -1510,9 +1742,44 @@ DeclareAliasInModule(llvm::GlobalAlias *var, llvm::Module *dest_module,
 }
 
 
+// Move the types that `inst` refers to into `context`. The operands of
+// `inst` are moved separately.
+static void RecontextualizeInstruction(llvm::Instruction *inst,
+                                       llvm::LLVMContext &context,
+                                       TypeMap &type_map) {
+  inst->mutateType(RecontextualizeType(inst->getType(), context, type_map));
+  if (auto gep = llvm::dyn_cast<llvm::GetElementPtrInst>(inst)) {
+    gep->setSourceElementType(
+        RecontextualizeType(gep->getSourceElementType(), context, type_map));
+    gep->setResultElementType(
+        RecontextualizeType(gep->getResultElementType(), context, type_map));
+
+  } else if (auto alloca = llvm::dyn_cast<llvm::AllocaInst>(inst)) {
+    alloca->setAllocatedType(
+        RecontextualizeType(alloca->getAllocatedType(), context, type_map));
+
+  } else if (auto call = llvm::dyn_cast<llvm::CallBase>(inst)) {
+    call->mutateFunctionType(llvm::cast<llvm::FunctionType>(
+        RecontextualizeType(call->getFunctionType(), context, type_map)));
+    call->setAttributes(
+        RecontextualizeAttributes(call->getAttributes(), context, type_map));
+
+  // The mask is also kept as a constant, which is rebuilt from the result
+  // type.
+  } else if (auto shuffle = llvm::dyn_cast<llvm::ShuffleVectorInst>(inst)) {
+    llvm::SmallVector<int, 16> mask;
+    shuffle->getShuffleMask(mask);
+    shuffle->setShuffleMask(mask);
+  }
+}
+
 static void MoveInstructionIntoModule(llvm::Instruction *inst,
                                       llvm::Module *dest_module,
                                       ValueMap &value_map, TypeMap &type_map) {
+  if (auto &dest_context = dest_module->getContext();
+      &(inst->getContext()) != &dest_context) {
+    RecontextualizeInstruction(inst, dest_context, type_map);
+  }
 
   // Substitute the operands.
   for (auto &op : inst->operands()) {
@@ -1650,7 +1917,12 @@ void CloneFunctionInto(llvm::Function *source_func, llvm::Function *dest_func,
   // throw away register names and such.
   dest_func->getContext().setDiscardValueNames(false);
 
-  dest_func->setAttributes(source_func->getAttributes());
+  if (&source_context != &dest_context) {
+    dest_func->setAttributes(RecontextualizeAttributes(
+        source_func->getAttributes(), dest_context, type_map));
+  } else {
+    dest_func->setAttributes(source_func->getAttributes());
+  }
   dest_func->setLinkage(source_func->getLinkage());
   dest_func->setVisibility(source_func->getVisibility());
   dest_func->setCallingConv(source_func->getCallingConv());
@@ -1708,9 +1980,8 @@ void CloneFunctionInto(llvm::Function *source_func, llvm::Function *dest_func,
 
       auto new_inst = llvm::dyn_cast<llvm::Instruction>(value_map[&old_inst]);
       new_inst->setDebugLoc(llvm::DebugLoc());
-      new_inst->setName(old_inst.getName());
-
       MoveInstructionIntoModule(new_inst, dest_mod, value_map, type_map);
+      new_inst->setName(old_inst.getName());
     }
   }
 
@@ -1909,6 +2180,48 @@ llvm::Type *RecontextualizeType(llvm::Type *type, llvm::LLVMContext &context) {
   return RecontextualizeType(type, context, cache);
 }
 
+namespace {
+
+// Returns `true` if `type` is an integer or floating point type whose bits
+// fill all of its allocated bytes.
+static bool IsPaddingFreeScalar(const llvm::DataLayout &dl, llvm::Type *type) {
+  if (!type->isIntegerTy() && !type->isFloatingPointTy()) {
+    return false;
+  }
+  return dl.getTypeSizeInBits(type) == 8u * dl.getTypeAllocSize(type);
+}
+
+// Returns the index of the whole vector memory intrinsic that can move a
+// value of `type` to or from memory in one call, or `-1` if there isn't one.
+// Index `0` is for 16-byte values, `1` is for 32-byte values, and `2` is for
+// 64-byte values.
+//
+// The vector intrinsics copy raw bytes, so `type` must not contain padding.
+static int VectorMemoryIntrinsicIndex(const llvm::DataLayout &dl,
+                                      llvm::Type *type) {
+  if (!IsPaddingFreeScalar(dl, type)) {
+    llvm::Type *elem_type = nullptr;
+    if (auto arr_type = llvm::dyn_cast<llvm::ArrayType>(type)) {
+      elem_type = arr_type->getElementType();
+    } else if (auto vec_type = llvm::dyn_cast<llvm::FixedVectorType>(type)) {
+      elem_type = vec_type->getElementType();
+    }
+    if (!elem_type || !IsPaddingFreeScalar(dl, elem_type) ||
+        dl.getTypeSizeInBits(type) != 8u * dl.getTypeAllocSize(type)) {
+      return -1;
+    }
+  }
+
+  switch (dl.getTypeAllocSize(type)) {
+    case 16: return 0;
+    case 32: return 1;
+    case 64: return 2;
+    default: return -1;
+  }
+}
+
+}  // namespace
+
 llvm::Value *LoadFromMemory(const IntrinsicTable &intrinsics,
                             llvm::BasicBlock *block, llvm::Type *type,
                             llvm::Value *mem_ptr, llvm::Value *addr) {
@@ -1931,6 +2244,19 @@ llvm::Value *LoadFromMemory(const IntrinsicTable &intrinsics,
   llvm::Value *args_2[2] = {mem_ptr, addr};
   auto index_type = llvm::Type::getIntNTy(context, dl.getPointerSizeInBits(0));
 
+  // Read whole 16-, 32-, and 64-byte values with one call, rather than
+  // breaking them up into elements or bytes.
+  const auto vec_index = VectorMemoryIntrinsicIndex(dl, type);
+  if (vec_index >= 0) {
+    llvm::Function *const read_vec[] = {intrinsics.read_memory_v128,
+                                        intrinsics.read_memory_v256,
+                                        intrinsics.read_memory_v512};
+    auto res = ir.CreateAlloca(type);
+    llvm::Value *args_3[3] = {mem_ptr, addr, res};
+    ir.CreateCall(read_vec[vec_index], args_3);
+    return ir.CreateLoad(type, res);
+  }
+
   switch (type->getTypeID()) {
     case llvm::Type::HalfTyID: {
       llvm::Type *types[] = {llvm::Type::getFloatTy(context)};
@@ -2114,6 +2440,20 @@ llvm::Value *StoreToMemory(const IntrinsicTable &intrinsics,
   auto index_type = llvm::Type::getInt32Ty(context);
 
   auto type = val_to_store->getType();
+
+  // Write whole 16-, 32-, and 64-byte values with one call, rather than
+  // breaking them up into elements or bytes.
+  const auto vec_index = VectorMemoryIntrinsicIndex(dl, type);
+  if (vec_index >= 0) {
+    llvm::Function *const write_vec[] = {intrinsics.write_memory_v128,
+                                         intrinsics.write_memory_v256,
+                                         intrinsics.write_memory_v512};
+    auto res = ir.CreateAlloca(type);
+    ir.CreateStore(val_to_store, res);
+    args_3[2] = res;
+    return ir.CreateCall(write_vec[vec_index], args_3);
+  }
+
   switch (type->getTypeID()) {
     case llvm::Type::HalfTyID: {
       llvm::Type *types[] = {llvm::Type::getFloatTy(context)};
@@ -0,0 +1,60 @@
+#!/usr/bin/env bash
+# Copyright (c) 2023 Trail of Bits, Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Compares the time taken by `remill-lift` to lift all of the functions of an
+# ELF binary, e.g. a libc, with and without the decode cache
+# (`--decode_cache_size`), and reports the hit rate of the cache. The lifted
+# code isn't optimized, so that the time is dominated by decoding and lifting.
+#
+# Usage: bench-decode-cache.sh <path to remill-lift> [binary] [cache size]
+
+set -euo pipefail
+
+if [[ $# -lt 1 ]]; then
+  echo "Usage: $0 <path to remill-lift> [binary] [cache size]" >&2
+  exit 1
+fi
+
+REMILL_LIFT=$1
+BINARY=${2:-$(ldd /bin/sh | awk '/libc\.so/ { print $3 }')}
+CACHE_SIZE=${3:-65536}
+
+if [[ ! -f "${BINARY}" ]]; then
+  echo "Cannot find the binary to lift; pass it as the second argument" >&2
+  exit 1
+fi
+
+LOG=$(mktemp)
+trap 'rm -f "${LOG}"' EXIT
+
+# Print the number of seconds taken to lift `BINARY` with the given arguments.
+time_lift() {
+  local start end
+  start=$(date +%s.%N)
+  "${REMILL_LIFT}" --binary "${BINARY}" --opt_level 0 --ir_out /dev/null \
+      --logtostderr "$@" > /dev/null 2> "${LOG}"
+  end=$(date +%s.%N)
+  echo "${end} - ${start}" | bc
+}
+
+echo "Lifting ${BINARY}"
+uncached=$(time_lift)
+cached=$(time_lift --decode_cache_size "${CACHE_SIZE}")
+stats=$(grep -o "Decode cache: .*" "${LOG}" || echo "Decode cache: no stats")
+speedup=$(echo "scale=2; ${uncached} / ${cached}" | bc)
+
+printf "%-12s %12s %9s\n" "uncached (s)" "cached (s)" "speedup"
+printf "%12.3f %12.3f %8sx\n" "${uncached}" "${cached}" "${speedup}"
+echo "${stats}"
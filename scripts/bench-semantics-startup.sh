@@ -0,0 +1,60 @@
+#!/usr/bin/env bash
+# Copyright (c) 2023 Trail of Bits, Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Compares the start up time of `remill-lift` when it eagerly loads all of the
+# semantics, versus when it only loads the semantics that the lifted code
+# uses (`--lazy_semantics`). Each mode lifts a single instruction, so the time
+# is dominated by loading the semantics. The `bench-decode` benchmark in
+# `tests/Decode` times loading the semantics alone, in both modes.
+#
+# Usage: bench-semantics-startup.sh <path to remill-lift> [iterations]
+
+set -euo pipefail
+
+if [[ $# -lt 1 ]]; then
+  echo "Usage: $0 <path to remill-lift> [iterations]" >&2
+  exit 1
+fi
+
+REMILL_LIFT=$1
+ITERATIONS=${2:-10}
+
+# Architecture and bytes of a simple `add` instruction to lift.
+BENCHMARKS=(
+  "aarch64 2000028b"  # add x0, x1, x2
+  "amd64 4801d8"      # add rax, rbx
+)
+
+# Print the total number of seconds taken to run `remill-lift` `ITERATIONS`
+# times with the given arguments.
+time_lift() {
+  local start end
+  start=$(date +%s.%N)
+  for ((i = 0; i < ITERATIONS; i++)); do
+    "${REMILL_LIFT}" "$@" --ir_out /dev/null > /dev/null 2>&1
+  done
+  end=$(date +%s.%N)
+  echo "${end} - ${start}" | bc
+}
+
+printf "%-10s %12s %12s %9s\n" "arch" "eager (s)" "lazy (s)" "speedup"
+for benchmark in "${BENCHMARKS[@]}"; do
+  read -r arch bytes <<< "${benchmark}"
+  eager=$(time_lift --arch "${arch}" --bytes "${bytes}")
+  lazy=$(time_lift --arch "${arch}" --bytes "${bytes}" --lazy_semantics)
+  speedup=$(echo "scale=2; ${eager} / ${lazy}" | bc)
+  printf "%-10s %12.3f %12.3f %8sx\n" "${arch}" "${eager}" "${lazy}" \
+      "${speedup}"
+done
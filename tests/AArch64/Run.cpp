@@ -158,6 +158,22 @@ NEVER_INLINE Memory *__remill_write_memory_f80(Memory *, addr_t addr,
   return nullptr;
 }
 
+#define MAKE_RW_VEC_MEMORY(size) \
+  NEVER_INLINE Memory *__remill_read_memory_v##size( \
+      Memory *, addr_t addr, vec##size##_t &out) { \
+    out = AccessMemory<vec##size##_t>(addr); \
+    return nullptr; \
+  } \
+  NEVER_INLINE Memory *__remill_write_memory_v##size( \
+      Memory *, addr_t addr, const vec##size##_t &in) { \
+    AccessMemory<vec##size##_t>(addr) = in; \
+    return nullptr; \
+  }
+
+MAKE_RW_VEC_MEMORY(128)
+MAKE_RW_VEC_MEMORY(256)
+MAKE_RW_VEC_MEMORY(512)
+
 Memory *__remill_compare_exchange_memory_8(Memory *memory, addr_t addr,
                                            uint8_t &expected, uint8_t desired) {
   expected = __sync_val_compare_and_swap(reinterpret_cast<uint8_t *>(addr),
@@ -691,6 +707,36 @@ inline static bool operator!=(const T &a, const T &b) {
   return !!memcmp(&a, &b, sizeof(a));
 }
 
+#if REMILL_AARCH64_LAZY_FLAGS
+
+template <typename T>
+static void MaterializeAddWithCarry(State *state, T lhs, T rhs, T carry) {
+  constexpr auto kSignShift = sizeof(T) * 8 - 1;
+  const auto wide = static_cast<unsigned __int128>(lhs) + rhs + carry;
+  const auto res = static_cast<T>(wide);
+  state->sr.n = static_cast<uint8_t>(res >> kSignShift);
+  state->sr.z = !res;
+  state->sr.c = !!(wide >> (kSignShift + 1));
+  state->sr.v = static_cast<uint8_t>((~(lhs ^ rhs) & (lhs ^ res)) >> kSignShift);
+}
+
+// The lifted code may leave the `NZCV` flags as the operands of the last
+// flag-setting instruction. Compute them so that they can be compared against
+// the native flags.
+static void MaterializeLazyFlags(State *state) {
+  auto &lazy = state->lazy_nzcv;
+  if (kLazyNZCVAddWithCarry32 == lazy.kind) {
+    MaterializeAddWithCarry<uint32_t>(state, static_cast<uint32_t>(lazy.lhs),
+                                      static_cast<uint32_t>(lazy.rhs),
+                                      lazy.carry);
+  } else if (kLazyNZCVAddWithCarry64 == lazy.kind) {
+    MaterializeAddWithCarry<uint64_t>(state, lazy.lhs, lazy.rhs, lazy.carry);
+  }
+  memset(&lazy, 0, sizeof(lazy));
+}
+
+#endif  // REMILL_AARCH64_LAZY_FLAGS
+
 static void RunWithFlags(const test::TestInfo *info, NZCV flags,
                          std::string desc, uint64_t arg1, uint64_t arg2,
                          uint64_t arg3) {
@@ -762,6 +808,10 @@ static void RunWithFlags(const test::TestInfo *info, NZCV flags,
     EXPECT_TRUE(native_test_faulted);
   }
 
+#if REMILL_AARCH64_LAZY_FLAGS
+  MaterializeLazyFlags(lifted_state);
+#endif
+
   // The native test doesn't update
   native_state->gpr.pc.qword = info->test_end;
 
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Measures how the wall time of lifting a synthetic AArch64 program scales
+// with the number of workers of a `ParallelTraceLifter`. The program is one
+// trace that calls `--traces` others, each of which has `--trace_insts`
+// instructions. Lifting with a plain `TraceLifter` is measured too, as the
+// baseline. The wall time includes each worker building its own `Arch` and
+// semantics module, as that's part of every `ParallelTraceLifter::Lift`.
+
+#include <gflags/gflags.h>
+#include <glog/logging.h>
+#include <llvm/IR/Function.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <remill/Arch/Arch.h>
+#include <remill/Arch/Name.h>
+#include <remill/BC/TraceLifter.h>
+#include <remill/BC/Util.h>
+#include <remill/OS/OS.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+DEFINE_uint64(traces, 256, "Number of traces called by the root trace.");
+
+DEFINE_uint64(trace_insts, 32,
+              "Number of instructions in each called trace, including its "
+              "`ret`.");
+
+DEFINE_uint32(max_workers, 0,
+              "Largest number of workers to lift with. The number of workers "
+              "doubles from one up to this. Uses the number of hardware "
+              "threads if zero.");
+
+DEFINE_uint32(repeats, 3,
+              "Number of times to lift the program with each number of "
+              "workers. The fastest time is reported.");
+
+namespace {
+
+static constexpr uint64_t kBaseAddress = 0x1000;
+
+// AArch64 encodings of the instructions in the program.
+static constexpr uint32_t kRet = 0xd65f03c0;  // ret
+static constexpr uint32_t kBodyInsts[] = {
+    0x91000400,  // add x0, x0, #1
+    0x8b020020,  // add x0, x1, x2
+    0xf94007e0,  // ldr x0, [sp, #8]
+    0xaa0103e2,  // mov x2, x1
+};
+
+// `bl target`, where the `bl` is at `pc`.
+static uint32_t BranchAndLink(uint64_t pc, uint64_t target) {
+  return 0x94000000u | (static_cast<uint32_t>((target - pc) / 4u) & 0x3ffffffu);
+}
+
+static void Emit(std::string &bytes, uint32_t inst) {
+  for (auto i = 0u; i < 4u; ++i) {
+    bytes.push_back(static_cast<char>(inst >> (i * 8u)));
+  }
+}
+
+// The root trace calls every other trace, then returns. The other traces
+// follow it back-to-back.
+static std::string SyntheticProgram(void) {
+  const auto root_size = (FLAGS_traces + 1u) * 4u;
+  const auto trace_size = FLAGS_trace_insts * 4u;
+
+  std::string bytes;
+  for (uint64_t i = 0; i < FLAGS_traces; ++i) {
+    const auto pc = kBaseAddress + i * 4u;
+    Emit(bytes, BranchAndLink(pc, kBaseAddress + root_size + i * trace_size));
+  }
+  Emit(bytes, kRet);
+
+  for (uint64_t i = 0; i < FLAGS_traces; ++i) {
+    for (uint64_t j = 1; j < FLAGS_trace_insts; ++j) {
+      Emit(bytes, kBodyInsts[(i + j) % std::size(kBodyInsts)]);
+    }
+    Emit(bytes, kRet);
+  }
+  return bytes;
+}
+
+// Serves the bytes of the program. Traces are reported from the thread that
+// calls `ParallelTraceLifter::Lift`, but the lock keeps this correct if that
+// ever changes.
+class BenchmarkTraceManager final : public remill::TraceManager {
+ public:
+  explicit BenchmarkTraceManager(const std::string &bytes_) : bytes(bytes_) {}
+
+  void SetLiftedTraceDefinition(uint64_t addr,
+                                llvm::Function *lifted_func) override {
+    std::lock_guard<std::mutex> locker(lock);
+    traces[addr] = lifted_func;
+  }
+
+  llvm::Function *GetLiftedTraceDefinition(uint64_t addr) override {
+    std::lock_guard<std::mutex> locker(lock);
+    auto trace_it = traces.find(addr);
+    return trace_it != traces.end() ? trace_it->second : nullptr;
+  }
+
+  bool TryReadExecutableByte(uint64_t addr, uint8_t *byte) override {
+    if (addr < kBaseAddress || (addr - kBaseAddress) >= bytes.size()) {
+      return false;
+    }
+    *byte = static_cast<uint8_t>(bytes[addr - kBaseAddress]);
+    return true;
+  }
+
+  const std::string &bytes;
+  std::mutex lock;
+  std::unordered_map<uint64_t, llvm::Function *> traces;
+};
+
+// Returns the number of milliseconds taken to lift `bytes`. If `num_workers`
+// is zero, then lifts with a `TraceLifter`.
+static double TimeLift(const std::string &bytes, unsigned num_workers) {
+  llvm::LLVMContext context;
+  auto arch = remill::Arch::Build(&context, remill::GetOSName(REMILL_OS),
+                                  remill::kArchAArch64LittleEndian);
+  CHECK(arch != nullptr) << "Unable to build the AArch64 architecture";
+  auto module = remill::LoadArchSemantics(arch.get());
+  CHECK(module != nullptr) << "Unable to load the AArch64 semantics";
+
+  BenchmarkTraceManager manager(bytes);
+  const auto start = std::chrono::steady_clock::now();
+  if (num_workers) {
+    remill::ParallelTraceLifter lifter(arch.get(), manager, num_workers);
+    CHECK(lifter.Lift({kBaseAddress})) << "Unable to lift the program";
+  } else {
+    remill::TraceLifter lifter(arch.get(), manager);
+    CHECK(lifter.Lift(kBaseAddress)) << "Unable to lift the program";
+  }
+  const auto end = std::chrono::steady_clock::now();
+
+  CHECK_EQ(manager.traces.size(), FLAGS_traces + 1u)
+      << "Lifted the wrong number of traces";
+
+  return static_cast<double>(
+             std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+                 .count()) /
+         1000.0;
+}
+
+// Returns the fastest of `FLAGS_repeats` runs of `TimeLift`.
+static double BestTimeLift(const std::string &bytes, unsigned num_workers) {
+  auto best_ms = TimeLift(bytes, num_workers);
+  for (auto i = 1u; i < FLAGS_repeats; ++i) {
+    best_ms = std::min(best_ms, TimeLift(bytes, num_workers));
+  }
+  return best_ms;
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  google::ParseCommandLineFlags(&argc, &argv, true);
+  google::InitGoogleLogging(argv[0]);
+
+  if (!FLAGS_traces || !FLAGS_trace_insts || !FLAGS_repeats) {
+    std::fprintf(stderr,
+                 "--traces, --trace_insts, and --repeats must be non-zero\n");
+    return EXIT_FAILURE;
+  }
+
+  auto max_workers = FLAGS_max_workers;
+  if (!max_workers) {
+    max_workers = std::max(1u, std::thread::hardware_concurrency());
+  }
+
+  const auto bytes = SyntheticProgram();
+  std::printf("%llu traces of %llu instructions\n",
+              static_cast<unsigned long long>(FLAGS_traces),
+              static_cast<unsigned long long>(FLAGS_trace_insts));
+  std::printf("%-14s %14s %14s\n", "workers", "wall (ms)", "speedup");
+
+  const auto serial_ms = BestTimeLift(bytes, 0u);
+  std::printf("%-14s %14.1f %14.2f\n", "TraceLifter", serial_ms, 1.0);
+
+  for (auto num_workers = 1u; num_workers <= max_workers; num_workers *= 2u) {
+    const auto wall_ms = BestTimeLift(bytes, num_workers);
+    std::printf("%-14u %14.1f %14.2f\n", num_workers, wall_ms,
+                serial_ms / wall_ms);
+  }
+
+  return EXIT_SUCCESS;
+}
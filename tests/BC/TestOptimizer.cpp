@@ -0,0 +1,419 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <glog/logging.h>
+#include <gtest/gtest.h>
+#include <llvm/Analysis/ValueTracking.h>
+#include <llvm/IR/BasicBlock.h>
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/Function.h>
+#include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/Instructions.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/IR/Verifier.h>
+#include <remill/Arch/Arch.h>
+#include <remill/Arch/Name.h>
+#include <remill/BC/ABI.h>
+#include <remill/BC/Optimizer.h>
+#include <remill/BC/Util.h>
+#include <remill/OS/OS.h>
+
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+// Builds lifted functions by hand against the AArch64 semantics, so that the
+// passes over lifted traces can be checked on small, exact inputs.
+class LiftedTraceTest : public testing::Test {
+ protected:
+  void SetUp(void) override {
+    arch = remill::Arch::Build(&context, remill::kOSLinux,
+                               remill::kArchAArch64LittleEndian);
+    ASSERT_NE(arch, nullptr);
+    module = remill::LoadArchSemantics(arch.get());
+    ASSERT_NE(module, nullptr);
+  }
+
+  // Define a lifted function named `name` with one empty block.
+  llvm::Function *DefineTrace(std::string_view name) {
+    auto func = arch->DeclareLiftedFunction(name, module.get());
+    llvm::BasicBlock::Create(context, "", func);
+    return func;
+  }
+
+  // Store `val` into the register named `reg_name`.
+  void StoreRegValue(llvm::IRBuilder<> &ir, llvm::Function *func,
+                     std::string_view reg_name, llvm::Value *val) {
+    auto reg = arch->RegisterByName(reg_name);
+    CHECK(reg != nullptr) << reg_name;
+    ir.CreateStore(val, reg->AddressOf(StatePointer(func), ir));
+  }
+
+  // Store the constant `val` into the register named `reg_name`.
+  void StoreReg(llvm::IRBuilder<> &ir, llvm::Function *func,
+                std::string_view reg_name, uint64_t val) {
+    auto reg = arch->RegisterByName(reg_name);
+    CHECK(reg != nullptr) << reg_name;
+    StoreRegValue(ir, func, reg_name, llvm::ConstantInt::get(reg->type, val));
+  }
+
+  // Load the value of the register named `reg_name`.
+  llvm::Value *LoadReg(llvm::IRBuilder<> &ir, llvm::Function *func,
+                       std::string_view reg_name) {
+    auto reg = arch->RegisterByName(reg_name);
+    CHECK(reg != nullptr) << reg_name;
+    return ir.CreateLoad(reg->type, reg->AddressOf(StatePointer(func), ir));
+  }
+
+  // Tail-call the lifted function `callee`, as a trace exits into another.
+  llvm::CallInst *CallTrace(llvm::IRBuilder<> &ir, llvm::Function *func,
+                            llvm::Function *callee) {
+    llvm::Value *args[] = {
+        StatePointer(func), remill::NthArgument(func, remill::kPCArgNum),
+        remill::NthArgument(func, remill::kMemoryPointerArgNum)};
+    return ir.CreateCall(callee, args);
+  }
+
+  // Return from the lifted function `func`.
+  void Return(llvm::IRBuilder<> &ir, llvm::Function *func) {
+    ir.CreateRet(remill::NthArgument(func, remill::kMemoryPointerArgNum));
+  }
+
+  static llvm::Value *StatePointer(llvm::Function *func) {
+    return remill::NthArgument(func, remill::kStatePointerArgNum);
+  }
+
+  // Call the intrinsic named `name`.
+  llvm::CallInst *CallIntrinsic(llvm::IRBuilder<> &ir, std::string_view name,
+                                llvm::ArrayRef<llvm::Value *> args) {
+    auto callee = module->getFunction(name);
+    CHECK(callee != nullptr) << name;
+    return ir.CreateCall(callee, args);
+  }
+
+  // Returns the calls in `func` to the function named `name`.
+  static std::vector<llvm::CallInst *> CallsTo(llvm::Function *func,
+                                               std::string_view name) {
+    std::vector<llvm::CallInst *> calls;
+    for (auto &block : *func) {
+      for (auto &inst : block) {
+        auto call = llvm::dyn_cast<llvm::CallInst>(&inst);
+        if (call && call->getCalledFunction() &&
+            call->getCalledFunction()->getName() ==
+                llvm::StringRef(name.data(), name.size())) {
+          calls.push_back(call);
+        }
+      }
+    }
+    return calls;
+  }
+
+  // Returns the values stored into `State` in `func`, in order.
+  static std::vector<llvm::Value *> StoredToState(llvm::Function *func) {
+    std::vector<llvm::Value *> vals;
+    for (auto &block : *func) {
+      for (auto &inst : block) {
+        if (auto val = StoredToState(&inst, func)) {
+          vals.push_back(val);
+        }
+      }
+    }
+    return vals;
+  }
+
+  // Returns the value stored by `inst` if it is a store into `State`.
+  static llvm::Value *StoredToState(llvm::Instruction *inst,
+                                    llvm::Function *func) {
+    auto store = llvm::dyn_cast_or_null<llvm::StoreInst>(inst);
+    if (!store || llvm::getUnderlyingObject(store->getPointerOperand()) !=
+                      StatePointer(func)) {
+      return nullptr;
+    }
+    return store->getValueOperand();
+  }
+
+  llvm::LLVMContext context;
+  remill::Arch::ArchPtr arch;
+  std::unique_ptr<llvm::Module> module;
+};
+
+}  // namespace
+
+// A register written before a call must be in `State` for the call, must be
+// reloaded after the call, and its final value must be in `State` on return.
+TEST_F(LiftedTraceTest, PromotedRegistersSurviveCallsAndReturns) {
+  auto callee = arch->DeclareLiftedFunction("sub_2000", module.get());
+  auto func = DefineTrace("sub_1000");
+  llvm::IRBuilder<> ir(&(func->front()));
+  StoreReg(ir, func, "X0", 1u);
+  auto call = CallTrace(ir, func, callee);
+  auto sum = ir.CreateAdd(LoadReg(ir, func, "X0"),
+                          llvm::ConstantInt::get(ir.getInt64Ty(), 1u));
+  auto sum_inst = llvm::cast<llvm::Instruction>(sum);
+  StoreRegValue(ir, func, "X0", sum);
+  Return(ir, func);
+
+  EXPECT_EQ(remill::PromoteStateRegisters(arch.get(), func), 1u);
+  EXPECT_FALSE(llvm::verifyFunction(*func, &llvm::errs()));
+
+  // `X0` is spilled right before the call.
+  auto spilled = StoredToState(call->getPrevNode(), func);
+  ASSERT_NE(spilled, nullptr);
+  auto spilled_const = llvm::dyn_cast<llvm::ConstantInt>(spilled);
+  ASSERT_NE(spilled_const, nullptr);
+  EXPECT_EQ(spilled_const->getZExtValue(), 1u);
+
+  // The callee may change `X0`, so it's reloaded from `State` after the call.
+  auto reloaded = llvm::dyn_cast<llvm::LoadInst>(sum_inst->getOperand(0));
+  ASSERT_NE(reloaded, nullptr);
+  EXPECT_EQ(llvm::getUnderlyingObject(reloaded->getPointerOperand()),
+            StatePointer(func));
+
+  // The final value of `X0` is spilled right before the return.
+  auto ret = func->front().getTerminator();
+  EXPECT_EQ(StoredToState(ret->getPrevNode(), func), sum);
+}
+
+// A flag store that is overwritten before anything reads it is dead, but the
+// flags that a call or a return may read are live.
+TEST_F(LiftedTraceTest, LiveFlagsSurviveCallsAndReturns) {
+  auto callee = arch->DeclareLiftedFunction("sub_2000", module.get());
+  auto func = DefineTrace("sub_1000");
+  llvm::IRBuilder<> ir(&(func->front()));
+  StoreReg(ir, func, "N", 1u);  // Dead.
+  StoreReg(ir, func, "N", 0u);  // Read by the call.
+  auto call = CallTrace(ir, func, callee);
+  StoreReg(ir, func, "Z", 1u);  // Read by the return.
+  Return(ir, func);
+
+  EXPECT_EQ(remill::EliminateDeadFlagStores(arch.get(), func), 1u);
+  EXPECT_FALSE(llvm::verifyFunction(*func, &llvm::errs()));
+
+  auto num_state_stores = 0u;
+  for (auto &inst : func->front()) {
+    if (StoredToState(&inst, func)) {
+      ++num_state_stores;
+    }
+  }
+  EXPECT_EQ(num_state_stores, 2u);
+
+  auto n_val = llvm::dyn_cast_or_null<llvm::ConstantInt>(
+      StoredToState(call->getPrevNode(), func));
+  ASSERT_NE(n_val, nullptr);
+  EXPECT_EQ(n_val->getZExtValue(), 0u);
+
+  auto ret = func->front().getTerminator();
+  auto z_val = llvm::dyn_cast_or_null<llvm::ConstantInt>(
+      StoredToState(ret->getPrevNode(), func));
+  ASSERT_NE(z_val, nullptr);
+  EXPECT_EQ(z_val->getZExtValue(), 1u);
+}
+
+// With an address mask, fixed-size accesses are lowered to accesses of masked
+// addresses, but the bulk copies and fills, whose lengths the mask can't
+// bound, are left as calls to the intrinsics.
+TEST_F(LiftedTraceTest, MaskedLoweringKeepsBulkAccesses) {
+  auto read = module->getFunction("__remill_read_memory_64");
+  auto copy = module->getFunction("__remill_memcpy");
+  auto fill = module->getFunction("__remill_memset");
+  ASSERT_NE(read, nullptr);
+  ASSERT_NE(copy, nullptr);
+  ASSERT_NE(fill, nullptr);
+
+  auto func = DefineTrace("sub_1000");
+  llvm::IRBuilder<> ir(&(func->front()));
+  auto addr = LoadReg(ir, func, "X0");
+  auto size = LoadReg(ir, func, "X1");
+  llvm::Value *mem = remill::NthArgument(func, remill::kMemoryPointerArgNum);
+  StoreRegValue(ir, func, "X2", ir.CreateCall(read, {mem, addr}));
+  mem = ir.CreateCall(copy, {mem, addr, addr, size});
+  mem = ir.CreateCall(fill, {mem, addr, ir.getInt8(0), size});
+  ir.CreateRet(mem);
+
+  remill::DirectMemoryModel model;
+  model.base_address = 0x100000000ull;
+  model.address_mask = 0xffffull;
+  EXPECT_EQ(remill::LowerMemoryIntrinsics(func, model), 1u);
+  EXPECT_FALSE(llvm::verifyFunction(*func, &llvm::errs()));
+
+  auto num_masks = 0u;
+  std::vector<llvm::Function *> callees;
+  for (auto &inst : func->front()) {
+    if (auto call = llvm::dyn_cast<llvm::CallInst>(&inst)) {
+      callees.push_back(call->getCalledFunction());
+    } else if (inst.getOpcode() == llvm::Instruction::And) {
+      auto mask = llvm::dyn_cast<llvm::ConstantInt>(inst.getOperand(1));
+      if (mask && mask->getZExtValue() == model.address_mask) {
+        ++num_masks;
+      }
+    }
+  }
+  EXPECT_EQ(num_masks, 1u);
+  EXPECT_EQ(callees, (std::vector<llvm::Function *>{copy, fill}));
+}
+
+// Atomics are lowered with their natural alignment, so that they become host
+// atomic instructions, unless they may be misaligned.
+TEST_F(LiftedTraceTest, LoweredAtomicsAreNaturallyAligned) {
+  auto fetch_add = module->getFunction("__remill_fetch_and_add_32");
+  ASSERT_NE(fetch_add, nullptr);
+
+  for (auto misaligned : {false, true}) {
+    auto func = DefineTrace(misaligned ? "sub_2000" : "sub_1000");
+    llvm::IRBuilder<> ir(&(func->front()));
+    auto val = ir.CreateAlloca(ir.getInt32Ty());
+    ir.CreateStore(ir.getInt32(1), val);
+    llvm::Value *mem = remill::NthArgument(func, remill::kMemoryPointerArgNum);
+    mem = ir.CreateCall(fetch_add, {mem, LoadReg(ir, func, "X0"), val});
+    ir.CreateRet(mem);
+
+    remill::DirectMemoryModel model;
+    model.misaligned_atomics = misaligned;
+    EXPECT_EQ(remill::LowerMemoryIntrinsics(func, model), 1u);
+    EXPECT_FALSE(llvm::verifyFunction(*func, &llvm::errs()));
+
+    auto num_atomics = 0u;
+    for (auto &inst : func->front()) {
+      if (auto rmw = llvm::dyn_cast<llvm::AtomicRMWInst>(&inst)) {
+        ++num_atomics;
+        EXPECT_EQ(rmw->getAlign().value(), misaligned ? 1u : 4u);
+      }
+    }
+    EXPECT_EQ(num_atomics, 1u);
+  }
+}
+
+// Adjacent reads are merged into one read at the lower address, whichever of
+// them comes first. The original reads are kept for when the merged read
+// would cross a page boundary.
+TEST_F(LiftedTraceTest, CoalescesAscendingAndDescendingReads) {
+  for (auto descending : {false, true}) {
+    auto func = DefineTrace(descending ? "sub_2000" : "sub_1000");
+    llvm::IRBuilder<> ir(&(func->front()));
+    auto base = LoadReg(ir, func, "X0");
+    auto low = ir.CreateAdd(base, ir.getInt64(8));
+    auto high = ir.CreateAdd(base, ir.getInt64(12));
+    auto mem = remill::NthArgument(func, remill::kMemoryPointerArgNum);
+    StoreRegValue(ir, func, "W1",
+                  CallIntrinsic(ir, "__remill_read_memory_32",
+                                {mem, descending ? high : low}));
+    StoreRegValue(ir, func, "W2",
+                  CallIntrinsic(ir, "__remill_read_memory_32",
+                                {mem, descending ? low : high}));
+    Return(ir, func);
+
+    EXPECT_EQ(remill::CoalesceMemoryAccesses(func), 2u);
+    EXPECT_FALSE(llvm::verifyFunction(*func, &llvm::errs()));
+    EXPECT_EQ(CallsTo(func, "__remill_read_memory_32").size(), 2u);
+
+    const auto merged = CallsTo(func, "__remill_read_memory_64");
+    ASSERT_EQ(merged.size(), 1u);
+    auto merged_addr =
+        llvm::dyn_cast<llvm::BinaryOperator>(merged[0]->getArgOperand(1));
+    ASSERT_NE(merged_addr, nullptr);
+    EXPECT_EQ(merged_addr->getOperand(0), base);
+    EXPECT_EQ(merged_addr->getOperand(1), ir.getInt64(8));
+
+    // The first read gets the high half of the merged read if, and only if,
+    // it read the higher address.
+    const auto vals = StoredToState(func);
+    ASSERT_EQ(vals.size(), 2u);
+    auto first_val = llvm::dyn_cast<llvm::PHINode>(vals[0]);
+    ASSERT_NE(first_val, nullptr);
+    auto first_half = llvm::dyn_cast<llvm::TruncInst>(
+        first_val->getIncomingValueForBlock(merged[0]->getParent()));
+    ASSERT_NE(first_half, nullptr);
+    EXPECT_EQ(first_half->getOperand(0) == merged[0], !descending);
+  }
+}
+
+// Two 8-byte reads, and two 8-byte writes, are merged into 16-byte accesses
+// that pass their values through one stack slot.
+TEST_F(LiftedTraceTest, CoalescesIntoVectorAccesses) {
+  auto func = DefineTrace("sub_1000");
+  llvm::IRBuilder<> ir(&(func->front()));
+  auto src = LoadReg(ir, func, "X0");
+  auto dst = LoadReg(ir, func, "X1");
+  llvm::Value *mem = remill::NthArgument(func, remill::kMemoryPointerArgNum);
+  auto low_val = CallIntrinsic(ir, "__remill_read_memory_64", {mem, src});
+  auto high_val = CallIntrinsic(ir, "__remill_read_memory_64",
+                                {mem, ir.CreateAdd(src, ir.getInt64(8))});
+  mem = CallIntrinsic(ir, "__remill_write_memory_64", {mem, dst, low_val});
+  mem = CallIntrinsic(ir, "__remill_write_memory_64",
+                      {mem, ir.CreateAdd(dst, ir.getInt64(8)), high_val});
+  ir.CreateRet(mem);
+
+  EXPECT_EQ(remill::CoalesceMemoryAccesses(func), 4u);
+  EXPECT_FALSE(llvm::verifyFunction(*func, &llvm::errs()));
+  EXPECT_EQ(CallsTo(func, "__remill_read_memory_v128").size(), 1u);
+  EXPECT_EQ(CallsTo(func, "__remill_write_memory_v128").size(), 1u);
+  EXPECT_EQ(CallsTo(func, "__remill_read_memory_64").size(), 2u);
+  EXPECT_EQ(CallsTo(func, "__remill_write_memory_64").size(), 2u);
+
+  auto num_slots = 0u;
+  for (auto &inst : func->getEntryBlock()) {
+    num_slots += llvm::isa<llvm::AllocaInst>(inst);
+  }
+  EXPECT_EQ(num_slots, 1u);
+}
+
+// Adjacent writes aren't merged when the memory between them is observed,
+// i.e. when the `Memory` pointer returned by the first write has another use.
+TEST_F(LiftedTraceTest, KeepsWritesWhoseMemoryIsObserved) {
+  auto func = DefineTrace("sub_1000");
+  llvm::IRBuilder<> ir(&(func->front()));
+  auto base = LoadReg(ir, func, "X0");
+  auto val = LoadReg(ir, func, "W1");
+  auto mem = remill::NthArgument(func, remill::kMemoryPointerArgNum);
+  auto first = CallIntrinsic(ir, "__remill_write_memory_32", {mem, base, val});
+  auto second = CallIntrinsic(ir, "__remill_write_memory_32",
+                              {first, ir.CreateAdd(base, ir.getInt64(4)), val});
+  StoreRegValue(ir, func, "W2",
+                CallIntrinsic(ir, "__remill_read_memory_32",
+                              {first, LoadReg(ir, func, "X3")}));
+  ir.CreateRet(second);
+
+  EXPECT_EQ(remill::CoalesceMemoryAccesses(func), 0u);
+  EXPECT_FALSE(llvm::verifyFunction(*func, &llvm::errs()));
+  EXPECT_EQ(CallsTo(func, "__remill_write_memory_32").size(), 2u);
+  EXPECT_TRUE(CallsTo(func, "__remill_write_memory_64").empty());
+}
+
+// Adjacent reads aren't merged across a call that might write to memory.
+TEST_F(LiftedTraceTest, KeepsReadsAroundCalls) {
+  auto callee = llvm::Function::Create(
+      llvm::FunctionType::get(llvm::Type::getVoidTy(context), false),
+      llvm::GlobalValue::ExternalLinkage, "external_func", module.get());
+  auto func = DefineTrace("sub_1000");
+  llvm::IRBuilder<> ir(&(func->front()));
+  auto base = LoadReg(ir, func, "X0");
+  auto mem = remill::NthArgument(func, remill::kMemoryPointerArgNum);
+  StoreRegValue(ir, func, "W1",
+                CallIntrinsic(ir, "__remill_read_memory_32", {mem, base}));
+  ir.CreateCall(callee);
+  StoreRegValue(ir, func, "W2",
+                CallIntrinsic(ir, "__remill_read_memory_32",
+                              {mem, ir.CreateAdd(base, ir.getInt64(4))}));
+  Return(ir, func);
+
+  EXPECT_EQ(remill::CoalesceMemoryAccesses(func), 0u);
+  EXPECT_FALSE(llvm::verifyFunction(*func, &llvm::errs()));
+  EXPECT_EQ(CallsTo(func, "__remill_read_memory_32").size(), 2u);
+  EXPECT_TRUE(CallsTo(func, "__remill_read_memory_64").empty());
+}
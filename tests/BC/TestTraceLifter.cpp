@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gflags/gflags.h>
+#include <glog/logging.h>
+#include <gtest/gtest.h>
+#include <llvm/IR/DerivedTypes.h>
+#include <llvm/IR/Function.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Support/FileSystem.h>
+#include <remill/Arch/Arch.h>
+#include <remill/Arch/Name.h>
+#include <remill/BC/TraceLifter.h>
+#include <remill/BC/Util.h>
+#include <remill/OS/OS.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <regex>
+#include <string>
+
+namespace {
+
+static constexpr uint64_t kBaseAddress = 0x1000;
+
+// AArch64 encodings of the few instructions used by the test programs.
+static constexpr uint32_t kRet = 0xd65f03c0;  // ret
+static constexpr uint32_t kAddX0 = 0x91000400;  // add x0, x0, #1
+static constexpr uint32_t kAddX1 = 0x91000441;  // add x1, x2, #1
+
+// `bl target`, where the `bl` is at `pc`.
+static uint32_t BranchAndLink(uint64_t pc, uint64_t target) {
+  return 0x94000000u | (static_cast<uint32_t>((target - pc) / 4u) & 0x3ffffffu);
+}
+
+// Lay out the instructions in `insts`, keyed by their addresses.
+static std::string Assemble(const std::map<uint64_t, uint32_t> &insts) {
+  std::string bytes(insts.rbegin()->first + 4u - kBaseAddress, '\0');
+  for (auto [addr, inst] : insts) {
+    for (auto i = 0u; i < 4u; ++i) {
+      bytes[addr - kBaseAddress + i] = static_cast<char>(inst >> (i * 8u));
+    }
+  }
+  return bytes;
+}
+
+// A call tree of five functions:
+//
+//    0x1000: bl 0x1020; bl 0x1040; bl 0x1060; ret
+//    0x1020: bl 0x1080; add x0, x0, #1; ret
+//    0x1040: add x0, x0, #1; ret
+//    0x1060: add x0, x0, #1; ret
+//    0x1080: add x0, x0, #1; ret
+static std::string CallTreeProgram(void) {
+  return Assemble({
+      {0x1000, BranchAndLink(0x1000, 0x1020)},
+      {0x1004, BranchAndLink(0x1004, 0x1040)},
+      {0x1008, BranchAndLink(0x1008, 0x1060)},
+      {0x100c, kRet},
+      {0x1020, BranchAndLink(0x1020, 0x1080)},
+      {0x1024, kAddX0},
+      {0x1028, kRet},
+      {0x1040, kAddX0},
+      {0x1044, kRet},
+      {0x1060, kAddX0},
+      {0x1064, kRet},
+      {0x1080, kAddX0},
+      {0x1084, kRet},
+  });
+}
+
+// The same instruction, repeated in one trace and in another:
+//
+//    0x1000: add x1, x2, #1; add x1, x2, #1; bl 0x1020; ret
+//    0x1020: add x1, x2, #1; ret
+static std::string RepeatedInstructionProgram(void) {
+  return Assemble({
+      {0x1000, kAddX1},
+      {0x1004, kAddX1},
+      {0x1008, BranchAndLink(0x1008, 0x1020)},
+      {0x100c, kRet},
+      {0x1020, kAddX1},
+      {0x1024, kRet},
+  });
+}
+
+// Serves the bytes of a test program, and remembers the lifted traces.
+class TestTraceManager final : public remill::TraceManager {
+ public:
+  explicit TestTraceManager(std::string bytes_) : bytes(std::move(bytes_)) {}
+
+  void SetLiftedTraceDefinition(uint64_t addr,
+                                llvm::Function *lifted_func) override {
+    traces[addr] = lifted_func;
+  }
+
+  llvm::Function *GetLiftedTraceDefinition(uint64_t addr) override {
+    auto trace_it = traces.find(addr);
+    return trace_it != traces.end() ? trace_it->second : nullptr;
+  }
+
+  bool TryReadExecutableByte(uint64_t addr, uint8_t *byte) override {
+    if (addr < kBaseAddress || (addr - kBaseAddress) >= bytes.size()) {
+      return false;
+    }
+    *byte = static_cast<uint8_t>(bytes[addr - kBaseAddress]);
+    return true;
+  }
+
+  const std::string bytes;
+  std::map<uint64_t, llvm::Function *> traces;
+};
+
+// The IR of a lifted trace, without the attribute group numbers, which depend
+// on the order in which things were added to the module.
+static std::string TraceIR(llvm::Function *func) {
+  static const std::regex kAttributeGroup(" #[0-9]+");
+  return std::regex_replace(remill::LLVMThingToString(func), kAttributeGroup,
+                            "");
+}
+
+// Lifts everything reachable from the start of `bytes`, and returns the IR of
+// every lifted trace. If `num_workers` is non-zero, then lifts with a
+// `ParallelTraceLifter` that uses that many workers. If `cache_dir` isn't
+// empty, then lifted traces are cached there.
+static std::map<uint64_t, std::string>
+LiftProgram(const std::string &bytes, unsigned num_workers,
+            const std::filesystem::path &cache_dir = {},
+            bool lift_templates = false) {
+  llvm::LLVMContext context;
+  auto arch = remill::Arch::Build(&context, remill::kOSLinux,
+                                  remill::kArchAArch64LittleEndian);
+  CHECK(arch != nullptr);
+  auto module = remill::LoadArchSemantics(arch.get());
+  CHECK(module != nullptr);
+
+  TestTraceManager manager(bytes);
+  if (num_workers) {
+    remill::ParallelTraceLifter lifter(arch.get(), manager, num_workers);
+    EXPECT_TRUE(cache_dir.empty() || lifter.EnableCache(cache_dir));
+    lifter.EnableLiftTemplates(lift_templates);
+    EXPECT_TRUE(lifter.Lift({kBaseAddress}));
+  } else {
+    remill::TraceLifter lifter(arch.get(), manager);
+    EXPECT_TRUE(cache_dir.empty() || lifter.EnableCache(cache_dir));
+    lifter.EnableLiftTemplates(lift_templates);
+    EXPECT_TRUE(lifter.Lift(kBaseAddress));
+  }
+
+  // Loading cached traces must not duplicate the named types of the module.
+  EXPECT_NE(llvm::StructType::getTypeByName(context, "struct.State"), nullptr);
+  EXPECT_EQ(llvm::StructType::getTypeByName(context, "struct.State.0"),
+            nullptr);
+
+  std::map<uint64_t, std::string> traces;
+  for (auto [addr, func] : manager.traces) {
+    EXPECT_EQ(func->getParent(), module.get());
+    EXPECT_FALSE(func->isDeclaration());
+    traces[addr] = TraceIR(func);
+  }
+  return traces;
+}
+
+// The identities of the files in `dir`, which change whenever a file is
+// replaced.
+static std::map<std::string, llvm::sys::fs::UniqueID>
+FileIDs(const std::filesystem::path &dir) {
+  std::map<std::string, llvm::sys::fs::UniqueID> ids;
+  for (const auto &entry : std::filesystem::directory_iterator(dir)) {
+    llvm::sys::fs::UniqueID id;
+    CHECK(!llvm::sys::fs::getUniqueID(entry.path().string(), id));
+    ids.emplace(entry.path().filename().string(), id);
+  }
+  return ids;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  testing::InitGoogleTest(&argc, argv);
+  google::ParseCommandLineFlags(&argc, &argv, true);
+  google::InitGoogleLogging(argv[0]);
+
+  return RUN_ALL_TESTS();
+}
+
+// Lifting with a `ParallelTraceLifter` must produce the same traces as
+// lifting with a `TraceLifter`, no matter which worker lifts which trace.
+TEST(ParallelTraceLifter, MatchesTraceLifter) {
+  const auto bytes = CallTreeProgram();
+  const auto expected = LiftProgram(bytes, 0u);
+  ASSERT_EQ(expected.size(), 5u);
+
+  for (auto num_workers : {1u, 2u, 4u}) {
+    for (auto i = 0u; i < 4u; ++i) {
+      EXPECT_EQ(LiftProgram(bytes, num_workers), expected)
+          << "Using " << num_workers << " workers";
+    }
+  }
+}
+
+// Traces loaded from the cache must be the same as the traces that were
+// stored into it, and loading them must not replace the cached files.
+TEST(TraceLifter, CachedTracesRoundTrip) {
+  llvm::SmallString<128> cache_dir_name;
+  ASSERT_FALSE(llvm::sys::fs::createUniqueDirectory("remill-trace-cache",
+                                                    cache_dir_name));
+  const std::filesystem::path cache_dir(cache_dir_name.str().str());
+
+  const auto bytes = CallTreeProgram();
+  const auto expected = LiftProgram(bytes, 0u);
+  ASSERT_EQ(expected.size(), 5u);
+
+  // One file per trace, and no leftover temporary files.
+  EXPECT_EQ(LiftProgram(bytes, 0u, cache_dir), expected);
+  const auto stored_ids = FileIDs(cache_dir);
+  EXPECT_EQ(stored_ids.size(), expected.size());
+  for (const auto &[name, id] : stored_ids) {
+    EXPECT_EQ(std::filesystem::path(name).extension(), ".bc") << name;
+  }
+
+  EXPECT_EQ(LiftProgram(bytes, 0u, cache_dir), expected);
+  EXPECT_EQ(LiftProgram(bytes, 2u, cache_dir), expected);
+  EXPECT_TRUE(FileIDs(cache_dir) == stored_ids);
+
+  std::error_code ec;
+  std::filesystem::remove_all(cache_dir, ec);
+}
+
+// An instruction lifted from a template, i.e. from the IR recorded when the
+// same kind of instruction was first lifted, must get the same IR as when it
+// is lifted without templates.
+TEST(TraceLifter, LiftTemplatesMatchLiftingWithoutTemplates) {
+  const auto bytes = RepeatedInstructionProgram();
+  const auto expected = LiftProgram(bytes, 0u);
+  ASSERT_EQ(expected.size(), 2u);
+
+  EXPECT_EQ(LiftProgram(bytes, 0u, {}, true), expected);
+  EXPECT_EQ(LiftProgram(bytes, 2u, {}, true), expected);
+}
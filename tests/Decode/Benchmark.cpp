@@ -0,0 +1,318 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Measures how many instructions per second each architecture can decode,
+// both when one `Instruction` is `Reset` and reused for every decode (as the
+// `TraceLifter` does), when a new `Instruction` is made for every decode, and
+// when decoding through a `DecodeCache`.
+// Also measures sweeping through all of the sample instructions, laid out
+// back-to-back, with one call to `Arch::DecodeInstructions`, and how long it
+// takes to load each architecture's semantics module, both eagerly and lazily.
+// Finally, measures how long it takes to lift each sample instruction into a
+// block, with and without lift templates, and the hit rate of a cold
+// `DecodeCache` when each instruction is followed by different bytes.
+
+#include <gflags/gflags.h>
+#include <glog/logging.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <remill/Arch/Arch.h>
+#include <remill/Arch/DecodeCache.h>
+#include <remill/Arch/Instruction.h>
+#include <remill/Arch/Name.h>
+#include <remill/BC/ABI.h>
+#include <remill/BC/InstructionLifter.h>
+#include <remill/BC/IntrinsicTable.h>
+#include <remill/BC/Util.h>
+#include <remill/OS/OS.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <vector>
+
+DEFINE_string(arch, "",
+              "Architecture to benchmark. Benchmarks all of the architectures "
+              "with sample instructions if empty.");
+
+DEFINE_uint64(iterations, 100000,
+              "Number of times to decode each sample instruction.");
+
+DEFINE_uint64(lift_iterations, 1000,
+              "Number of times to lift each sample instruction.");
+
+namespace {
+
+struct Samples {
+  const char *arch_name;
+  std::vector<std::string_view> insts;
+};
+
+// A mix of common arithmetic, memory, and control-flow instructions.
+static const Samples kSamples[] = {
+    {"amd64",
+     {
+         {"\x48\x01\xd8", 3},  // add rax, rbx
+         {"\x48\x8b\x45\x08", 4},  // mov rax, [rbp + 8]
+         {"\x48\x8d\x05\x00\x00\x00\x00", 7},  // lea rax, [rip]
+         {"\x74\x05", 2},  // je +5
+         {"\xe8\x00\x00\x00\x00", 5},  // call +0
+         {"\x0f\x1f\x44\x00\x00", 5},  // nop
+         {"\xc3", 1},  // ret
+     }},
+    {"aarch64",
+     {
+         {"\x20\x00\x02\x8b", 4},  // add x0, x1, x2
+         {"\xe0\x07\x40\xf9", 4},  // ldr x0, [sp, #8]
+         {"\x20\x00\x00\x54", 4},  // b.eq +4
+         {"\x00\x00\x00\x94", 4},  // bl +0
+         {"\x1f\x20\x03\xd5", 4},  // nop
+         {"\xc0\x03\x5f\xd6", 4},  // ret
+     }},
+    {"sparc32",
+     {
+         {"\x82\x00\x40\x02", 4},  // add %g1, %g2, %g1
+         {"\xc2\x00\x60\x04", 4},  // ld [%g1 + 4], %g1
+         {"\x40\x00\x00\x00", 4},  // call +0
+         {"\x01\x00\x00\x00", 4},  // nop
+         {"\x81\xc3\xe0\x08", 4},  // retl
+     }},
+    {"sparc64",
+     {
+         {"\x82\x00\x40\x02", 4},  // add %g1, %g2, %g1
+         {"\xc2\x00\x60\x04", 4},  // lduw [%g1 + 4], %g1
+         {"\x40\x00\x00\x00", 4},  // call +0
+         {"\x01\x00\x00\x00", 4},  // nop
+         {"\x81\xc3\xe0\x08", 4},  // retl
+     }},
+};
+
+// Returns the number of nanoseconds per decode of `samples`.
+template <typename DecodeFunc>
+static double TimeDecodes(const Samples &samples, DecodeFunc decode) {
+  const auto start = std::chrono::steady_clock::now();
+  uint64_t address = 0x1000;
+  for (uint64_t i = 0; i < FLAGS_iterations; ++i) {
+    for (auto bytes : samples.insts) {
+      CHECK(decode(address, bytes))
+          << "Unable to decode sample " << samples.arch_name << " instruction";
+      address += 4u;
+    }
+  }
+  const auto end = std::chrono::steady_clock::now();
+  const auto num_decodes =
+      static_cast<double>(FLAGS_iterations * samples.insts.size());
+  return static_cast<double>(
+             std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+                 .count()) /
+         num_decodes;
+}
+
+// Returns the number of milliseconds taken to load the semantics module of
+// the architecture of `samples` into a fresh context.
+static double TimeSemanticsLoad(const Samples &samples, bool lazy) {
+  llvm::LLVMContext context;
+  auto arch = remill::Arch::Build(&context, remill::GetOSName(REMILL_OS),
+                                  remill::GetArchName(samples.arch_name));
+  CHECK(arch != nullptr) << "Unable to build " << samples.arch_name;
+
+  const auto start = std::chrono::steady_clock::now();
+  auto module = lazy ? remill::LoadArchSemanticsLazily(arch.get())
+                     : remill::LoadArchSemantics(arch.get());
+  const auto end = std::chrono::steady_clock::now();
+  CHECK(module != nullptr)
+      << "Unable to load " << samples.arch_name << " semantics";
+  return static_cast<double>(
+             std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+                 .count()) /
+         1000.0;
+}
+
+// Returns the percentage of decodes that hit in a new `DecodeCache`, when the
+// sample instructions are laid out back-to-back in every rotation of their
+// order, and each is decoded from `MaxInstructionSize` bytes, as the
+// `TraceLifter` does. Each instruction is then followed by different bytes.
+static double WindowedHitRate(const Samples &samples, const remill::Arch *arch,
+                              const remill::DecodingContext &decoding_context) {
+  const auto max_size = arch->MaxInstructionSize(decoding_context);
+  const auto num_insts = samples.insts.size();
+  remill::DecodeCache cache(arch);
+  remill::Instruction inst;
+  for (auto rotation = 0u; rotation < num_insts; ++rotation) {
+    std::string code;
+    std::vector<size_t> offsets;
+    for (auto i = 0u; i < num_insts; ++i) {
+      offsets.push_back(code.size());
+      const auto bytes = samples.insts[(rotation + i) % num_insts];
+      code.insert(code.end(), bytes.begin(), bytes.end());
+    }
+    for (auto offset : offsets) {
+      inst.Reset();
+      CHECK(cache.DecodeInstruction(0x1000 + offset,
+                                    std::string_view(code).substr(offset,
+                                                                  max_size),
+                                    inst, decoding_context))
+          << "Unable to decode sample " << samples.arch_name << " instruction";
+    }
+  }
+  return cache.Stats().HitRate() * 100.0;
+}
+
+// Returns the number of nanoseconds per lift of the instructions of
+// `samples`. Each iteration lifts all of them into a new function, so that
+// the addresses of registers are looked up again as they are in new traces.
+static double TimeLifts(const Samples &samples, const remill::Arch *arch,
+                        llvm::Module *module,
+                        const remill::DecodingContext &decoding_context,
+                        bool use_templates) {
+  std::vector<remill::Instruction> insts(samples.insts.size());
+  uint64_t address = 0x1000;
+  for (auto i = 0u; i < insts.size(); ++i, address += 4u) {
+    CHECK(arch->DecodeInstruction(address, samples.insts[i], insts[i],
+                                  decoding_context))
+        << "Unable to decode sample " << samples.arch_name << " instruction";
+  }
+
+  remill::IntrinsicTable intrinsics(module);
+  remill::InstructionLifter lifter(arch, intrinsics);
+  lifter.EnableLiftTemplates(use_templates);
+
+  const auto start = std::chrono::steady_clock::now();
+  for (uint64_t i = 0; i < FLAGS_lift_iterations; ++i) {
+    auto func = arch->DefineLiftedFunction("bench_lift", module);
+    auto block = llvm::BasicBlock::Create(module->getContext(), "", func);
+    auto state_ptr = remill::NthArgument(func, remill::kStatePointerArgNum);
+    for (auto &inst : insts) {
+      CHECK_EQ(lifter.LiftIntoBlock(inst, block, state_ptr),
+               remill::kLiftedInstruction)
+          << "Unable to lift sample " << samples.arch_name << " instruction "
+          << inst.Serialize();
+    }
+    func->eraseFromParent();
+  }
+  const auto end = std::chrono::steady_clock::now();
+  const auto num_lifts =
+      static_cast<double>(FLAGS_lift_iterations * insts.size());
+  return static_cast<double>(
+             std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+                 .count()) /
+         num_lifts;
+}
+
+static void Benchmark(const Samples &samples) {
+  const auto eager_ms = TimeSemanticsLoad(samples, false);
+  const auto lazy_ms = TimeSemanticsLoad(samples, true);
+
+  llvm::LLVMContext context;
+  auto arch = remill::Arch::Build(&context, remill::GetOSName(REMILL_OS),
+                                  remill::GetArchName(samples.arch_name));
+  CHECK(arch != nullptr) << "Unable to build " << samples.arch_name;
+
+  // Decoding needs the intrinsics of the semantics module.
+  auto module = remill::LoadArchSemanticsLazily(arch.get());
+  CHECK(module != nullptr)
+      << "Unable to load " << samples.arch_name << " semantics";
+
+  const auto decoding_context = arch->CreateInitialContext();
+
+  remill::Instruction reused_inst;
+  const auto reused_ns = TimeDecodes(
+      samples, [&](uint64_t address, std::string_view bytes) {
+        reused_inst.Reset();
+        return arch->DecodeInstruction(address, bytes, reused_inst,
+                                       decoding_context);
+      });
+
+  const auto fresh_ns =
+      TimeDecodes(samples, [&](uint64_t address, std::string_view bytes) {
+        remill::Instruction fresh_inst;
+        return arch->DecodeInstruction(address, bytes, fresh_inst,
+                                       decoding_context);
+      });
+
+  remill::DecodeCache cache(arch.get());
+  remill::Instruction cached_inst;
+  const auto cached_ns = TimeDecodes(
+      samples, [&](uint64_t address, std::string_view bytes) {
+        cached_inst.Reset();
+        return cache.DecodeInstruction(address, bytes, cached_inst,
+                                       decoding_context);
+      });
+
+  std::string code;
+  for (auto bytes : samples.insts) {
+    code.insert(code.end(), bytes.begin(), bytes.end());
+  }
+
+  std::vector<remill::Instruction> batch_insts;
+  const auto batch_start = std::chrono::steady_clock::now();
+  for (uint64_t i = 0; i < FLAGS_iterations; ++i) {
+    CHECK_EQ(arch->DecodeInstructions(0x1000, code, batch_insts,
+                                      decoding_context),
+             samples.insts.size())
+        << "Unable to decode sample " << samples.arch_name << " instructions";
+  }
+  const auto batch_end = std::chrono::steady_clock::now();
+  const auto batch_ns =
+      static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                              batch_end - batch_start)
+                              .count()) /
+      static_cast<double>(FLAGS_iterations * samples.insts.size());
+
+  const auto window_hits = WindowedHitRate(samples, arch.get(),
+                                          decoding_context);
+
+  const auto lift_ns = TimeLifts(samples, arch.get(), module.get(),
+                                 decoding_context, false);
+  const auto template_lift_ns = TimeLifts(samples, arch.get(), module.get(),
+                                          decoding_context, true);
+
+  std::printf(
+      "%-10s %14.1f %14.1f %14.1f %14.1f %14.0f %14.1f %14.1f %14.1f "
+      "%14.1f %14.1f\n",
+      samples.arch_name, reused_ns, fresh_ns, cached_ns, batch_ns,
+      1e9 / batch_ns, eager_ms, lazy_ms, window_hits, lift_ns,
+      template_lift_ns);
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  google::ParseCommandLineFlags(&argc, &argv, true);
+  google::InitGoogleLogging(argv[0]);
+
+  std::printf("%-10s %14s %14s %14s %14s %14s %14s %14s %14s %14s %14s\n",
+              "arch", "reset (ns)", "fresh (ns)", "cached (ns)", "batch (ns)",
+              "decodes/s", "load (ms)", "lazy load (ms)", "win hits (%)",
+              "lift (ns)", "tpl lift (ns)");
+  auto found = false;
+  for (const auto &samples : kSamples) {
+    if (FLAGS_arch.empty() || FLAGS_arch == samples.arch_name) {
+      found = true;
+      Benchmark(samples);
+    }
+  }
+
+  if (!found) {
+    std::fprintf(stderr, "No sample instructions for architecture %s\n",
+                 FLAGS_arch.c_str());
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
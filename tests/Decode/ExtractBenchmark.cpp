@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Compares the two AArch64 extractors, `TryExtract` (the decision automaton)
+// and `TryExtractWithTree` (the chains of encodings), over a sample of all
+// 2^32 instruction words. Every sampled word must extract to identical
+// `InstData`, and the time taken by each extractor is reported.
+
+#include <gflags/gflags.h>
+#include <glog/logging.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "Decode.h"
+
+DEFINE_uint64(stride, 997,
+              "Distance between sampled instruction words. A stride of 1 "
+              "checks every instruction word.");
+
+namespace {
+
+using remill::aarch64::InstData;
+
+using ExtractFunc = bool (*)(const uint8_t *, InstData &);
+
+// Returns the number of nanoseconds per call to `extract` over the sampled
+// instruction words, and the number of words that were extracted.
+static double TimeExtractor(ExtractFunc extract, uint64_t &num_valid) {
+  InstData data;
+  uint64_t num_words = 0;
+  num_valid = 0;
+
+  const auto start = std::chrono::steady_clock::now();
+  for (uint64_t word = 0; word <= UINT32_MAX; word += FLAGS_stride) {
+    const auto bits = static_cast<uint32_t>(word);
+    uint8_t bytes[4];
+    std::memcpy(bytes, &bits, sizeof(bytes));
+    num_valid += extract(bytes, data) ? 1u : 0u;
+    ++num_words;
+  }
+  const auto end = std::chrono::steady_clock::now();
+
+  return static_cast<double>(
+             std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+                 .count()) /
+         static_cast<double>(num_words);
+}
+
+// Returns the number of sampled instruction words on which the extractors
+// disagree.
+static uint64_t CompareExtractors(void) {
+  uint64_t num_mismatches = 0;
+  for (uint64_t word = 0; word <= UINT32_MAX; word += FLAGS_stride) {
+    const auto bits = static_cast<uint32_t>(word);
+    uint8_t bytes[4];
+    std::memcpy(bytes, &bits, sizeof(bytes));
+
+    // Zero both, padding and all, so that they can be compared with `memcmp`.
+    InstData tree_data;
+    InstData automaton_data;
+    std::memset(&tree_data, 0, sizeof(tree_data));
+    std::memset(&automaton_data, 0, sizeof(automaton_data));
+
+    const auto tree_ok =
+        remill::aarch64::TryExtractWithTree(bytes, tree_data);
+    const auto automaton_ok =
+        remill::aarch64::TryExtract(bytes, automaton_data);
+    if (tree_ok != automaton_ok ||
+        std::memcmp(&tree_data, &automaton_data, sizeof(InstData))) {
+      if (!num_mismatches) {
+        std::fprintf(stderr, "Extractors disagree on instruction %08x\n",
+                     bits);
+      }
+      ++num_mismatches;
+    }
+  }
+  return num_mismatches;
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  google::ParseCommandLineFlags(&argc, &argv, true);
+  google::InitGoogleLogging(argv[0]);
+  CHECK_GT(FLAGS_stride, 0u) << "Stride must be positive";
+
+  const auto num_mismatches = CompareExtractors();
+
+  uint64_t tree_valid = 0;
+  uint64_t automaton_valid = 0;
+  const auto tree_ns =
+      TimeExtractor(remill::aarch64::TryExtractWithTree, tree_valid);
+  const auto automaton_ns =
+      TimeExtractor(remill::aarch64::TryExtract, automaton_valid);
+
+  std::printf("%-10s %14s %14s\n", "extractor", "per word (ns)", "valid");
+  std::printf("%-10s %14.1f %14llu\n", "tree", tree_ns,
+              static_cast<unsigned long long>(tree_valid));
+  std::printf("%-10s %14.1f %14llu\n", "automaton", automaton_ns,
+              static_cast<unsigned long long>(automaton_valid));
+  std::printf("speedup    %14.2fx\n", tree_ns / automaton_ns);
+
+  if (num_mismatches) {
+    std::fprintf(stderr, "%llu sampled instructions extracted differently\n",
+                 static_cast<unsigned long long>(num_mismatches));
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gflags/gflags.h>
+#include <glog/logging.h>
+#include <gtest/gtest.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <remill/Arch/Arch.h>
+#include <remill/Arch/DecodeCache.h>
+#include <remill/Arch/Instruction.h>
+#include <remill/Arch/Name.h>
+#include <remill/BC/Util.h>
+#include <remill/OS/OS.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace {
+
+// AArch64 encodings of the few instructions used by the tests. `kAddX0` is
+// `add x0, x0, #1`.
+static constexpr std::string_view kAddX0("\x00\x04\x00\x91", 4);  // add
+static constexpr std::string_view kRet("\xc0\x03\x5f\xd6", 4);  // ret
+static constexpr std::string_view kNop("\x1f\x20\x03\xd5", 4);  // nop
+static constexpr std::string_view kBL8("\x02\x00\x00\x94", 4);  // bl +8
+
+class DecodeCacheTest : public testing::Test {
+ protected:
+  void SetUp(void) override {
+    arch = remill::Arch::Build(&context, remill::kOSLinux,
+                               remill::kArchAArch64LittleEndian);
+    ASSERT_NE(arch, nullptr);
+    ASSERT_TRUE(arch->DecodingIsPositionIndependent());
+
+    // Decoding needs the semantics module's intrinsics.
+    module = remill::LoadArchSemanticsLazily(arch.get());
+    ASSERT_NE(module, nullptr);
+  }
+
+  // Decode `bytes` at `address` through `cache`.
+  bool Decode(remill::DecodeCache &cache, uint64_t address,
+              std::string_view bytes, remill::Instruction &inst) {
+    inst.Reset();
+    return cache.DecodeInstruction(address, bytes, inst,
+                                   arch->CreateInitialContext());
+  }
+
+  llvm::LLVMContext context;
+  remill::Arch::ArchPtr arch;
+  std::unique_ptr<llvm::Module> module;
+};
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  testing::InitGoogleTest(&argc, argv);
+  google::ParseCommandLineFlags(&argc, &argv, true);
+  google::InitGoogleLogging(argv[0]);
+
+  return RUN_ALL_TESTS();
+}
+
+// An instruction cached at one address is reused at another, with all of its
+// program counters and flow targets moved to the new address.
+TEST_F(DecodeCacheTest, HitsArePositionIndependent) {
+  remill::DecodeCache cache(arch.get());
+  remill::Instruction inst;
+  ASSERT_TRUE(Decode(cache, 0x1000, kBL8, inst));
+  EXPECT_EQ(inst.branch_taken_pc, 0x1008u);
+  EXPECT_EQ(cache.Stats().misses, 1u);
+
+  ASSERT_TRUE(Decode(cache, 0x2000, kBL8, inst));
+  EXPECT_EQ(cache.Stats().hits, 1u);
+  EXPECT_EQ(cache.Stats().misses, 1u);
+
+  remill::Instruction expected;
+  ASSERT_TRUE(arch->DecodeInstruction(0x2000, kBL8, expected,
+                                      arch->CreateInitialContext()));
+  EXPECT_EQ(inst.pc, 0x2000u);
+  EXPECT_EQ(inst.next_pc, 0x2004u);
+  EXPECT_EQ(inst.branch_taken_pc, 0x2008u);
+  EXPECT_EQ(inst.branch_not_taken_pc, expected.branch_not_taken_pc);
+  EXPECT_EQ(inst.category, expected.category);
+  EXPECT_TRUE(inst.flows == expected.flows);
+  EXPECT_EQ(inst.Serialize(), expected.Serialize());
+}
+
+// Once the cache is full, the least recently used instruction is evicted.
+TEST_F(DecodeCacheTest, EvictsLeastRecentlyUsed) {
+  remill::DecodeCache cache(arch.get(), 2u);
+  remill::Instruction inst;
+  ASSERT_TRUE(Decode(cache, 0x1000, kAddX0, inst));
+  ASSERT_TRUE(Decode(cache, 0x1004, kRet, inst));
+
+  // Makes `kRet` the least recently used.
+  ASSERT_TRUE(Decode(cache, 0x1008, kAddX0, inst));
+  EXPECT_EQ(cache.Stats().hits, 1u);
+  EXPECT_EQ(cache.Stats().misses, 2u);
+  EXPECT_EQ(cache.Stats().evictions, 0u);
+
+  // Evicts `kRet`, but not `kAddX0`.
+  ASSERT_TRUE(Decode(cache, 0x100c, kNop, inst));
+  EXPECT_EQ(cache.Stats().evictions, 1u);
+  ASSERT_TRUE(Decode(cache, 0x1010, kAddX0, inst));
+  EXPECT_EQ(cache.Stats().hits, 2u);
+
+  // `kRet` must be decoded again, and evicts `kNop`.
+  ASSERT_TRUE(Decode(cache, 0x1014, kRet, inst));
+  EXPECT_TRUE(inst.IsFunctionReturn());
+  EXPECT_EQ(inst.pc, 0x1014u);
+  EXPECT_EQ(cache.Stats().misses, 4u);
+  EXPECT_EQ(cache.Stats().evictions, 2u);
+
+  ASSERT_TRUE(Decode(cache, 0x1018, kNop, inst));
+  EXPECT_EQ(cache.Stats().misses, 5u);
+  EXPECT_EQ(cache.Stats().hits, 2u);
+  EXPECT_EQ(cache.Stats().uncacheable, 0u);
+}
+
+// An instruction is cached by only the bytes that the decoder looked at, and
+// so hits no matter what follows it in the bytes given to the decoder.
+TEST_F(DecodeCacheTest, HitsIgnoreFollowingBytes) {
+  ASSERT_EQ(arch->MaxDecodeLookahead(arch->CreateInitialContext()), 0u);
+
+  const std::string add_then_ret = std::string(kAddX0) + std::string(kRet);
+  const std::string add_then_nop = std::string(kAddX0) + std::string(kNop);
+
+  remill::DecodeCache cache(arch.get());
+  remill::Instruction inst;
+  ASSERT_TRUE(Decode(cache, 0x1000, add_then_ret, inst));
+  EXPECT_EQ(inst.bytes, kAddX0);
+  EXPECT_EQ(cache.Stats().misses, 1u);
+
+  ASSERT_TRUE(Decode(cache, 0x2000, add_then_nop, inst));
+  EXPECT_EQ(inst.bytes, kAddX0);
+  EXPECT_EQ(inst.next_pc, 0x2004u);
+  EXPECT_EQ(cache.Stats().hits, 1u);
+
+  ASSERT_TRUE(Decode(cache, 0x3000, kAddX0, inst));
+  EXPECT_EQ(cache.Stats().hits, 2u);
+  EXPECT_EQ(cache.Stats().misses, 1u);
+
+  // Too few bytes to decode anything are cached by all of them.
+  EXPECT_FALSE(Decode(cache, 0x4000, kAddX0.substr(0, 2), inst));
+  EXPECT_FALSE(Decode(cache, 0x5000, kAddX0.substr(0, 2), inst));
+  EXPECT_EQ(cache.Stats().hits, 3u);
+  EXPECT_EQ(cache.Stats().misses, 2u);
+}
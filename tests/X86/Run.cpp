@@ -197,6 +197,41 @@ NEVER_INLINE Memory *__remill_write_memory_f80(Memory *, addr_t addr,
   return nullptr;
 }
 
+#define MAKE_RW_VEC_MEMORY(size) \
+  NEVER_INLINE Memory *__remill_read_memory_v##size( \
+      Memory *, addr_t addr, vec##size##_t &out) { \
+    out = AccessMemory<vec##size##_t>(addr); \
+    return nullptr; \
+  } \
+  NEVER_INLINE Memory *__remill_write_memory_v##size( \
+      Memory *, addr_t addr, const vec##size##_t &in) { \
+    AccessMemory<vec##size##_t>(addr) = in; \
+    return nullptr; \
+  }
+
+MAKE_RW_VEC_MEMORY(128)
+MAKE_RW_VEC_MEMORY(256)
+MAKE_RW_VEC_MEMORY(512)
+
+NEVER_INLINE Memory *__remill_memcpy(Memory *, addr_t dst, addr_t src,
+                                     addr_t size) {
+  if (size) {
+    (void) AccessMemory<uint8_t>(dst + size - 1);
+    (void) AccessMemory<uint8_t>(src + size - 1);
+    memmove(&AccessMemory<uint8_t>(dst), &AccessMemory<uint8_t>(src), size);
+  }
+  return nullptr;
+}
+
+NEVER_INLINE Memory *__remill_memset(Memory *, addr_t dst, uint8_t val,
+                                     addr_t size) {
+  if (size) {
+    (void) AccessMemory<uint8_t>(dst + size - 1);
+    memset(&AccessMemory<uint8_t>(dst), val, size);
+  }
+  return nullptr;
+}
+
 Memory *__remill_compare_exchange_memory_8(Memory *memory, addr_t addr,
                                            uint8_t &expected, uint8_t desired) {
   expected = __sync_val_compare_and_swap(reinterpret_cast<uint8_t *>(addr),
@@ -809,6 +844,47 @@ static void ImportX87State(State *state) {
   state->sw.c3 = fpu.fxsave.swd.c3;
 }
 
+#if REMILL_X86_LAZY_FLAGS
+
+template <typename T>
+static void MaterializeAddSub(State *state, bool is_add) {
+  constexpr auto kSignShift = sizeof(T) * 8 - 1;
+  const auto &lazy = state->lazy_aflag;
+  const auto lhs = static_cast<T>(lazy.lhs);
+  const auto rhs = static_cast<T>(lazy.rhs);
+  const auto res = static_cast<T>(lazy.res);
+  auto &aflag = state->aflag;
+  aflag.cf = is_add ? res < lhs : lhs < rhs;
+  aflag.pf = !__builtin_parity(static_cast<uint8_t>(res));
+  aflag.af = !!((lhs ^ rhs ^ res) & 0x10);
+  aflag.zf = !res;
+  aflag.sf = static_cast<uint8_t>(res >> kSignShift);
+  aflag.of = static_cast<uint8_t>(
+      (is_add ? (lhs ^ res) & (rhs ^ res) : (lhs ^ rhs) & (lhs ^ res)) >>
+      kSignShift);
+}
+
+// The lifted code may leave the arithmetic flags as the operands of the last
+// `add`- or `sub`-like instruction. Compute them so that they can be compared
+// against the native flags.
+static void MaterializeLazyFlags(State *state) {
+  auto &lazy = state->lazy_aflag;
+  switch (lazy.kind) {
+    case kLazyArithFlagsAdd8: MaterializeAddSub<uint8_t>(state, true); break;
+    case kLazyArithFlagsAdd16: MaterializeAddSub<uint16_t>(state, true); break;
+    case kLazyArithFlagsAdd32: MaterializeAddSub<uint32_t>(state, true); break;
+    case kLazyArithFlagsAdd64: MaterializeAddSub<uint64_t>(state, true); break;
+    case kLazyArithFlagsSub8: MaterializeAddSub<uint8_t>(state, false); break;
+    case kLazyArithFlagsSub16: MaterializeAddSub<uint16_t>(state, false); break;
+    case kLazyArithFlagsSub32: MaterializeAddSub<uint32_t>(state, false); break;
+    case kLazyArithFlagsSub64: MaterializeAddSub<uint64_t>(state, false); break;
+    default: break;
+  }
+  memset(&lazy, 0, sizeof(lazy));
+}
+
+#endif  // REMILL_X86_LAZY_FLAGS
+
 // Resets the flags to sane defaults. This will disable the trap flag, the
 // alignment check flag, and the CPUID capability flag.
 static void ResetFlags(void) {
@@ -1006,6 +1082,10 @@ static void RunWithFlags(const test::TestInfo *info, Flags flags,
   native_state->gpr.rip.aword = 0;
 #endif
 
+#if REMILL_X86_LAZY_FLAGS
+  MaterializeLazyFlags(lifted_state);
+#endif
+
   // Copy the aflags state back into the rflags state.
   lifted_state->rflag.cf = lifted_state->aflag.cf;
   lifted_state->rflag.pf = lifted_state->aflag.pf;